@@ -0,0 +1,996 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_map.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:11:28 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 09:14:24 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BTREE_MAP_HPP
+# define BTREE_MAP_HPP
+
+# include <cstddef>		// size_t
+# include <functional>	// std::less
+# include <memory>		// std::allocator
+
+# include "../Iterators/btree_iterator.hpp"
+# include "../Iterators/iterator_traits.hpp"
+# include "../Iterators/reverse_iterator.hpp"
+# include "../Others/algorithm.hpp"
+# include "../Others/btree_node.hpp"
+# include "../Others/pair.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- B-tree map -
+		Same interface as map, stored in a B+ tree: the elements sit in leaves of up to btree_slots<Key>::value elements, next to a contiguous array of their keys, and the internal nodes only hold separator keys.
+		A lookup reads a handful of nodes of a few cache lines each instead of one heap node per level of a red-black tree, and an element costs its own size plus a copy of its key instead of a node of several pointers.
+		In exchange, elements are moved within and between leaves: inserting or erasing an element invalidates the iterators, pointers and references to the other elements.
+		Key must be default constructible and assignable, since the key arrays are allocated in full with each node.
+	-------------------------------------------------------------------------------- */
+	template<class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<pair<const Key, T> > >
+	class btree_map
+	{
+		public:
+			typedef				Key																												key_type;
+			typedef				T																												mapped_type;
+			typedef				pair<const key_type, mapped_type>																				value_type;
+			typedef				Compare																											key_compare;
+			class																																value_compare
+			{
+				friend class btree_map<Key, T, Compare, Alloc>;
+				protected:
+					Compare comp;
+					value_compare(Compare c) : comp(c)
+						{return;}
+
+				public:
+					bool operator()(const value_type& x, const value_type& y) const
+						{return (comp(x.first, y.first));}
+			};
+			typedef				Alloc																											allocator_type;
+			typedef typename	allocator_type::reference																						reference;
+			typedef typename	allocator_type::const_reference																					const_reference;
+			typedef typename	allocator_type::pointer																							pointer;
+			typedef typename	allocator_type::const_pointer																					const_pointer;
+			typedef				btree_iterator<value_type, btree_leaf<Key, value_type, btree_slots<Key>::value> >								iterator;
+			typedef				btree_iterator<const value_type, btree_leaf<Key, value_type, btree_slots<Key>::value> >							const_iterator;
+			typedef typename	ft::reverse_iterator<iterator>																					reverse_iterator;
+			typedef typename	ft::reverse_iterator<const_iterator>																			const_reverse_iterator;
+			typedef typename	iterator_traits<iterator>::difference_type																		difference_type;
+			typedef				size_t																											size_type;
+
+		private:
+			enum																																{_slots = btree_slots<Key>::value, _min = _slots / 2 - 1};
+
+			typedef				btree_node<Key, value_type, _slots>																				node_type;
+			typedef				btree_leaf<Key, value_type, _slots>																				leaf_type;
+			typedef				btree_internal<Key, value_type, _slots>																			internal_type;
+			typedef typename	Alloc::template rebind<leaf_type>::other																		leaf_allocator;
+			typedef typename	Alloc::template rebind<internal_type>::other																	internal_allocator;
+
+			node_type*			_root;
+			leaf_type*			_first;
+			leaf_type*			_last;
+			size_type			_size;
+			key_compare			_key_comp;
+			allocator_type		_alloc;
+			leaf_allocator		_leaf_alloc;
+			internal_allocator	_internal_alloc;
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTOR ----- */
+
+			/* --------------------------------------------------------------------------------
+			- Empty container constructor (default constructor) -
+				Constructs an empty container, with no elements; no node is allocated until the first insertion.
+
+			Source: https://cplusplus.com/reference/map/map/map/
+			-------------------------------------------------------------------------------- */
+			explicit btree_map(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _root(NULL), _first(NULL), _last(NULL), _size(0), _key_comp(comp), _alloc(alloc), _leaf_alloc(), _internal_alloc()
+				{return;}
+
+			/* --------------------------------------------------------------------------------
+			- Range constructor -
+				Constructs a container with as many elements as the range [first, last], with each element constructed from its corresponding element in that range.
+
+			Source: https://cplusplus.com/reference/map/map/map/
+			-------------------------------------------------------------------------------- */
+			template<class InputIterator>
+			btree_map(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _root(NULL), _first(NULL), _last(NULL), _size(0), _key_comp(comp), _alloc(alloc), _leaf_alloc(), _internal_alloc()
+			{
+				insert(first, last);
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Copy constructor -
+				Constructs a container with a copy of each of the elements in x, appended in order to the last leaf.
+
+			Source: https://cplusplus.com/reference/map/map/map/
+			-------------------------------------------------------------------------------- */
+			btree_map(const btree_map& x) : _root(NULL), _first(NULL), _last(NULL), _size(0), _key_comp(x._key_comp), _alloc(x._alloc), _leaf_alloc(), _internal_alloc()
+			{
+				insert(x.begin(), x.end());
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Map destructor -
+				Destroys the container object, its elements and its nodes.
+
+			Source: https://cplusplus.com/reference/map/map/~map/
+			-------------------------------------------------------------------------------- */
+			~btree_map()
+			{
+				clear();
+				return;
+			}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			/* --- Operator overloads --- */
+
+			/* --------------------------------------------------------------------------------
+			- Copy container content -
+				Destroys the elements of the container and copies those of x.
+
+			Source: https://cplusplus.com/reference/map/map/operator=/
+			-------------------------------------------------------------------------------- */
+			btree_map&								operator=(const btree_map& x)
+			{
+				if (this == &x)
+					return (*this);
+
+				clear();
+				_key_comp = x._key_comp;
+				insert(x.begin(), x.end());
+
+				return (*this);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Access element -
+				Returns a reference to the mapped value of the element with a key equivalent to k, inserting one with a default constructed mapped value if there is none.
+
+			Source: https://cplusplus.com/reference/map/map/operator[]/
+			-------------------------------------------------------------------------------- */
+			mapped_type&							operator[](const key_type& k)
+			{
+				iterator	it = lower_bound(k);
+
+				if (it != end() && !_key_comp(k, it->first))
+					return (it->second);
+
+				return (insert(it, value_type(k, mapped_type()))->second);
+			}
+
+
+			/* --- Iterators --- */
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to beginning -
+				Returns an iterator referring to the first element of the first leaf.
+
+			Source: https://cplusplus.com/reference/map/map/begin/
+			-------------------------------------------------------------------------------- */
+			iterator								begin()
+				{return (iterator(_first, 0));}
+
+			const_iterator							begin() const
+				{return (const_iterator(_first, 0));}
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to end -
+				Returns an iterator referring to the position past the last element of the last leaf.
+
+			Source: https://cplusplus.com/reference/map/map/end/
+			-------------------------------------------------------------------------------- */
+			iterator								end()
+				{return (iterator(_last, (_last ? _last->get_count() : 0)));}
+
+			const_iterator							end() const
+				{return (const_iterator(_last, (_last ? _last->get_count() : 0)));}
+
+			/* --------------------------------------------------------------------------------
+			- Return reverse iterator to reverse beginning -
+
+			Source: https://cplusplus.com/reference/map/map/rbegin/
+			-------------------------------------------------------------------------------- */
+			reverse_iterator						rbegin()
+				{return (reverse_iterator(end()));}
+
+			const_reverse_iterator					rbegin() const
+				{return (const_reverse_iterator(end()));}
+
+			/* --------------------------------------------------------------------------------
+			- Return reverse iterator to reverse end -
+
+			Source: https://cplusplus.com/reference/map/map/rend/
+			-------------------------------------------------------------------------------- */
+			reverse_iterator						rend()
+				{return (reverse_iterator(begin()));}
+
+			const_reverse_iterator					rend() const
+				{return (const_reverse_iterator(begin()));}
+
+
+			/* --- Capacity --- */
+
+			/* --------------------------------------------------------------------------------
+			- Test whether container is empty -
+
+			Source: https://cplusplus.com/reference/map/map/empty/
+			-------------------------------------------------------------------------------- */
+			bool									empty() const
+				{return (!_size);}
+
+			/* --------------------------------------------------------------------------------
+			- Return container size -
+
+			Source: https://cplusplus.com/reference/map/map/size/
+			-------------------------------------------------------------------------------- */
+			size_type								size() const
+				{return (_size);}
+
+			/* --------------------------------------------------------------------------------
+			- Return maximum size -
+
+			Source: https://cplusplus.com/reference/map/map/max_size/
+			-------------------------------------------------------------------------------- */
+			size_type								max_size() const
+				{return (_alloc.max_size());}
+
+
+			/* --- Modifiers --- */
+
+			/* --------------------------------------------------------------------------------
+			- Insert element -
+				Inserts val in the leaf where it belongs, unless an element with an equivalent key is already in the container.
+				A leaf that becomes full is split in two halves and the first key of the second half is inserted in the parent, which may be split in turn up to the root.
+
+			Returns a pair with an iterator to the inserted element, or to the element that prevented the insertion, and whether val was inserted.
+
+			Source: https://cplusplus.com/reference/map/map/insert/
+			-------------------------------------------------------------------------------- */
+			pair<iterator, bool>					insert(const value_type& val)
+			{
+				if (!_root)
+					return (pair<iterator, bool>(_insert_at(NULL, 0, val), true));
+
+				leaf_type*	leaf = _find_leaf(val.first);
+				size_type	pos = leaf->lower_index(val.first, _key_comp);
+
+				if (pos < leaf->get_count() && !_key_comp(val.first, leaf->get_key(pos)))
+					return (pair<iterator, bool>(iterator(leaf, pos), false));
+
+				return (pair<iterator, bool>(_insert_at(leaf, pos, val), true));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert element with hint -
+				When val goes right before hint and after the element preceding it in the same leaf (or after the last element, for end()), it is inserted there without descending from the root; appending sorted elements costs amortized O(1) each.
+
+			Source: https://cplusplus.com/reference/map/map/insert/
+			-------------------------------------------------------------------------------- */
+			iterator								insert(iterator hint, const value_type& val)
+			{
+				leaf_type*	leaf = hint.base();
+				size_type	pos = hint.position();
+
+				if (leaf && pos && _key_comp(leaf->get_key(pos - 1), val.first) && (pos == leaf->get_count() || _key_comp(val.first, leaf->get_key(pos))))
+					return (_insert_at(leaf, pos, val));
+
+				return (insert(val).first);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert range -
+
+			Source: https://cplusplus.com/reference/map/map/insert/
+			-------------------------------------------------------------------------------- */
+			template<class InputIterator>
+			void									insert(InputIterator first, InputIterator last)
+			{
+				for (; first != last; first++)
+					insert(end(), *first);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase element -
+				Removes the element at position from its leaf. A leaf left with fewer than half its slots borrows an element from a sibling, or is merged with it, and the parent is rebalanced the same way.
+
+			Source: https://cplusplus.com/reference/map/map/erase/
+			-------------------------------------------------------------------------------- */
+			void									erase(iterator position)
+			{
+				_erase(position);
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase element by key -
+
+			Returns the number of elements erased.
+
+			Source: https://cplusplus.com/reference/map/map/erase/
+			-------------------------------------------------------------------------------- */
+			size_type								erase(const key_type& k)
+			{
+				iterator	it = find(k);
+
+				if (it == end())
+					return (0);
+
+				_erase(it);
+
+				return (1);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase range -
+				Removes the elements in [first, last), leaf by leaf: an element is erased in place and the position of the next one is only searched again when a leaf had to be rebalanced, about once every half leaf.
+
+			Source: https://cplusplus.com/reference/map/map/erase/
+			-------------------------------------------------------------------------------- */
+			void									erase(iterator first, iterator last)
+			{
+				if (first == begin() && last == end())
+				{
+					clear();
+					return;
+				}
+
+				for (difference_type n = ft::distance(first, last); n > 0; n--)
+					first = _erase(first);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Swap content -
+
+			Source: https://cplusplus.com/reference/map/map/swap/
+			-------------------------------------------------------------------------------- */
+			void									swap(btree_map& x)
+			{
+				node_type*		tmp_root = _root;
+				leaf_type*		tmp_first = _first;
+				leaf_type*		tmp_last = _last;
+				size_type		tmp_size = _size;
+				key_compare		tmp_comp = _key_comp;
+
+				_root = x._root;
+				_first = x._first;
+				_last = x._last;
+				_size = x._size;
+				_key_comp = x._key_comp;
+				x._root = tmp_root;
+				x._first = tmp_first;
+				x._last = tmp_last;
+				x._size = tmp_size;
+				x._key_comp = tmp_comp;
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Clear content -
+				Destroys every element and deallocates every node.
+
+			Source: https://cplusplus.com/reference/map/map/clear/
+			-------------------------------------------------------------------------------- */
+			void									clear()
+			{
+				_destroy(_root);
+				_root = NULL;
+				_first = NULL;
+				_last = NULL;
+				_size = 0;
+
+				return;
+			}
+
+
+			/* --- Observers --- */
+
+			/* --------------------------------------------------------------------------------
+			- Return key comparison object -
+
+			Source: https://cplusplus.com/reference/map/map/key_comp/
+			-------------------------------------------------------------------------------- */
+			key_compare								key_comp() const
+				{return (_key_comp);}
+
+			/* --------------------------------------------------------------------------------
+			- Return value comparison object -
+
+			Source: https://cplusplus.com/reference/map/map/value_comp/
+			-------------------------------------------------------------------------------- */
+			value_compare							value_comp() const
+				{return (value_compare(_key_comp));}
+
+
+			/* --- Operations --- */
+
+			/* --------------------------------------------------------------------------------
+			- Get iterator to element -
+
+			Source: https://cplusplus.com/reference/map/map/find/
+			-------------------------------------------------------------------------------- */
+			iterator								find(const key_type& k)
+			{
+				iterator	it = lower_bound(k);
+
+				if (it != end() && _key_comp(k, it->first))
+					return (end());
+
+				return (it);
+			}
+
+			const_iterator							find(const key_type& k) const
+			{
+				const_iterator	it = lower_bound(k);
+
+				if (it != end() && _key_comp(k, it->first))
+					return (end());
+
+				return (it);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Count elements with a specific key -
+
+			Source: https://cplusplus.com/reference/map/map/count/
+			-------------------------------------------------------------------------------- */
+			size_type								count(const key_type& k) const
+				{return (find(k) != end());}
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to lower bound -
+				Descends to the leaf that may hold k and counts the keys of that leaf that are less than k.
+
+			Source: https://cplusplus.com/reference/map/map/lower_bound/
+			-------------------------------------------------------------------------------- */
+			iterator								lower_bound(const key_type& k)
+			{
+				if (!_root)
+					return (end());
+
+				leaf_type*	leaf = _find_leaf(k);
+
+				return (_make_iterator(leaf, leaf->lower_index(k, _key_comp)));
+			}
+
+			const_iterator							lower_bound(const key_type& k) const
+				{return (const_cast<btree_map*>(this)->lower_bound(k));}
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to upper bound -
+
+			Source: https://cplusplus.com/reference/map/map/upper_bound/
+			-------------------------------------------------------------------------------- */
+			iterator								upper_bound(const key_type& k)
+			{
+				if (!_root)
+					return (end());
+
+				leaf_type*	leaf = _find_leaf(k);
+
+				return (_make_iterator(leaf, leaf->upper_index(k, _key_comp)));
+			}
+
+			const_iterator							upper_bound(const key_type& k) const
+				{return (const_cast<btree_map*>(this)->upper_bound(k));}
+
+			/* --------------------------------------------------------------------------------
+			- Get range of equal elements -
+
+			Source: https://cplusplus.com/reference/map/map/equal_range/
+			-------------------------------------------------------------------------------- */
+			pair<iterator, iterator>				equal_range(const key_type& k)
+				{return (pair<iterator, iterator>(lower_bound(k), upper_bound(k)));}
+
+			pair<const_iterator, const_iterator>	equal_range(const key_type& k) const
+				{return (pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k)));}
+
+
+			/* --- Allocator --- */
+
+			/* --------------------------------------------------------------------------------
+			- Get allocator -
+
+			Source: https://cplusplus.com/reference/map/map/get_allocator/
+			-------------------------------------------------------------------------------- */
+			allocator_type							get_allocator() const
+				{return (_alloc);}
+
+		private:
+			/* --------------------------------------------------------------------------------
+			- Leaf of a key -
+				Descends from the root into the child after every separator not greater than k: that leaf holds k if it is in the container, and its lower and upper bounds unless they are past its last element.
+			-------------------------------------------------------------------------------- */
+			leaf_type*								_find_leaf(const key_type& k) const
+			{
+				node_type*	node = _root;
+
+				while (!node->is_leaf())
+				{
+					internal_type*	internal = static_cast<internal_type*>(node);
+
+					node = internal->get_child(internal->upper_index(k, _key_comp));
+				}
+
+				return (static_cast<leaf_type*>(node));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Iterator to a position -
+				The position past the last element of a leaf is the first element of the next leaf, or end() after the last leaf.
+			-------------------------------------------------------------------------------- */
+			static iterator							_make_iterator(leaf_type* leaf, size_type pos)
+			{
+				if (pos == leaf->get_count() && leaf->get_next())
+					return (iterator(leaf->get_next(), 0));
+
+				return (iterator(leaf, pos));
+			}
+
+			leaf_type*								_new_leaf()
+			{
+				leaf_type*	leaf = _leaf_alloc.allocate(1);
+
+				_leaf_alloc.construct(leaf, leaf_type(_alloc.allocate(_slots)));
+
+				return (leaf);
+			}
+
+			internal_type*							_new_internal()
+			{
+				internal_type*	node = _internal_alloc.allocate(1);
+
+				_internal_alloc.construct(node, internal_type());
+
+				return (node);
+			}
+
+			void									_delete(node_type* node)
+			{
+				if (node->is_leaf())
+				{
+					leaf_type*	leaf = static_cast<leaf_type*>(node);
+
+					_alloc.deallocate(leaf->get_values(), _slots);
+					_leaf_alloc.destroy(leaf);
+					_leaf_alloc.deallocate(leaf, 1);
+				}
+				else
+				{
+					internal_type*	internal = static_cast<internal_type*>(node);
+
+					_internal_alloc.destroy(internal);
+					_internal_alloc.deallocate(internal, 1);
+				}
+
+				return;
+			}
+
+			void									_destroy(node_type* node)
+			{
+				if (!node)
+					return;
+
+				if (node->is_leaf())
+				{
+					leaf_type*	leaf = static_cast<leaf_type*>(node);
+
+					for (size_type i = 0; i < leaf->get_count(); i++)
+						_alloc.destroy(leaf->get_values() + i);
+				}
+				else
+				{
+					internal_type*	internal = static_cast<internal_type*>(node);
+
+					for (size_type i = 0; i <= internal->get_count(); i++)
+						_destroy(internal->get_child(i));
+				}
+				_delete(node);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert in a leaf -
+				Inserts val at position pos of leaf (the map is empty when leaf is NULL) and splits the leaf if it is now full.
+				Returns an iterator to val, in whichever half it ended up.
+			-------------------------------------------------------------------------------- */
+			iterator								_insert_at(leaf_type* leaf, size_type pos, const value_type& val)
+			{
+				if (!leaf)
+				{
+					leaf = _new_leaf();
+					_root = leaf;
+					_first = leaf;
+					_last = leaf;
+				}
+
+				_leaf_insert(leaf, pos, val);
+				_size++;
+
+				if (leaf->get_count() < static_cast<size_type>(_slots))
+					return (iterator(leaf, pos));
+
+				leaf_type*	right = _split_leaf(leaf);
+
+				if (pos < leaf->get_count())
+					return (iterator(leaf, pos));
+
+				return (iterator(right, pos - leaf->get_count()));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Shift elements of a leaf -
+				The elements are copy constructed one slot further and the old copies destroyed, since the key of a value_type cannot be assigned.
+			-------------------------------------------------------------------------------- */
+			void									_leaf_insert(leaf_type* leaf, size_type pos, const value_type& val)
+			{
+				value_type*	values = leaf->get_values();
+				size_type	n = leaf->get_count();
+
+				for (size_type i = n; i > pos; i--)
+				{
+					_alloc.construct(values + i, values[i - 1]);
+					_alloc.destroy(values + i - 1);
+					leaf->get_key(i) = leaf->get_key(i - 1);
+				}
+				_alloc.construct(values + pos, val);
+				leaf->get_key(pos) = val.first;
+				leaf->set_count(n + 1);
+
+				return;
+			}
+
+			void									_leaf_erase(leaf_type* leaf, size_type pos)
+			{
+				value_type*	values = leaf->get_values();
+				size_type	n = leaf->get_count();
+
+				_alloc.destroy(values + pos);
+				for (size_type i = pos + 1; i < n; i++)
+				{
+					_alloc.construct(values + i - 1, values[i]);
+					_alloc.destroy(values + i);
+					leaf->get_key(i - 1) = leaf->get_key(i);
+				}
+				leaf->set_count(n - 1);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Split a leaf -
+				Moves the second half of a full leaf into a new leaf linked after it, and inserts the first key of the new leaf as a separator in the parent.
+			-------------------------------------------------------------------------------- */
+			leaf_type*								_split_leaf(leaf_type* leaf)
+			{
+				leaf_type*	right = _new_leaf();
+				size_type	half = _slots / 2;
+
+				for (size_type i = half; i < leaf->get_count(); i++)
+				{
+					_alloc.construct(right->get_values() + i - half, leaf->get_value(i));
+					_alloc.destroy(leaf->get_values() + i);
+					right->get_key(i - half) = leaf->get_key(i);
+				}
+				right->set_count(leaf->get_count() - half);
+				leaf->set_count(half);
+
+				right->set_next(leaf->get_next());
+				right->set_prev(leaf);
+				if (leaf->get_next())
+					leaf->get_next()->set_prev(right);
+				else
+					_last = right;
+				leaf->set_next(right);
+
+				_insert_separator(leaf, right->get_key(0), right);
+
+				return (right);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert a separator -
+				Inserts sep and right in the parent of left, just after left; a new root is created above left when it has no parent, and a parent that becomes full is split.
+			-------------------------------------------------------------------------------- */
+			void									_insert_separator(node_type* left, const key_type& sep, node_type* right)
+			{
+				internal_type*	parent = left->get_parent();
+
+				if (!parent)
+				{
+					parent = _new_internal();
+					parent->set_child(0, left);
+					parent->set_child(1, right);
+					parent->get_key(0) = sep;
+					parent->set_count(1);
+					_root = parent;
+					return;
+				}
+
+				size_type	n = parent->get_count();
+				size_type	i = parent->index_of(left);
+
+				for (size_type j = n; j > i; j--)
+				{
+					parent->get_key(j) = parent->get_key(j - 1);
+					parent->set_child(j + 1, parent->get_child(j));
+				}
+				parent->get_key(i) = sep;
+				parent->set_child(i + 1, right);
+				parent->set_count(n + 1);
+
+				if (n + 1 == static_cast<size_type>(_slots))
+					_split_internal(parent);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Split an internal node -
+				The middle key of a full node moves up to the parent, the keys and children after it to a new node.
+			-------------------------------------------------------------------------------- */
+			void									_split_internal(internal_type* node)
+			{
+				internal_type*	right = _new_internal();
+				size_type		mid = _slots / 2;
+				key_type		sep = node->get_key(mid);
+
+				for (size_type i = mid + 1; i < node->get_count(); i++)
+				{
+					right->get_key(i - mid - 1) = node->get_key(i);
+					right->set_child(i - mid - 1, node->get_child(i));
+				}
+				right->set_child(node->get_count() - mid - 1, node->get_child(node->get_count()));
+				right->set_count(node->get_count() - mid - 1);
+				node->set_count(mid);
+
+				_insert_separator(node, sep, right);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase and step -
+				Erases the element at position and returns an iterator to the element that followed it.
+				While no leaf is rebalanced, that element simply took the place of the erased one; otherwise its key is searched again.
+			-------------------------------------------------------------------------------- */
+			iterator								_erase(iterator position)
+			{
+				leaf_type*	leaf = position.base();
+				size_type	pos = position.position();
+
+				_leaf_erase(leaf, pos);
+				_size--;
+
+				if (leaf == _root && !leaf->get_count())
+				{
+					clear();
+					return (end());
+				}
+				if (leaf == _root || leaf->get_count() >= static_cast<size_type>(_min))
+					return (_make_iterator(leaf, pos));
+
+				iterator	next = _make_iterator(leaf, pos);
+
+				if (next == end())
+				{
+					_rebalance_leaf(leaf);
+					return (end());
+				}
+
+				key_type	k = next->first;
+
+				_rebalance_leaf(leaf);
+
+				return (lower_bound(k));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Rebalance a leaf -
+				A leaf with fewer than _min elements takes one from a sibling that has more than _min, and the separator between them is updated; otherwise it is merged with a sibling.
+			-------------------------------------------------------------------------------- */
+			void									_rebalance_leaf(leaf_type* leaf)
+			{
+				internal_type*	parent = leaf->get_parent();
+				size_type		i = parent->index_of(leaf);
+				leaf_type*		left = (i > 0 ? static_cast<leaf_type*>(parent->get_child(i - 1)) : NULL);
+				leaf_type*		right = (i < parent->get_count() ? static_cast<leaf_type*>(parent->get_child(i + 1)) : NULL);
+
+				if (left && left->get_count() > static_cast<size_type>(_min))
+				{
+					_leaf_insert(leaf, 0, left->get_value(left->get_count() - 1));
+					_leaf_erase(left, left->get_count() - 1);
+					parent->get_key(i - 1) = leaf->get_key(0);
+				}
+				else if (right && right->get_count() > static_cast<size_type>(_min))
+				{
+					_leaf_insert(leaf, leaf->get_count(), right->get_value(0));
+					_leaf_erase(right, 0);
+					parent->get_key(i) = right->get_key(0);
+				}
+				else if (left)
+					_merge_leaves(left, leaf, parent, i - 1);
+				else
+					_merge_leaves(leaf, right, parent, i);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Merge two leaves -
+				Appends the elements of right to left, unlinks and deletes right, and removes their separator from the parent.
+			-------------------------------------------------------------------------------- */
+			void									_merge_leaves(leaf_type* left, leaf_type* right, internal_type* parent, size_type sep)
+			{
+				size_type	n = left->get_count();
+
+				for (size_type i = 0; i < right->get_count(); i++)
+				{
+					_alloc.construct(left->get_values() + n + i, right->get_value(i));
+					_alloc.destroy(right->get_values() + i);
+					left->get_key(n + i) = right->get_key(i);
+				}
+				left->set_count(n + right->get_count());
+
+				left->set_next(right->get_next());
+				if (right->get_next())
+					right->get_next()->set_prev(left);
+				else
+					_last = left;
+				_delete(right);
+
+				_internal_erase(parent, sep);
+				_rebalance_internal(parent);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Remove a separator -
+				Removes key i and child i + 1 from node.
+			-------------------------------------------------------------------------------- */
+			void									_internal_erase(internal_type* node, size_type i)
+			{
+				size_type	n = node->get_count();
+
+				for (size_type j = i + 1; j < n; j++)
+				{
+					node->get_key(j - 1) = node->get_key(j);
+					node->set_child(j, node->get_child(j + 1));
+				}
+				node->set_count(n - 1);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Rebalance an internal node -
+				A root without keys is replaced by its only child. Below the root, a node with fewer than _min keys rotates a key through the parent from a sibling that has more than _min, or is merged with a sibling and their separator, which may leave the parent short in turn.
+			-------------------------------------------------------------------------------- */
+			void									_rebalance_internal(internal_type* node)
+			{
+				if (node == _root)
+				{
+					if (!node->get_count())
+					{
+						_root = node->get_child(0);
+						_root->set_parent(NULL);
+						_delete(node);
+					}
+					return;
+				}
+				if (node->get_count() >= static_cast<size_type>(_min))
+					return;
+
+				internal_type*	parent = node->get_parent();
+				size_type		i = parent->index_of(node);
+				internal_type*	left = (i > 0 ? static_cast<internal_type*>(parent->get_child(i - 1)) : NULL);
+				internal_type*	right = (i < parent->get_count() ? static_cast<internal_type*>(parent->get_child(i + 1)) : NULL);
+				size_type		n = node->get_count();
+
+				if (left && left->get_count() > static_cast<size_type>(_min))
+				{
+					size_type	ln = left->get_count();
+
+					node->set_child(n + 1, node->get_child(n));
+					for (size_type j = n; j > 0; j--)
+					{
+						node->get_key(j) = node->get_key(j - 1);
+						node->set_child(j, node->get_child(j - 1));
+					}
+					node->get_key(0) = parent->get_key(i - 1);
+					node->set_child(0, left->get_child(ln));
+					node->set_count(n + 1);
+					parent->get_key(i - 1) = left->get_key(ln - 1);
+					left->set_count(ln - 1);
+				}
+				else if (right && right->get_count() > static_cast<size_type>(_min))
+				{
+					node->get_key(n) = parent->get_key(i);
+					node->set_child(n + 1, right->get_child(0));
+					node->set_count(n + 1);
+					parent->get_key(i) = right->get_key(0);
+					right->set_child(0, right->get_child(1));
+					_internal_erase(right, 0);
+				}
+				else if (left)
+					_merge_internals(left, node, parent, i - 1);
+				else
+					_merge_internals(node, right, parent, i);
+
+				return;
+			}
+
+			void									_merge_internals(internal_type* left, internal_type* right, internal_type* parent, size_type sep)
+			{
+				size_type	n = left->get_count();
+
+				left->get_key(n) = parent->get_key(sep);
+				for (size_type i = 0; i < right->get_count(); i++)
+					left->get_key(n + 1 + i) = right->get_key(i);
+				for (size_type i = 0; i <= right->get_count(); i++)
+					left->set_child(n + 1 + i, right->get_child(i));
+				left->set_count(n + 1 + right->get_count());
+				_delete(right);
+
+				_internal_erase(parent, sep);
+				_rebalance_internal(parent);
+
+				return;
+			}
+	};
+
+
+	/* ----- NON-MEMBER OPERATOR OVERLOADS ----- */
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator==(const btree_map<Key, T, Compare, Alloc>& lhs, const btree_map<Key, T, Compare, Alloc>& rhs)
+		{return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator<(const btree_map<Key, T, Compare, Alloc>& lhs, const btree_map<Key, T, Compare, Alloc>& rhs)
+		{return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator!=(const btree_map<Key, T, Compare, Alloc>& lhs, const btree_map<Key, T, Compare, Alloc>& rhs)
+		{return (!(lhs == rhs));}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator>(const btree_map<Key, T, Compare, Alloc>& lhs, const btree_map<Key, T, Compare, Alloc>& rhs)
+		{return (rhs < lhs);}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator<=(const btree_map<Key, T, Compare, Alloc>& lhs, const btree_map<Key, T, Compare, Alloc>& rhs)
+		{return (!(rhs < lhs));}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator>=(const btree_map<Key, T, Compare, Alloc>& lhs, const btree_map<Key, T, Compare, Alloc>& rhs)
+		{return (!(lhs < rhs));}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	void	swap(btree_map<Key, T, Compare, Alloc>& x, btree_map<Key, T, Compare, Alloc>& y)
+	{
+		x.swap(y);
+		return;
+	}
+}
+
+#endif
@@ -0,0 +1,268 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_bounded_stack.hpp                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:02:11 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 10:02:11 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CONCURRENT_BOUNDED_STACK_HPP
+# define CONCURRENT_BOUNDED_STACK_HPP
+
+# include <cstddef>		// size_t
+# include <memory>		// std::allocator
+# include <sched.h>		// sched_yield
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Concurrent bounded stack -
+		Stack of at most a fixed number of elements, kept in one array allocated at construction, that any number of threads may push to and pop from at the same time: no allocation per element, and no node to reclaim.
+		A push or a pop first claims a slot by moving the top index with a compare-and-swap, then writes or reads the slot. Each slot has a state (empty, writing, full, reading) that orders the threads claiming it one after the other: a push waits for the slot to be empty, a pop for it to be full, which only happens if the thread that claimed it before is descheduled between the two steps.
+		push returns false when the stack is full, pop and top when it is empty.
+	-------------------------------------------------------------------------------- */
+	template<class T, class Alloc = std::allocator<T> >
+	class concurrent_bounded_stack
+	{
+		public:
+			typedef T													value_type;
+			typedef Alloc												allocator_type;
+			typedef size_t												size_type;
+
+		private:
+			typedef typename	Alloc::template rebind<int>::other		state_allocator;
+
+			/* _broken is left by a push whose copy threw, for the pop that claimed the slot to try again. */
+			enum								{_empty, _writing, _full, _reading, _broken};
+
+			value_type*			_slots;
+			int*				_states;
+			size_type			_capacity;
+			size_type			_top;
+			allocator_type		_alloc;
+			state_allocator		_state_alloc;
+
+			concurrent_bounded_stack(const concurrent_bounded_stack&);
+			concurrent_bounded_stack&	operator=(const concurrent_bounded_stack&);
+
+		public:
+			/* ----- CONSTRUCTOR AND DESTRUCTOR ----- */
+
+			explicit concurrent_bounded_stack(size_type capacity) : _slots(NULL), _states(NULL), _capacity(capacity), _top(0), _alloc(), _state_alloc()
+			{
+				_slots = _alloc.allocate(capacity);
+				try
+				{
+					_states = _state_alloc.allocate(capacity);
+				}
+				catch (...)
+				{
+					_alloc.deallocate(_slots, capacity);
+					throw;
+				}
+				for (size_type i = 0; i < capacity; i++)
+					_states[i] = _empty;
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Destructor -
+				No other thread may still use the stack.
+			-------------------------------------------------------------------------------- */
+			~concurrent_bounded_stack()
+			{
+				for (size_type i = 0; i < _capacity; i++)
+				{
+					if (_states[i] == _full)
+						_alloc.destroy(_slots + i);
+				}
+				_state_alloc.deallocate(_states, _capacity);
+				_alloc.deallocate(_slots, _capacity);
+
+				return;
+			}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			bool					empty() const
+				{return (!size());}
+
+			/* --------------------------------------------------------------------------------
+			- Return size -
+				Counts the claimed slots, some of which may still be being written.
+			-------------------------------------------------------------------------------- */
+			size_type				size() const
+				{return (__atomic_load_n(&_top, __ATOMIC_ACQUIRE));}
+
+			size_type				capacity() const
+				{return (_capacity);}
+
+			/* --------------------------------------------------------------------------------
+			- Access next element -
+				Copies the top element into val and returns true, or returns false if the stack is empty; takes the top slot from full to reading and back, so that no pop empties it meanwhile.
+			-------------------------------------------------------------------------------- */
+			bool					top(value_type& val) const
+			{
+				while (true)
+				{
+					size_type	i = size();
+
+					if (!i)
+						return (false);
+					if (_claim(i - 1, _full, _reading))
+					{
+						try
+						{
+							val = _slots[i - 1];
+						}
+						catch (...)
+						{
+							_set(i - 1, _full);
+							throw;
+						}
+						_set(i - 1, _full);
+
+						return (true);
+					}
+					sched_yield();
+				}
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert element -
+				Returns false, leaving the stack unchanged, if it is full.
+			-------------------------------------------------------------------------------- */
+			bool					push(const value_type& val)
+			{
+				size_type	i = size();
+
+				do
+				{
+					if (i == _capacity)
+						return (false);
+				}
+				while (!__atomic_compare_exchange_n(&_top, &i, i + 1, true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+
+				_wait(i, _empty, _empty, _writing);
+				try
+				{
+					_alloc.construct(_slots + i, val);
+				}
+				catch (...)
+				{
+					_set(i, _broken);
+					throw;
+				}
+				_set(i, _full);
+
+				return (true);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Remove top element -
+				Moves the top element into val and returns true, or returns false if the stack is empty.
+				If copying the element throws, it is lost.
+			-------------------------------------------------------------------------------- */
+			bool					pop(value_type& val)
+			{
+				size_type	i;
+
+				while ((i = _claim_top()))
+				{
+					if (_wait(i - 1, _full, _broken, _reading) == _broken)
+					{
+						_set(i - 1, _empty);
+						continue;
+					}
+					try
+					{
+						val = _slots[i - 1];
+					}
+					catch (...)
+					{
+						_alloc.destroy(_slots + i - 1);
+						_set(i - 1, _empty);
+						throw;
+					}
+					_alloc.destroy(_slots + i - 1);
+					_set(i - 1, _empty);
+
+					return (true);
+				}
+
+				return (false);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Remove top element -
+				Drops the top element and returns true, or returns false if the stack is empty.
+			-------------------------------------------------------------------------------- */
+			bool					pop()
+			{
+				size_type	i;
+
+				while ((i = _claim_top()))
+				{
+					if (_wait(i - 1, _full, _broken, _reading) == _broken)
+					{
+						_set(i - 1, _empty);
+						continue;
+					}
+					_alloc.destroy(_slots + i - 1);
+					_set(i - 1, _empty);
+
+					return (true);
+				}
+
+				return (false);
+			}
+
+		private:
+			/* --------------------------------------------------------------------------------
+			- Claim top slot -
+				Moves the top index down and returns its previous value, or returns 0 if the stack is empty.
+			-------------------------------------------------------------------------------- */
+			size_type				_claim_top()
+			{
+				size_type	i = size();
+
+				while (i && !__atomic_compare_exchange_n(&_top, &i, i - 1, true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+					;
+
+				return (i);
+			}
+
+			bool					_claim(size_type i, int from, int to) const
+				{return (__atomic_compare_exchange_n(&_states[i], &from, to, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED));}
+
+			void					_set(size_type i, int state) const
+			{
+				__atomic_store_n(&_states[i], state, __ATOMIC_RELEASE);
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Wait for slot -
+				Yields until slot i is in state first or second, moves it to state to, and returns the state it was in.
+			-------------------------------------------------------------------------------- */
+			int						_wait(size_type i, int first, int second, int to) const
+			{
+				while (true)
+				{
+					if (_claim(i, first, to))
+						return (first);
+					if (second != first && _claim(i, second, to))
+						return (second);
+					sched_yield();
+				}
+			}
+	};
+}
+
+#endif
@@ -0,0 +1,341 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_map.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:40:11 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 09:40:11 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CONCURRENT_MAP_HPP
+# define CONCURRENT_MAP_HPP
+
+# include <cstddef>		// size_t
+# include <functional>	// std::less
+# include <memory>		// std::allocator
+# include <pthread.h>	// pthread_mutex_t
+
+# include "vector.hpp"
+# include "../Others/epoch.hpp"
+# include "../Others/pair.hpp"
+# include "../Others/persistent_tree.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Concurrent map -
+		Map for many reading threads and few writes: reads take no lock and never wait, writes are serialized by a mutex.
+		Each write builds a new version of the tree by path copying (see persistent_tree), which shares everything but the copied path with the current version, then publishes its root with a single pointer store. A reader takes a snapshot, which pins the version published at that time: it sees neither partial writes nor later ones, for as long as it keeps it.
+		The nodes a write replaces are retired and freed by a later write once no snapshot can reach them anymore (see epoch_domain), so that a write costs O(log n) allocations and a reader only the claim and the release of an epoch slot.
+		Not copyable, since the mutex and the readers are not.
+	-------------------------------------------------------------------------------- */
+	template<class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<pair<const Key, T> > >
+	class concurrent_map
+	{
+		public:
+			typedef				Key											key_type;
+			typedef				T											mapped_type;
+			typedef				pair<const key_type, mapped_type>			value_type;
+			typedef				Compare										key_compare;
+			typedef				Alloc										allocator_type;
+			typedef typename	allocator_type::const_reference				const_reference;
+			typedef typename	allocator_type::const_pointer				const_pointer;
+			typedef				size_t										size_type;
+
+		private:
+			typedef				persistent_tree<Key, T, Compare, Alloc>		tree_type;
+			typedef typename	tree_type::node_type						node_type;
+			typedef				epoch_domain::epoch_type					epoch_type;
+
+			struct	_retired_node
+			{
+				node_type*	node;
+				epoch_type	epoch;
+			};
+
+			tree_type					_tree;
+			node_type*					_root;
+			vector<_retired_node>		_retired;
+			pthread_mutex_t				_mutex;
+			mutable epoch_domain		_epochs;
+			key_compare					_comp;
+
+			concurrent_map(const concurrent_map&);
+			concurrent_map&				operator=(const concurrent_map&);
+
+		public:
+			/* --------------------------------------------------------------------------------
+			- Snapshot -
+				Pins the version of the map published when it is created, until it is destroyed: any number of threads may take snapshots at the same time as a write.
+				Keep it short-lived: the nodes replaced since are not freed while it lives.
+			-------------------------------------------------------------------------------- */
+			class snapshot
+			{
+				private:
+					const concurrent_map&	_map;
+					size_type				_slot;
+					const node_type*		_root;
+
+					snapshot(const snapshot&);
+					snapshot&				operator=(const snapshot&);
+
+				public:
+					explicit snapshot(const concurrent_map& m) : _map(m), _slot(m._epochs.enter()), _root(__atomic_load_n(&m._root, __ATOMIC_SEQ_CST))
+						{return;}
+
+					~snapshot()
+					{
+						_map._epochs.leave(_slot);
+						return;
+					}
+
+					bool					empty() const
+						{return (!_root);}
+
+					size_type				size() const
+						{return (tree_type::size(_root));}
+
+					/* --------------------------------------------------------------------------------
+					- Get element -
+						Returns a pointer to the element with key k in this version, valid as long as the snapshot, or NULL if there is none.
+					-------------------------------------------------------------------------------- */
+					const_pointer			find(const key_type& k) const
+					{
+						const node_type*	n = _map._tree.find(_root, k);
+
+						return (n ? &n->value : NULL);
+					}
+
+					size_type				count(const key_type& k) const
+						{return (find(k) != NULL);}
+
+					/* --------------------------------------------------------------------------------
+					- Apply function to elements -
+						Calls f on every element of this version in sorted order and returns it.
+					-------------------------------------------------------------------------------- */
+					template<class Function>
+					Function				for_each(Function f) const
+						{return (_for_each(_root, f));}
+
+				private:
+					template<class Function>
+					static Function			_for_each(const node_type* n, Function f)
+					{
+						for (; n; n = n->right)
+						{
+							f = _for_each(n->left, f);
+							f(n->value);
+						}
+
+						return (f);
+					}
+			};
+
+
+			/* ----- CONSTRUCTORS AND DESTRUCTOR ----- */
+
+			explicit concurrent_map(const key_compare& comp = key_compare()) : _tree(comp), _root(NULL), _retired(), _mutex(), _epochs(), _comp(comp)
+			{
+				pthread_mutex_init(&_mutex, NULL);
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Destructor -
+				No snapshot may outlive the map.
+			-------------------------------------------------------------------------------- */
+			~concurrent_map()
+			{
+				for (size_type i = 0; i < _retired.size(); i++)
+					_tree.free_node(_retired[i].node);
+				_tree.destroy(_root);
+				pthread_mutex_destroy(&_mutex);
+
+				return;
+			}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			/* --- Capacity --- */
+
+			bool						empty() const
+				{return (!size());}
+
+			size_type					size() const
+				{return (snapshot(*this).size());}
+
+
+			/* --- Lookup --- */
+
+			/* --------------------------------------------------------------------------------
+			- Get element -
+				Copies the value mapped to k into obj, and returns false, leaving obj unchanged, if there is no such element.
+			-------------------------------------------------------------------------------- */
+			bool						get(const key_type& k, mapped_type& obj) const
+			{
+				snapshot		s(*this);
+				const_pointer	p = s.find(k);
+
+				if (!p)
+					return (false);
+				obj = p->second;
+
+				return (true);
+			}
+
+			size_type					count(const key_type& k) const
+				{return (snapshot(*this).count(k));}
+
+
+			/* --- Modifiers --- */
+
+			/* --------------------------------------------------------------------------------
+			- Insert element -
+				Inserts val unless there is already an element with an equivalent key, and returns whether it did.
+			-------------------------------------------------------------------------------- */
+			bool						insert(const value_type& val)
+				{return (_insert(val, false));}
+
+			/* --------------------------------------------------------------------------------
+			- Insert or assign element -
+				Inserts (k, obj), or maps obj to k if there is already an element with key k, and returns whether it inserted.
+			-------------------------------------------------------------------------------- */
+			bool						insert_or_assign(const key_type& k, const mapped_type& obj)
+				{return (_insert(value_type(k, obj), true));}
+
+			/* --------------------------------------------------------------------------------
+			- Erase element -
+				Returns the number of elements erased, 0 or 1.
+			-------------------------------------------------------------------------------- */
+			size_type					erase(const key_type& k)
+			{
+				bool	erased = false;
+
+				pthread_mutex_lock(&_mutex);
+				try
+				{
+					_tree.begin_write();
+					_publish(_tree.erase(_root, k, erased));
+				}
+				catch (...)
+				{
+					_tree.abort_write();
+					pthread_mutex_unlock(&_mutex);
+					throw;
+				}
+				pthread_mutex_unlock(&_mutex);
+
+				return (erased);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Clear content -
+				Publishes an empty version: the current elements are freed once the snapshots taken before are gone.
+			-------------------------------------------------------------------------------- */
+			void						clear()
+			{
+				pthread_mutex_lock(&_mutex);
+				try
+				{
+					_tree.begin_write();
+					_tree.retire_all(_root);
+					_publish(NULL);
+				}
+				catch (...)
+				{
+					_tree.abort_write();
+					pthread_mutex_unlock(&_mutex);
+					throw;
+				}
+				pthread_mutex_unlock(&_mutex);
+
+				return;
+			}
+
+
+			/* --- Observers --- */
+
+			key_compare					key_comp() const
+				{return (_comp);}
+
+		private:
+			bool						_insert(const value_type& val, bool replace)
+			{
+				bool	inserted = false;
+
+				pthread_mutex_lock(&_mutex);
+				try
+				{
+					_tree.begin_write();
+					_publish(_tree.insert(_root, val, replace, inserted));
+				}
+				catch (...)
+				{
+					_tree.abort_write();
+					pthread_mutex_unlock(&_mutex);
+					throw;
+				}
+				pthread_mutex_unlock(&_mutex);
+
+				return (inserted);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Publish version -
+				Makes root the current version, once all its nodes are written, then tags the nodes it replaced with the epoch that ends there and frees the nodes no reader can reach anymore.
+				Called with the mutex held; throws before publishing or not at all, the retired list having room for the new nodes.
+			-------------------------------------------------------------------------------- */
+			void						_publish(node_type* root)
+			{
+				vector<node_type*>&	replaced = _tree.retired();
+
+				if (root == _root && replaced.empty())
+					return;
+				_retired.reserve(_retired.size() + replaced.size());
+
+				__atomic_store_n(&_root, root, __ATOMIC_SEQ_CST);
+
+				epoch_type	epoch = _epochs.advance();
+
+				for (size_type i = 0; i < replaced.size(); i++)
+				{
+					_retired_node	r;
+
+					r.node = replaced[i];
+					r.epoch = epoch;
+					_retired.push_back(r);
+				}
+				replaced.clear();
+				_reclaim();
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Reclaim nodes -
+				Frees the retired nodes older than every active snapshot, keeping the others in order.
+			-------------------------------------------------------------------------------- */
+			void						_reclaim()
+			{
+				epoch_type	safe = _epochs.safe();
+				size_type	kept = 0;
+
+				for (size_type i = 0; i < _retired.size(); i++)
+				{
+					if (_retired[i].epoch < safe)
+						_tree.free_node(_retired[i].node);
+					else
+						_retired[kept++] = _retired[i];
+				}
+				_retired.resize(kept);
+
+				return;
+			}
+	};
+}
+
+#endif
@@ -0,0 +1,483 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_skiplist_map.hpp                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:58:53 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 10:03:29 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CONCURRENT_SKIPLIST_MAP_HPP
+# define CONCURRENT_SKIPLIST_MAP_HPP
+
+# include <cstddef>		// size_t
+# include <functional>	// std::less
+# include <memory>		// std::allocator
+
+# include "../Iterators/skiplist_iterator.hpp"
+# include "../Others/epoch.hpp"
+# include "../Others/hash.hpp"
+# include "../Others/pair.hpp"
+# include "../Others/skiplist_node.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Concurrent skiplist map -
+		Ordered map that any number of threads may search, insert into and erase from at the same time, without any lock: every change is a compare-and-swap on a single link, after which other threads help finish it rather than wait for it.
+		An element is a node linked at level 0 and at the levels above up to its random height (each level holding about a quarter of the nodes of the one below), so a search skips most of the elements, as in a balanced tree.
+		An insertion links the node at level 0 first, which makes it visible, then at the levels above. An erasure marks the links of the node from the top down, the mark on level 0 deciding which of several erasures wins, then unlinks it at every level; any search that meets a marked node unlinks it on the way.
+		The unlinked nodes are freed once no thread can still be reading them (see epoch_domain). The lookups that return iterators (begin, find, lower_bound, upper_bound) leave that to the caller: hold a guard for as long as the iterators are used.
+	-------------------------------------------------------------------------------- */
+	template<class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<pair<const Key, T> > >
+	class concurrent_skiplist_map
+	{
+		public:
+			typedef				Key													key_type;
+			typedef				T													mapped_type;
+			typedef				pair<const key_type, mapped_type>					value_type;
+			typedef				Compare												key_compare;
+			typedef				Alloc												allocator_type;
+			typedef typename	allocator_type::const_reference						reference;
+			typedef typename	allocator_type::const_reference						const_reference;
+			typedef typename	allocator_type::const_pointer						pointer;
+			typedef typename	allocator_type::const_pointer						const_pointer;
+			typedef				skiplist_node<value_type>							node_type;
+			typedef				skiplist_iterator<node_type, const value_type>		iterator;
+			typedef				skiplist_iterator<node_type, const value_type>		const_iterator;
+			typedef typename	iterator_traits<iterator>::difference_type			difference_type;
+			typedef				size_t												size_type;
+
+		private:
+			typedef typename	Alloc::template rebind<char>::other					byte_allocator;
+
+			/* Enough levels for 4^16 elements. */
+			enum																	{_levels = 16};
+
+			node_type*					_head;
+			size_type					_size;
+			size_type					_seed;
+			retired_list<node_type>		_retired;
+			mutable epoch_domain		_epochs;
+			key_compare				_comp;
+			allocator_type			_alloc;
+			byte_allocator			_byte_alloc;
+
+			concurrent_skiplist_map(const concurrent_skiplist_map&);
+			concurrent_skiplist_map&	operator=(const concurrent_skiplist_map&);
+
+		public:
+			/* --------------------------------------------------------------------------------
+			- Guard -
+				Pins the current epoch while it lives: the nodes reachable from the iterators obtained meanwhile are not freed before it is destroyed.
+			-------------------------------------------------------------------------------- */
+			class guard
+			{
+				private:
+					epoch_domain&	_epochs;
+					size_t			_slot;
+
+					guard(const guard&);
+					guard&			operator=(const guard&);
+
+				public:
+					explicit guard(const concurrent_skiplist_map& m) : _epochs(m._epochs), _slot(m._epochs.enter())
+						{return;}
+
+					~guard()
+					{
+						_epochs.leave(_slot);
+						return;
+					}
+			};
+
+
+			/* ----- CONSTRUCTORS AND DESTRUCTOR ----- */
+
+			explicit concurrent_skiplist_map(const key_compare& comp = key_compare()) : _head(NULL), _size(0), _seed(0), _retired(), _epochs(), _comp(comp), _alloc(), _byte_alloc()
+			{
+				_head = reinterpret_cast<node_type*>(_byte_alloc.allocate(node_type::bytes(_levels)));
+				_head->height = _levels;
+				for (int l = 0; l < _levels; l++)
+					_head->next[l] = NULL;
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Destructor -
+				No other thread may still use the map.
+			-------------------------------------------------------------------------------- */
+			~concurrent_skiplist_map()
+			{
+				node_type*	n = node_type::unmarked(_head->next[0]);
+
+				while (n)
+				{
+					node_type*	next = node_type::unmarked(n->next[0]);
+
+					_free_node(n);
+					n = next;
+				}
+				_free_list(_retired.release_all());
+				_byte_alloc.deallocate(reinterpret_cast<char*>(_head), node_type::bytes(_levels));
+
+				return;
+			}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			/* --- Iterators --- */
+
+			const_iterator					begin() const
+				{return (const_iterator(_head->successor()));}
+
+			const_iterator					end() const
+				{return (const_iterator());}
+
+
+			/* --- Capacity --- */
+
+			bool							empty() const
+				{return (!size());}
+
+			/* --------------------------------------------------------------------------------
+			- Size -
+				Exact when no other thread is changing the map.
+			-------------------------------------------------------------------------------- */
+			size_type						size() const
+				{return (__atomic_load_n(&_size, __ATOMIC_RELAXED));}
+
+
+			/* --- Modifiers --- */
+
+			/* --------------------------------------------------------------------------------
+			- Insert element -
+				Inserts val unless there is already an element with an equivalent key, and returns whether it did.
+				The node is linked at level 0 by a compare-and-swap on the link of its predecessor, which fails, and the search starts over, if another thread changed that link meanwhile.
+			-------------------------------------------------------------------------------- */
+			bool							insert(const value_type& val)
+			{
+				guard		g(*this);
+				node_type*	preds[_levels];
+				node_type*	succs[_levels];
+				node_type*	n = NULL;
+
+				while (true)
+				{
+					if (_find(val.first, preds, succs))
+					{
+						if (n)
+							_free_node(n);
+						return (false);
+					}
+					if (!n)
+						n = _new_node(val, _random_height());
+					for (int l = 0; l < n->height; l++)
+						n->next[l] = succs[l];
+					if (preds[0]->exchange(0, succs[0], n))
+						break;
+				}
+				__atomic_add_fetch(&_size, 1, __ATOMIC_RELAXED);
+				_link_upper_levels(n, preds, succs);
+
+				return (true);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase element -
+				Returns the number of elements erased, 0 or 1: of several threads erasing the same element, only the one whose mark lands on level 0 erases it.
+			-------------------------------------------------------------------------------- */
+			size_type						erase(const key_type& k)
+			{
+				guard		g(*this);
+				node_type*	preds[_levels];
+				node_type*	succs[_levels];
+
+				if (!_find(k, preds, succs))
+					return (0);
+
+				node_type*	victim = succs[0];
+
+				for (int l = victim->height - 1; l > 0; l--)
+				{
+					node_type*	next = victim->load(l);
+
+					while (!node_type::is_marked(next))
+					{
+						victim->exchange(l, next, node_type::marked(next));
+						next = victim->load(l);
+					}
+				}
+				for (node_type* next = victim->load(0); true; next = victim->load(0))
+				{
+					if (node_type::is_marked(next))
+						return (0);
+					if (victim->exchange(0, next, node_type::marked(next)))
+						break;
+				}
+				__atomic_sub_fetch(&_size, 1, __ATOMIC_RELAXED);
+				_find(k, preds, succs);
+				_release(victim);
+
+				return (1);
+			}
+
+
+			/* --- Observers --- */
+
+			key_compare						key_comp() const
+				{return (_comp);}
+
+
+			/* --- Operations --- */
+
+			/* --------------------------------------------------------------------------------
+			- Get element -
+				Copies the value mapped to k into obj, and returns false, leaving obj unchanged, if there is no such element.
+			-------------------------------------------------------------------------------- */
+			bool							get(const key_type& k, mapped_type& obj) const
+			{
+				guard			g(*this);
+				const_iterator	it = find(k);
+
+				if (it == end())
+					return (false);
+				obj = it->second;
+
+				return (true);
+			}
+
+			size_type						count(const key_type& k) const
+			{
+				guard	g(*this);
+
+				return (find(k) != end());
+			}
+
+			const_iterator					find(const key_type& k) const
+			{
+				node_type*	n = _search(k, false);
+
+				if (n && _comp(k, n->value.first))
+					return (end());
+
+				return (const_iterator(n));
+			}
+
+			const_iterator					lower_bound(const key_type& k) const
+				{return (const_iterator(_search(k, false)));}
+
+			const_iterator					upper_bound(const key_type& k) const
+				{return (const_iterator(_search(k, true)));}
+
+			pair<const_iterator, const_iterator>	equal_range(const key_type& k) const
+				{return (ft::make_pair(lower_bound(k), upper_bound(k)));}
+
+		private:
+			/* --------------------------------------------------------------------------------
+			- Find -
+				Fills preds and succs with the last node before k and the first node not before k at every level, unlinking the deleted nodes it meets, and returns whether succs[0] has key k.
+				Unlinking a node is a compare-and-swap on the link of its predecessor; if it fails, the predecessor was deleted or changed meanwhile and the search starts over from the top.
+			-------------------------------------------------------------------------------- */
+			bool							_find(const key_type& k, node_type** preds, node_type** succs)
+			{
+				while (!_try_find(k, preds, succs))
+					;
+
+				return (succs[0] && !_comp(k, succs[0]->value.first));
+			}
+
+			bool							_try_find(const key_type& k, node_type** preds, node_type** succs)
+			{
+				node_type*	pred = _head;
+
+				for (int l = _levels - 1; l >= 0; l--)
+				{
+					node_type*	curr = node_type::unmarked(pred->load(l));
+
+					while (curr)
+					{
+						node_type*	succ = curr->load(l);
+
+						if (node_type::is_marked(succ))
+						{
+							if (!pred->exchange(l, curr, node_type::unmarked(succ)))
+								return (false);
+							curr = node_type::unmarked(succ);
+						}
+						else if (_comp(curr->value.first, k))
+						{
+							pred = curr;
+							curr = succ;
+						}
+						else
+							break;
+					}
+					preds[l] = pred;
+					succs[l] = curr;
+				}
+
+				return (true);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Search -
+				Returns the first node not deleted whose key is not less than k (greater than k if upper), or NULL; read-only, passing over the deleted nodes instead of unlinking them.
+			-------------------------------------------------------------------------------- */
+			node_type*						_search(const key_type& k, bool upper) const
+			{
+				node_type*	pred = _head;
+				node_type*	curr = NULL;
+
+				for (int l = _levels - 1; l >= 0; l--)
+				{
+					curr = node_type::unmarked(pred->load(l));
+					while (curr)
+					{
+						node_type*	succ = curr->load(l);
+
+						if (node_type::is_marked(succ))
+							curr = node_type::unmarked(succ);
+						else if (upper ? !_comp(k, curr->value.first) : _comp(curr->value.first, k))
+						{
+							pred = curr;
+							curr = succ;
+						}
+						else
+							break;
+					}
+				}
+				while (curr && node_type::is_marked(curr->load(0)))
+					curr = curr->successor();
+
+				return (curr);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Link upper levels -
+				Links n, already linked at level 0, at levels 1 to its height, from the bottom up. Before each link, the link of n itself is pointed to the successor: if it is marked, n is being erased and linking stops.
+				Then, as n may have been marked right after being linked somewhere, searches for it once more to unlink it, before handing it over to the eraser.
+			-------------------------------------------------------------------------------- */
+			void							_link_upper_levels(node_type* n, node_type** preds, node_type** succs)
+			{
+				bool	deleted = false;
+
+				for (int l = 1; l < n->height && !deleted; l++)
+				{
+					while (true)
+					{
+						node_type*	next = n->load(l);
+
+						if (node_type::is_marked(next))
+						{
+							deleted = true;
+							break;
+						}
+						if (next != succs[l] && !n->exchange(l, next, succs[l]))
+							continue;
+						if (preds[l]->exchange(l, succs[l], n))
+							break;
+						if (!_find(n->value.first, preds, succs) || succs[0] != n)
+						{
+							deleted = true;
+							break;
+						}
+					}
+				}
+				if (node_type::is_marked(n->load(0)))
+					_find(n->value.first, preds, succs);
+				_release(n);
+
+				return;
+			}
+
+			int								_random_height()
+			{
+				size_type	bits = hash_mix(__atomic_add_fetch(&_seed, 1, __ATOMIC_RELAXED));
+				int			height = 1;
+
+				for (; height < _levels && !(bits & 3); bits >>= 2)
+					height++;
+
+				return (height);
+			}
+
+			node_type*						_new_node(const value_type& val, int height)
+			{
+				node_type*	n = reinterpret_cast<node_type*>(_byte_alloc.allocate(node_type::bytes(height)));
+
+				try
+				{
+					_alloc.construct(&n->value, val);
+				}
+				catch (...)
+				{
+					_byte_alloc.deallocate(reinterpret_cast<char*>(n), node_type::bytes(height));
+					throw;
+				}
+				n->retired_next = NULL;
+				n->epoch = 0;
+				n->pending = 2;
+				n->height = height;
+
+				return (n);
+			}
+
+			void							_free_node(node_type* n)
+			{
+				int	height = n->height;
+
+				_alloc.destroy(&n->value);
+				_byte_alloc.deallocate(reinterpret_cast<char*>(n), node_type::bytes(height));
+
+				return;
+			}
+
+			void							_free_list(node_type* n)
+			{
+				while (n)
+				{
+					node_type*	next = n->retired_next;
+
+					_free_node(n);
+					n = next;
+				}
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Release node -
+				Called by the inserter and by the eraser of n once each is done with it; the last one retires it, n being unlinked everywhere by then.
+			-------------------------------------------------------------------------------- */
+			void							_release(node_type* n)
+			{
+				if (!__atomic_sub_fetch(&n->pending, 1, __ATOMIC_ACQ_REL))
+					_retire(n);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Retire node -
+				Tags n with the epoch it became unreachable in; every retired_list::period nodes, starts a new epoch and frees the nodes no thread can be reading anymore.
+			-------------------------------------------------------------------------------- */
+			void							_retire(node_type* n)
+			{
+				if (_retired.push(n, _epochs.current()))
+				{
+					_epochs.advance();
+					_free_list(_retired.collect(_epochs.safe()));
+				}
+
+				return;
+			}
+	};
+}
+
+#endif
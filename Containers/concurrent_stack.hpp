@@ -0,0 +1,234 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_stack.hpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:01:53 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 10:01:53 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CONCURRENT_STACK_HPP
+# define CONCURRENT_STACK_HPP
+
+# include <cstddef>		// size_t
+# include <memory>		// std::allocator
+
+# include "../Others/epoch.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Concurrent stack -
+		Unbounded stack that any number of threads may push to and pop from at the same time without a lock (Treiber stack): the top is a single pointer, which push and pop move with a compare-and-swap, retrying if another thread moved it first.
+		The classic flaw of the Treiber stack is ABA: a pop reads the top node A and its successor B, another thread pops A and B and pushes A again, recycled, and the first pop's compare-and-swap succeeds, setting the top to the freed B. Here a popped node is only freed once no pop that could have read it is still running (see epoch_domain), so its address cannot come back while a compare-and-swap may still expect it.
+		pop and top copy the element out, since another thread may pop it right after.
+	-------------------------------------------------------------------------------- */
+	template<class T, class Alloc = std::allocator<T> >
+	class concurrent_stack
+	{
+		public:
+			typedef T													value_type;
+			typedef Alloc												allocator_type;
+			typedef size_t												size_type;
+
+		private:
+			struct	_node
+			{
+				value_type		value;
+				_node*			next;
+				_node*			retired_next;
+				unsigned long	epoch;
+
+				explicit _node(const value_type& val) : value(val), next(NULL), retired_next(NULL), epoch(0)
+					{return;}
+			};
+
+			typedef typename	Alloc::template rebind<_node>::other	node_allocator;
+
+			_node*					_top;
+			size_type				_size;
+			retired_list<_node>		_retired;
+			mutable epoch_domain	_epochs;
+			node_allocator			_alloc;
+
+			concurrent_stack(const concurrent_stack&);
+			concurrent_stack&		operator=(const concurrent_stack&);
+
+		public:
+			/* ----- CONSTRUCTOR AND DESTRUCTOR ----- */
+
+			concurrent_stack() : _top(NULL), _size(0), _retired(), _epochs(), _alloc()
+				{return;}
+
+			/* --------------------------------------------------------------------------------
+			- Destructor -
+				No other thread may still use the stack.
+			-------------------------------------------------------------------------------- */
+			~concurrent_stack()
+			{
+				_free_list(_top, false);
+				_free_list(_retired.release_all(), true);
+
+				return;
+			}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			/* --------------------------------------------------------------------------------
+			- Test whether stack is empty -
+			-------------------------------------------------------------------------------- */
+			bool					empty() const
+				{return (!__atomic_load_n(&_top, __ATOMIC_ACQUIRE));}
+
+			/* --------------------------------------------------------------------------------
+			- Return size -
+				Exact when no other thread is changing the stack.
+			-------------------------------------------------------------------------------- */
+			size_type				size() const
+				{return (__atomic_load_n(&_size, __ATOMIC_RELAXED));}
+
+			/* --------------------------------------------------------------------------------
+			- Access next element -
+				Copies the top element into val and returns true, or returns false if the stack is empty.
+			-------------------------------------------------------------------------------- */
+			bool					top(value_type& val) const
+			{
+				size_t	slot = _epochs.enter();
+				_node*	n = __atomic_load_n(&_top, __ATOMIC_ACQUIRE);
+
+				try
+				{
+					if (n)
+						val = n->value;
+				}
+				catch (...)
+				{
+					_epochs.leave(slot);
+					throw;
+				}
+				_epochs.leave(slot);
+
+				return (n != NULL);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert element -
+				Does not read any other node, so needs no epoch.
+			-------------------------------------------------------------------------------- */
+			void					push(const value_type& val)
+			{
+				_node*	n = _alloc.allocate(1);
+
+				try
+				{
+					_alloc.construct(n, _node(val));
+				}
+				catch (...)
+				{
+					_alloc.deallocate(n, 1);
+					throw;
+				}
+				n->next = __atomic_load_n(&_top, __ATOMIC_RELAXED);
+				while (!__atomic_compare_exchange_n(&_top, &n->next, n, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+					;
+				__atomic_add_fetch(&_size, 1, __ATOMIC_RELAXED);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Remove top element -
+				Moves the top element into val and returns true, or returns false if the stack is empty.
+				If copying the element throws, it is lost.
+			-------------------------------------------------------------------------------- */
+			bool					pop(value_type& val)
+			{
+				size_t	slot = _epochs.enter();
+				_node*	n = _unlink();
+
+				if (!n)
+				{
+					_epochs.leave(slot);
+					return (false);
+				}
+				try
+				{
+					val = n->value;
+				}
+				catch (...)
+				{
+					_epochs.leave(slot);
+					_retire(n);
+					throw;
+				}
+				_epochs.leave(slot);
+				_retire(n);
+
+				return (true);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Remove top element -
+				Drops the top element and returns true, or returns false if the stack is empty.
+			-------------------------------------------------------------------------------- */
+			bool					pop()
+			{
+				size_t	slot = _epochs.enter();
+				_node*	n = _unlink();
+
+				_epochs.leave(slot);
+				if (n)
+					_retire(n);
+
+				return (n != NULL);
+			}
+
+		private:
+			_node*					_unlink()
+			{
+				_node*	n = __atomic_load_n(&_top, __ATOMIC_ACQUIRE);
+
+				while (n && !__atomic_compare_exchange_n(&_top, &n, n->next, true, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE))
+					;
+				if (n)
+					__atomic_sub_fetch(&_size, 1, __ATOMIC_RELAXED);
+
+				return (n);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Retire node -
+				Tags n with the epoch it was popped in; every retired_list::period nodes, starts a new epoch and frees the nodes no pop can be reading anymore.
+			-------------------------------------------------------------------------------- */
+			void					_retire(_node* n)
+			{
+				if (_retired.push(n, _epochs.current()))
+				{
+					_epochs.advance();
+					_free_list(_retired.collect(_epochs.safe()), true);
+				}
+
+				return;
+			}
+
+			void					_free_list(_node* n, bool retired)
+			{
+				while (n)
+				{
+					_node*	next = (retired ? n->retired_next : n->next);
+
+					_alloc.destroy(n);
+					_alloc.deallocate(n, 1);
+					n = next;
+				}
+
+				return;
+			}
+	};
+}
+
+#endif
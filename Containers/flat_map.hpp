@@ -0,0 +1,663 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flat_map.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:18:35 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 09:18:35 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FLAT_MAP_HPP
+# define FLAT_MAP_HPP
+
+# include <cstddef>		// size_t
+# include <functional>	// std::less
+# include <memory>		// std::allocator
+
+# include "vector.hpp"
+# include "../Iterators/iterator_traits.hpp"
+# include "../Iterators/reverse_iterator.hpp"
+# include "../Iterators/zip_iterator.hpp"
+# include "../Others/algorithm.hpp"
+# include "../Others/pair.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Flat map -
+		Same interface as map, stored in two vectors sorted by key: one of keys, one of mapped values, the element at index i being made of the i-th key and the i-th value.
+		A lookup is a binary search over a contiguous array of keys only, and iterating reads both arrays sequentially; an element costs nothing beyond its key and value.
+		In exchange, inserting or erasing a single element moves every element after it, and invalidates the iterators, pointers and references to them. Ranges are inserted in one go: the batch is sorted, then merged with the existing elements in a single pass.
+		Since keys and values are apart, there is no pair to point to: the iterators return a zip_reference, whose first and second refer to the key and the mapped value.
+	-------------------------------------------------------------------------------- */
+	template<class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<pair<Key, T> > >
+	class flat_map
+	{
+		public:
+			typedef				Key																			key_type;
+			typedef				T																			mapped_type;
+			typedef				pair<key_type, mapped_type>													value_type;
+			typedef				Compare																		key_compare;
+			class																							value_compare
+			{
+				friend class flat_map<Key, T, Compare, Alloc>;
+				protected:
+					Compare comp;
+					value_compare(Compare c) : comp(c)
+						{return;}
+
+				public:
+					bool operator()(const value_type& x, const value_type& y) const
+						{return (comp(x.first, y.first));}
+			};
+			typedef				Alloc																		allocator_type;
+			typedef				vector<Key, typename Alloc::template rebind<Key>::other>					key_container_type;
+			typedef				vector<T, typename Alloc::template rebind<T>::other>						mapped_container_type;
+			typedef				zip_reference<const Key, T>													reference;
+			typedef				zip_reference<const Key, const T>											const_reference;
+			typedef				zip_pointer<const Key, T>													pointer;
+			typedef				zip_pointer<const Key, const T>												const_pointer;
+			typedef				zip_iterator<const Key, T>													iterator;
+			typedef				zip_iterator<const Key, const T>											const_iterator;
+			typedef typename	ft::reverse_iterator<iterator>												reverse_iterator;
+			typedef typename	ft::reverse_iterator<const_iterator>										const_reverse_iterator;
+			typedef typename	iterator_traits<iterator>::difference_type									difference_type;
+			typedef				size_t																		size_type;
+
+		private:
+			key_container_type		_keys;
+			mapped_container_type	_values;
+			key_compare				_key_comp;
+			allocator_type			_alloc;
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTOR ----- */
+
+			/* --------------------------------------------------------------------------------
+			- Empty container constructor (default constructor) -
+				Constructs an empty container, with no elements.
+
+			Source: https://cplusplus.com/reference/map/map/map/
+			-------------------------------------------------------------------------------- */
+			explicit flat_map(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _keys(), _values(), _key_comp(comp), _alloc(alloc)
+				{return;}
+
+			/* --------------------------------------------------------------------------------
+			- Range constructor -
+				Constructs a container with as many elements as the range [first, last], sorted and inserted as one batch.
+
+			Source: https://cplusplus.com/reference/map/map/map/
+			-------------------------------------------------------------------------------- */
+			template<class InputIterator>
+			flat_map(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _keys(), _values(), _key_comp(comp), _alloc(alloc)
+			{
+				insert(first, last);
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Copy constructor -
+				Constructs a container with a copy of the keys and of the mapped values of x.
+
+			Source: https://cplusplus.com/reference/map/map/map/
+			-------------------------------------------------------------------------------- */
+			flat_map(const flat_map& x) : _keys(x._keys), _values(x._values), _key_comp(x._key_comp), _alloc(x._alloc)
+				{return;}
+
+			/* --------------------------------------------------------------------------------
+			- Map destructor -
+
+			Source: https://cplusplus.com/reference/map/map/~map/
+			-------------------------------------------------------------------------------- */
+			~flat_map()
+				{return;}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			/* --- Operator overloads --- */
+
+			/* --------------------------------------------------------------------------------
+			- Copy container content -
+
+			Source: https://cplusplus.com/reference/map/map/operator=/
+			-------------------------------------------------------------------------------- */
+			flat_map&								operator=(const flat_map& x)
+			{
+				if (this == &x)
+					return (*this);
+
+				_keys = x._keys;
+				_values = x._values;
+				_key_comp = x._key_comp;
+
+				return (*this);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Access element -
+				Returns a reference to the mapped value of the element with a key equivalent to k, inserting one with a default constructed mapped value if there is none.
+
+			Source: https://cplusplus.com/reference/map/map/operator[]/
+			-------------------------------------------------------------------------------- */
+			mapped_type&							operator[](const key_type& k)
+			{
+				size_type	i = _lower_index(k);
+
+				if (i == size() || _key_comp(k, _keys[i]))
+					_insert_at(i, k, mapped_type());
+
+				return (_values[i]);
+			}
+
+
+			/* --- Iterators --- */
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to beginning -
+
+			Source: https://cplusplus.com/reference/map/map/begin/
+			-------------------------------------------------------------------------------- */
+			iterator								begin()
+				{return (iterator(_keys.begin().base(), _values.begin().base()));}
+
+			const_iterator							begin() const
+				{return (const_iterator(_keys.begin().base(), _values.begin().base()));}
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to end -
+
+			Source: https://cplusplus.com/reference/map/map/end/
+			-------------------------------------------------------------------------------- */
+			iterator								end()
+				{return (begin() + size());}
+
+			const_iterator							end() const
+				{return (begin() + size());}
+
+			/* --------------------------------------------------------------------------------
+			- Return reverse iterator to reverse beginning -
+
+			Source: https://cplusplus.com/reference/map/map/rbegin/
+			-------------------------------------------------------------------------------- */
+			reverse_iterator						rbegin()
+				{return (reverse_iterator(end()));}
+
+			const_reverse_iterator					rbegin() const
+				{return (const_reverse_iterator(end()));}
+
+			/* --------------------------------------------------------------------------------
+			- Return reverse iterator to reverse end -
+
+			Source: https://cplusplus.com/reference/map/map/rend/
+			-------------------------------------------------------------------------------- */
+			reverse_iterator						rend()
+				{return (reverse_iterator(begin()));}
+
+			const_reverse_iterator					rend() const
+				{return (const_reverse_iterator(begin()));}
+
+
+			/* --- Capacity --- */
+
+			/* --------------------------------------------------------------------------------
+			- Test whether container is empty -
+
+			Source: https://cplusplus.com/reference/map/map/empty/
+			-------------------------------------------------------------------------------- */
+			bool									empty() const
+				{return (_keys.empty());}
+
+			/* --------------------------------------------------------------------------------
+			- Return container size -
+
+			Source: https://cplusplus.com/reference/map/map/size/
+			-------------------------------------------------------------------------------- */
+			size_type								size() const
+				{return (_keys.size());}
+
+			/* --------------------------------------------------------------------------------
+			- Return maximum size -
+
+			Source: https://cplusplus.com/reference/map/map/max_size/
+			-------------------------------------------------------------------------------- */
+			size_type								max_size() const
+				{return (_keys.max_size() < _values.max_size() ? _keys.max_size() : _values.max_size());}
+
+			/* --------------------------------------------------------------------------------
+			- Request a change in capacity -
+				Makes both vectors large enough for n elements, so that inserting up to n elements does not reallocate them.
+
+			Source: https://cplusplus.com/reference/vector/vector/reserve/
+			-------------------------------------------------------------------------------- */
+			void									reserve(size_type n)
+			{
+				_keys.reserve(n);
+				_values.reserve(n);
+
+				return;
+			}
+
+
+			/* --- Modifiers --- */
+
+			/* --------------------------------------------------------------------------------
+			- Insert element -
+				Inserts val at the position found by binary search, unless an element with an equivalent key is already in the container; the elements after it are moved one position in both vectors.
+
+			Returns a pair with an iterator to the inserted element, or to the element that prevented the insertion, and whether val was inserted.
+
+			Source: https://cplusplus.com/reference/map/map/insert/
+			-------------------------------------------------------------------------------- */
+			pair<iterator, bool>					insert(const value_type& val)
+			{
+				size_type	i = _lower_index(val.first);
+
+				if (i < size() && !_key_comp(val.first, _keys[i]))
+					return (pair<iterator, bool>(begin() + i, false));
+
+				_insert_at(i, val.first, val.second);
+
+				return (pair<iterator, bool>(begin() + i, true));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert element with hint -
+				When val goes right before hint and after the element preceding it, it is inserted there without searching; appending sorted elements at end() costs amortized O(1) each.
+
+			Source: https://cplusplus.com/reference/map/map/insert/
+			-------------------------------------------------------------------------------- */
+			iterator								insert(iterator hint, const value_type& val)
+			{
+				size_type	i = hint - begin();
+
+				if ((i == 0 || _key_comp(_keys[i - 1], val.first)) && (i == size() || _key_comp(val.first, _keys[i])))
+				{
+					_insert_at(i, val.first, val.second);
+					return (begin() + i);
+				}
+
+				return (insert(val).first);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert range -
+				Copies the range into a batch, sorts it by key with a stable sort, then merges it with the elements of the container into new vectors in one pass.
+				Keys already in the container are kept, and of equivalent keys in the batch only the first one is inserted, as if the elements had been inserted one by one.
+				A batch whose keys all follow the last key of the container is appended in place.
+				Inserting m elements in a container of n costs O(n + m log m) instead of O(n * m).
+
+			Source: https://cplusplus.com/reference/map/map/insert/
+			-------------------------------------------------------------------------------- */
+			template<class InputIterator>
+			void									insert(InputIterator first, InputIterator last)
+			{
+				vector<value_type, allocator_type>	batch;
+
+				for (; first != last; first++)
+					batch.push_back(*first);
+				if (batch.empty())
+					return;
+
+				ft::stable_sort(batch.begin(), batch.end(), value_comp());
+				if (empty() || _key_comp(_keys.back(), batch.front().first))
+				{
+					_append(batch);
+					return;
+				}
+
+				key_container_type		keys;
+				mapped_container_type	values;
+				size_type				i = 0;
+				size_type				j = 0;
+
+				keys.reserve(size() + batch.size());
+				values.reserve(size() + batch.size());
+				while (i < size() || j < batch.size())
+				{
+					if (j == batch.size() || (i < size() && !_key_comp(batch[j].first, _keys[i])))
+					{
+						for (; j < batch.size() && !_key_comp(_keys[i], batch[j].first); j++)
+							;
+						keys.push_back(_keys[i]);
+						values.push_back(_values[i++]);
+					}
+					else
+					{
+						keys.push_back(batch[j].first);
+						values.push_back(batch[j].second);
+						for (j++; j < batch.size() && !_key_comp(keys.back(), batch[j].first); j++)
+							;
+					}
+				}
+				_keys.swap(keys);
+				_values.swap(values);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase element -
+
+			Source: https://cplusplus.com/reference/map/map/erase/
+			-------------------------------------------------------------------------------- */
+			void									erase(iterator position)
+			{
+				size_type	i = position - begin();
+
+				_keys.erase(_keys.begin() + i);
+				_values.erase(_values.begin() + i);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase element by key -
+
+			Returns the number of elements erased.
+
+			Source: https://cplusplus.com/reference/map/map/erase/
+			-------------------------------------------------------------------------------- */
+			size_type								erase(const key_type& k)
+			{
+				iterator	it = find(k);
+
+				if (it == end())
+					return (0);
+
+				erase(it);
+
+				return (1);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase range -
+				Removes the elements in [first, last) from both vectors, moving the elements after them once.
+
+			Source: https://cplusplus.com/reference/map/map/erase/
+			-------------------------------------------------------------------------------- */
+			void									erase(iterator first, iterator last)
+			{
+				size_type	i = first - begin();
+				size_type	j = last - begin();
+
+				_keys.erase(_keys.begin() + i, _keys.begin() + j);
+				_values.erase(_values.begin() + i, _values.begin() + j);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Swap content -
+
+			Source: https://cplusplus.com/reference/map/map/swap/
+			-------------------------------------------------------------------------------- */
+			void									swap(flat_map& x)
+			{
+				key_compare	tmp_comp = _key_comp;
+
+				_keys.swap(x._keys);
+				_values.swap(x._values);
+				_key_comp = x._key_comp;
+				x._key_comp = tmp_comp;
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Clear content -
+				Destroys every element; the capacity of both vectors is kept.
+
+			Source: https://cplusplus.com/reference/map/map/clear/
+			-------------------------------------------------------------------------------- */
+			void									clear()
+			{
+				_keys.clear();
+				_values.clear();
+
+				return;
+			}
+
+
+			/* --- Observers --- */
+
+			/* --------------------------------------------------------------------------------
+			- Return key comparison object -
+
+			Source: https://cplusplus.com/reference/map/map/key_comp/
+			-------------------------------------------------------------------------------- */
+			key_compare								key_comp() const
+				{return (_key_comp);}
+
+			/* --------------------------------------------------------------------------------
+			- Return value comparison object -
+
+			Source: https://cplusplus.com/reference/map/map/value_comp/
+			-------------------------------------------------------------------------------- */
+			value_compare							value_comp() const
+				{return (value_compare(_key_comp));}
+
+			/* --------------------------------------------------------------------------------
+			- Return sorted keys -
+				Returns the vector of keys, in order.
+
+			Source: https://en.cppreference.com/w/cpp/container/flat_map/keys
+			-------------------------------------------------------------------------------- */
+			const key_container_type&				keys() const
+				{return (_keys);}
+
+			/* --------------------------------------------------------------------------------
+			- Return mapped values -
+				Returns the vector of mapped values, in the order of their keys.
+
+			Source: https://en.cppreference.com/w/cpp/container/flat_map/values
+			-------------------------------------------------------------------------------- */
+			const mapped_container_type&			values() const
+				{return (_values);}
+
+
+			/* --- Operations --- */
+
+			/* --------------------------------------------------------------------------------
+			- Get iterator to element -
+
+			Source: https://cplusplus.com/reference/map/map/find/
+			-------------------------------------------------------------------------------- */
+			iterator								find(const key_type& k)
+			{
+				size_type	i = _lower_index(k);
+
+				if (i == size() || _key_comp(k, _keys[i]))
+					return (end());
+
+				return (begin() + i);
+			}
+
+			const_iterator							find(const key_type& k) const
+			{
+				size_type	i = _lower_index(k);
+
+				if (i == size() || _key_comp(k, _keys[i]))
+					return (end());
+
+				return (begin() + i);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Count elements with a specific key -
+
+			Source: https://cplusplus.com/reference/map/map/count/
+			-------------------------------------------------------------------------------- */
+			size_type								count(const key_type& k) const
+				{return (find(k) != end());}
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to lower bound -
+				Binary search over the keys only.
+
+			Source: https://cplusplus.com/reference/map/map/lower_bound/
+			-------------------------------------------------------------------------------- */
+			iterator								lower_bound(const key_type& k)
+				{return (begin() + _lower_index(k));}
+
+			const_iterator							lower_bound(const key_type& k) const
+				{return (begin() + _lower_index(k));}
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to upper bound -
+
+			Source: https://cplusplus.com/reference/map/map/upper_bound/
+			-------------------------------------------------------------------------------- */
+			iterator								upper_bound(const key_type& k)
+				{return (begin() + _upper_index(k));}
+
+			const_iterator							upper_bound(const key_type& k) const
+				{return (begin() + _upper_index(k));}
+
+			/* --------------------------------------------------------------------------------
+			- Get range of equal elements -
+
+			Source: https://cplusplus.com/reference/map/map/equal_range/
+			-------------------------------------------------------------------------------- */
+			pair<iterator, iterator>				equal_range(const key_type& k)
+				{return (pair<iterator, iterator>(lower_bound(k), upper_bound(k)));}
+
+			pair<const_iterator, const_iterator>	equal_range(const key_type& k) const
+				{return (pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k)));}
+
+
+			/* --- Allocator --- */
+
+			/* --------------------------------------------------------------------------------
+			- Get allocator -
+
+			Source: https://cplusplus.com/reference/map/map/get_allocator/
+			-------------------------------------------------------------------------------- */
+			allocator_type							get_allocator() const
+				{return (_alloc);}
+
+		private:
+			/* --------------------------------------------------------------------------------
+			- Index of the lower bound -
+				Binary search for the first key that is not less than k, halving the range of candidates at each step.
+			-------------------------------------------------------------------------------- */
+			size_type								_lower_index(const key_type& k) const
+			{
+				size_type	first = 0;
+				size_type	n = size();
+
+				while (n)
+				{
+					size_type	half = n / 2;
+
+					if (_key_comp(_keys[first + half], k))
+					{
+						first += half + 1;
+						n -= half + 1;
+					}
+					else
+						n = half;
+				}
+
+				return (first);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Index of the upper bound -
+				Binary search for the first key that is greater than k.
+			-------------------------------------------------------------------------------- */
+			size_type								_upper_index(const key_type& k) const
+			{
+				size_type	first = 0;
+				size_type	n = size();
+
+				while (n)
+				{
+					size_type	half = n / 2;
+
+					if (!_key_comp(k, _keys[first + half]))
+					{
+						first += half + 1;
+						n -= half + 1;
+					}
+					else
+						n = half;
+				}
+
+				return (first);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert at index -
+				Inserts the key and the mapped value at index i of their vectors.
+			-------------------------------------------------------------------------------- */
+			void									_insert_at(size_type i, const key_type& k, const mapped_type& v)
+			{
+				_keys.insert(_keys.begin() + i, k);
+				_values.insert(_values.begin() + i, v);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Append sorted batch -
+				Pushes the elements of a batch sorted by key, whose keys all follow the last key of the container, skipping the equivalent keys after the first.
+			-------------------------------------------------------------------------------- */
+			void									_append(const vector<value_type, allocator_type>& batch)
+			{
+				reserve(size() + batch.size());
+				for (size_type j = 0; j < batch.size(); j++)
+				{
+					if (j && !_key_comp(batch[j - 1].first, batch[j].first))
+						continue;
+					_keys.push_back(batch[j].first);
+					_values.push_back(batch[j].second);
+				}
+
+				return;
+			}
+	};
+
+
+	/* ----- NON-MEMBER OPERATOR OVERLOADS ----- */
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator==(const flat_map<Key, T, Compare, Alloc>& lhs, const flat_map<Key, T, Compare, Alloc>& rhs)
+		{return (lhs.keys() == rhs.keys() && lhs.values() == rhs.values());}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator<(const flat_map<Key, T, Compare, Alloc>& lhs, const flat_map<Key, T, Compare, Alloc>& rhs)
+		{return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator!=(const flat_map<Key, T, Compare, Alloc>& lhs, const flat_map<Key, T, Compare, Alloc>& rhs)
+		{return (!(lhs == rhs));}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator>(const flat_map<Key, T, Compare, Alloc>& lhs, const flat_map<Key, T, Compare, Alloc>& rhs)
+		{return (rhs < lhs);}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator<=(const flat_map<Key, T, Compare, Alloc>& lhs, const flat_map<Key, T, Compare, Alloc>& rhs)
+		{return (!(rhs < lhs));}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator>=(const flat_map<Key, T, Compare, Alloc>& lhs, const flat_map<Key, T, Compare, Alloc>& rhs)
+		{return (!(lhs < rhs));}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	void	swap(flat_map<Key, T, Compare, Alloc>& x, flat_map<Key, T, Compare, Alloc>& y)
+	{
+		x.swap(y);
+		return;
+	}
+}
+
+#endif
+
+/* --------------------------------------------------------------------------------
+Source: https://en.cppreference.com/w/cpp/container/flat_map
+-------------------------------------------------------------------------------- */
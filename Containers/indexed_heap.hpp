@@ -0,0 +1,281 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   indexed_heap.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:14:55 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 10:14:55 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef INDEXED_HEAP_HPP
+# define INDEXED_HEAP_HPP
+
+# include <cstddef>		// size_t
+# include <functional>	// std::less
+# include <memory>		// std::allocator
+
+# include "vector.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Indexed heap -
+		Priority queue whose elements can be changed or removed after they are pushed: push returns a handle, which stays valid while the element moves through the heap, and update changes the element's value in place, in either direction, in O(log n), where an ordered map would erase and insert again.
+		The heap is a D-ary heap of (value, handle) entries in one ft::vector, so that comparisons read contiguous memory; a second vector maps each handle to the position of its entry, kept up to date on every move. The handles of popped or erased elements are reused by later pushes.
+		As in priority_queue, the top is the greatest element by comp, and Arity is the number of children per node.
+	-------------------------------------------------------------------------------- */
+	template<class T, class Compare = std::less<T>, size_t Arity = 4, class Alloc = std::allocator<T> >
+	class indexed_heap
+	{
+		public:
+			typedef T														value_type;
+			typedef Compare													value_compare;
+			typedef Alloc													allocator_type;
+			typedef size_t													size_type;
+			typedef size_t													handle_type;
+
+		private:
+			struct	_entry
+			{
+				value_type		value;
+				handle_type		handle;
+
+				_entry(const value_type& val, handle_type h) : value(val), handle(h)
+					{return;}
+			};
+
+			typedef typename	Alloc::template rebind<_entry>::other		entry_allocator;
+			typedef typename	Alloc::template rebind<size_type>::other	index_allocator;
+
+			static const size_type						_npos = static_cast<size_type>(-1);
+
+			vector<_entry, entry_allocator>				_heap;
+			vector<size_type, index_allocator>			_pos;
+			vector<handle_type, index_allocator>		_free;
+			value_compare								_comp;
+
+		public:
+			/* ----- CONSTRUCTOR ----- */
+
+			explicit indexed_heap(const value_compare& comp = value_compare()) : _heap(), _pos(), _free(), _comp(comp)
+				{return;}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			bool					empty() const
+				{return (_heap.empty());}
+
+			size_type				size() const
+				{return (_heap.size());}
+
+			/* --------------------------------------------------------------------------------
+			- Request a change in capacity -
+				Makes room for n elements and n handles, so that the first n pushes do not reallocate.
+			-------------------------------------------------------------------------------- */
+			void					reserve(size_type n)
+			{
+				_heap.reserve(n);
+				_pos.reserve(n);
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Access top element -
+				Returns the greatest element. The heap must not be empty.
+			-------------------------------------------------------------------------------- */
+			const value_type&		top() const
+				{return (_heap.front().value);}
+
+			handle_type				top_handle() const
+				{return (_heap.front().handle);}
+
+			/* --------------------------------------------------------------------------------
+			- Test handle -
+				Returns whether h is the handle of an element still in the heap.
+			-------------------------------------------------------------------------------- */
+			bool					contains(handle_type h) const
+				{return (h < _pos.size() && _pos[h] != _npos);}
+
+			/* --------------------------------------------------------------------------------
+			- Access element -
+				Returns the element of handle h, which must be in the heap. Changing it goes through update.
+			-------------------------------------------------------------------------------- */
+			const value_type&		operator[](handle_type h) const
+				{return (_heap[_pos[h]].value);}
+
+			/* --------------------------------------------------------------------------------
+			- Insert element -
+				Adds val to the heap and returns its handle.
+			-------------------------------------------------------------------------------- */
+			handle_type				push(const value_type& val)
+			{
+				handle_type	h;
+
+				if (_free.empty())
+				{
+					_pos.push_back(_npos);
+					h = _pos.size() - 1;
+				}
+				else
+				{
+					h = _free.back();
+					_free.pop_back();
+				}
+				_entry	e(val, h);
+
+				try
+				{
+					_heap.push_back(e);
+				}
+				catch (...)
+				{
+					_free.push_back(h);
+					throw;
+				}
+				_sift_up(_heap.size() - 1, e);
+
+				return (h);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Remove top element -
+				Removes the greatest element. The heap must not be empty.
+				The hole left at the top goes down to a leaf along the greatest children, then the last entry is sifted up from there, as in ft::dary_pop_heap.
+			-------------------------------------------------------------------------------- */
+			void					pop()
+				{erase(top_handle());}
+
+			/* --------------------------------------------------------------------------------
+			- Change element -
+				Sets the element of handle h, which must be in the heap, to val, and moves it up or down to its place.
+			-------------------------------------------------------------------------------- */
+			void					update(handle_type h, const value_type& val)
+			{
+				size_type	i = _pos[h];
+				_entry		e(val, h);
+
+				if (_comp(_heap[i].value, val))
+					_sift_up(i, e);
+				else
+					_sift_down(i, e);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase element -
+				Removes the element of handle h, which must be in the heap; h may then be reused by a push.
+			-------------------------------------------------------------------------------- */
+			void					erase(handle_type h)
+			{
+				size_type	i = _pos[h];
+				_entry		last = _heap.back();
+
+				_free.push_back(h);
+				_pos[h] = _npos;
+				_heap.pop_back();
+				if (i == _heap.size())
+					return;
+				if (!i)
+					_sift_up(_sift_to_leaf(), last);
+				else if (_comp(_heap[i].value, last.value))
+					_sift_up(i, last);
+				else
+					_sift_down(i, last);
+
+				return;
+			}
+
+			void					clear()
+			{
+				_heap.clear();
+				_pos.clear();
+				_free.clear();
+				return;
+			}
+
+		private:
+			void					_place(size_type i, const _entry& e)
+			{
+				_heap[i] = e;
+				_pos[e.handle] = i;
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Greatest child -
+				Returns the position of the greatest child of the entry at position i, or _npos if it has none.
+			-------------------------------------------------------------------------------- */
+			size_type				_best_child(size_type i) const
+			{
+				size_type	child = i * Arity + 1;
+
+				if (child >= _heap.size())
+					return (_npos);
+
+				size_type	end = (_heap.size() - child < Arity ? _heap.size() : child + Arity);
+				size_type	best = child;
+
+				for (++child; child < end; ++child)
+				{
+					if (_comp(_heap[best].value, _heap[child].value))
+						best = child;
+				}
+
+				return (best);
+			}
+
+			void					_sift_up(size_type i, const _entry& e)
+			{
+				while (i > 0)
+				{
+					size_type	parent = (i - 1) / Arity;
+
+					if (!_comp(_heap[parent].value, e.value))
+						break;
+					_place(i, _heap[parent]);
+					i = parent;
+				}
+				_place(i, e);
+
+				return;
+			}
+
+			void					_sift_down(size_type i, const _entry& e)
+			{
+				size_type	best;
+
+				while ((best = _best_child(i)) != _npos && _comp(e.value, _heap[best].value))
+				{
+					_place(i, _heap[best]);
+					i = best;
+				}
+				_place(i, e);
+
+				return;
+			}
+
+			size_type				_sift_to_leaf()
+			{
+				size_type	i = 0;
+				size_type	best;
+
+				while ((best = _best_child(i)) != _npos)
+				{
+					_place(i, _heap[best]);
+					i = best;
+				}
+
+				return (i);
+			}
+	};
+
+	template<class T, class Compare, size_t Arity, class Alloc>
+	const typename indexed_heap<T, Compare, Arity, Alloc>::size_type	indexed_heap<T, Compare, Arity, Alloc>::_npos;
+}
+
+#endif
@@ -0,0 +1,254 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   interval_map.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:45:05 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 11:16:52 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef INTERVAL_MAP_HPP
+# define INTERVAL_MAP_HPP
+
+# include <cstddef>		// size_t
+# include <functional>	// std::less
+# include <memory>		// std::allocator
+
+# include "map.hpp"
+# include "../Others/pair.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Interval ordering -
+		Orders half-open intervals [first, second) by their start, then by their end, with comp comparing the bounds.
+	-------------------------------------------------------------------------------- */
+	template<class Key, class Compare = std::less<Key> >
+	struct interval_compare
+	{
+		Compare	comp;
+
+		explicit interval_compare(const Compare& c = Compare()) : comp(c)
+			{return;}
+
+		bool	operator()(const pair<Key, Key>& x, const pair<Key, Key>& y) const
+			{return (comp(x.first, y.first) || (!comp(y.first, x.first) && comp(x.second, y.second)));}
+	};
+
+	/* --------------------------------------------------------------------------------
+	- Max-endpoint aggregate -
+		Aggregate policy storing, for every subtree, the largest interval end it contains (first is false for an empty subtree).
+		Kept up to date by the tree through rotations, it lets interval_map skip every subtree whose intervals all end before a query starts.
+	-------------------------------------------------------------------------------- */
+	template<class Key, class T, class Compare = std::less<Key> >
+	struct interval_max_end
+	{
+		typedef pair<bool, Key>	result_type;
+
+		Compare	comp;
+
+		explicit interval_max_end(const Compare& c = Compare()) : comp(c)
+			{return;}
+
+		result_type	identity() const
+			{return (result_type(false, Key()));}
+
+		result_type	operator()(const pair<const pair<Key, Key>, T>& val) const
+			{return (result_type(true, val.first.second));}
+
+		result_type	combine(const result_type& a, const result_type& b) const
+		{
+			if (!a.first || (b.first && comp(a.second, b.second)))
+				return (b);
+
+			return (a);
+		}
+	};
+
+	/* --------------------------------------------------------------------------------
+	- Interval map -
+		A map keyed by half-open intervals [lo, hi), sorted by start then end, built on red_black_tree with the max-endpoint augmentation.
+		It keeps the lookup and modifier interface of ft::map, inherited privately so that it is never used or destroyed through a map, and answers overlap and stabbing queries by pruning the subtrees that cannot contain a match, reporting them as ordinary tree iterators.
+	-------------------------------------------------------------------------------- */
+	template<class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<pair<const pair<Key, Key>, T> > >
+	class interval_map : private map<pair<Key, Key>, T, interval_compare<Key, Compare>, Alloc, interval_max_end<Key, T, Compare> >
+	{
+		public:
+			typedef				map<pair<Key, Key>, T, interval_compare<Key, Compare>, Alloc, interval_max_end<Key, T, Compare> >	map_type;
+			typedef				Key																									bound_type;
+			typedef typename	map_type::key_type																					key_type;
+			typedef typename	map_type::mapped_type																				mapped_type;
+			typedef typename	map_type::value_type																				value_type;
+			typedef typename	map_type::key_compare																				key_compare;
+			typedef typename	map_type::value_compare																				value_compare;
+			typedef typename	map_type::allocator_type																			allocator_type;
+			typedef typename	map_type::reference																					reference;
+			typedef typename	map_type::const_reference																			const_reference;
+			typedef typename	map_type::pointer																					pointer;
+			typedef typename	map_type::const_pointer																				const_pointer;
+			typedef typename	map_type::iterator																					iterator;
+			typedef typename	map_type::const_iterator																			const_iterator;
+			typedef typename	map_type::reverse_iterator																			reverse_iterator;
+			typedef typename	map_type::const_reverse_iterator																	const_reverse_iterator;
+			typedef typename	map_type::difference_type																			difference_type;
+			typedef typename	map_type::size_type																					size_type;
+
+		private:
+			typedef typename	map_type::tree_type::node_type																		tree_node;
+			typedef typename	map_type::tree_type::node_const_type																tree_const_node;
+
+			Compare	_bound_comp;
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTOR ----- */
+
+			explicit interval_map(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : map_type(comp, alloc, interval_max_end<Key, T, Compare>(comp.comp)), _bound_comp(comp.comp)
+				{return;}
+
+			template<class InputIterator>
+			interval_map(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : map_type(first, last, comp, alloc, interval_max_end<Key, T, Compare>(comp.comp)), _bound_comp(comp.comp)
+				{return;}
+
+			interval_map(const interval_map& x) : map_type(x), _bound_comp(x._bound_comp)
+				{return;}
+
+			~interval_map()
+				{return;}
+
+			interval_map&			operator=(const interval_map& x)
+			{
+				map_type::operator=(x);
+				_bound_comp = x._bound_comp;
+
+				return (*this);
+			}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			using map_type::begin;
+			using map_type::end;
+			using map_type::rbegin;
+			using map_type::rend;
+			using map_type::empty;
+			using map_type::size;
+			using map_type::max_size;
+			using map_type::operator[];
+			using map_type::insert;
+			using map_type::erase;
+			using map_type::clear;
+			using map_type::key_comp;
+			using map_type::value_comp;
+			using map_type::find;
+			using map_type::count;
+			using map_type::lower_bound;
+			using map_type::upper_bound;
+			using map_type::equal_range;
+			using map_type::get_allocator;
+
+			/* --------------------------------------------------------------------------------
+			- Swap content -
+				Exchanges the intervals of the two maps in O(1).
+			-------------------------------------------------------------------------------- */
+			void					swap(interval_map& x)
+			{
+				map_type::swap(x);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert an interval -
+				Inserts val for the interval [lo, hi), unless that exact interval is already in the map.
+			-------------------------------------------------------------------------------- */
+			pair<iterator, bool>	insert(const bound_type& lo, const bound_type& hi, const mapped_type& val)
+				{return (map_type::insert(value_type(key_type(lo, hi), val)));}
+
+			/* --------------------------------------------------------------------------------
+			- Find one overlapping interval -
+				Returns an iterator to an interval overlapping [lo, hi), or end() if there is none, in O(log n).
+			-------------------------------------------------------------------------------- */
+			iterator				find_overlap(const bound_type& lo, const bound_type& hi)
+				{return (iterator(_find_overlap(this->_tree.get_root(), this->_tree.get_end(), lo, hi)));}
+
+			const_iterator			find_overlap(const bound_type& lo, const bound_type& hi) const
+				{return (const_iterator(_find_overlap(this->_tree.get_root(), this->_tree.get_end(), lo, hi)));}
+
+			/* --------------------------------------------------------------------------------
+			- Enumerate overlapping intervals -
+				Writes to out an iterator to every interval [a, b) overlapping [lo, hi) (a < hi and lo < b), in increasing order, and returns the end of the output range.
+				Subtrees whose largest end is not after lo, and right subtrees of nodes starting at or after hi, are never entered: every other subtree visited holds at least one result, so the cost is O(log n) for the boundary paths plus O(log n) per reported interval at worst, and O(log n + k) when the results are contiguous in start order.
+			-------------------------------------------------------------------------------- */
+			template<class OutputIterator>
+			OutputIterator			overlapping(const bound_type& lo, const bound_type& hi, OutputIterator out)
+				{return (_overlapping<iterator>(this->_tree.get_root(), lo, hi, false, out));}
+
+			template<class OutputIterator>
+			OutputIterator			overlapping(const bound_type& lo, const bound_type& hi, OutputIterator out) const
+				{return (_overlapping<const_iterator>(this->_tree.get_root(), lo, hi, false, out));}
+
+			/* --------------------------------------------------------------------------------
+			- Enumerate intervals containing a point -
+				Writes to out an iterator to every interval [a, b) with a <= point < b, in increasing order, and returns the end of the output range.
+			-------------------------------------------------------------------------------- */
+			template<class OutputIterator>
+			OutputIterator			stabbing(const bound_type& point, OutputIterator out)
+				{return (_overlapping<iterator>(this->_tree.get_root(), point, point, true, out));}
+
+			template<class OutputIterator>
+			OutputIterator			stabbing(const bound_type& point, OutputIterator out) const
+				{return (_overlapping<const_iterator>(this->_tree.get_root(), point, point, true, out));}
+
+		private:
+			template<class Node>
+			bool					_ends_after(const Node* node, const bound_type& lo) const
+				{return (node && node->get_aggregate().first && _bound_comp(lo, node->get_aggregate().second));}
+
+			template<class Node>
+			bool					_starts_before(const Node* node, const bound_type& hi, bool closed) const
+			{
+				if (closed)
+					return (!_bound_comp(hi, node->get_value().first.first));
+
+				return (_bound_comp(node->get_value().first.first, hi));
+			}
+
+			template<class Node>
+			Node*					_find_overlap(Node* node, Node* end, const bound_type& lo, const bound_type& hi) const
+			{
+				while (node)
+				{
+					if (_starts_before(node, hi, false) && _bound_comp(lo, node->get_value().first.second))
+						return (node);
+					else if (_ends_after(node->get_left(), lo))
+						node = node->get_left();
+					else
+						node = node->get_right();
+				}
+
+				return (end);
+			}
+
+			template<class Iterator, class Node, class OutputIterator>
+			OutputIterator			_overlapping(Node* node, const bound_type& lo, const bound_type& hi, bool closed, OutputIterator out) const
+			{
+				if (!_ends_after(node, lo))
+					return (out);
+
+				out = _overlapping<Iterator>(node->get_left(), lo, hi, closed, out);
+
+				if (!_starts_before(node, hi, closed))
+					return (out);
+
+				if (_bound_comp(lo, node->get_value().first.second))
+					*out++ = Iterator(node);
+
+				return (_overlapping<Iterator>(node->get_right(), lo, hi, closed, out));
+			}
+	};
+}
+
+#endif
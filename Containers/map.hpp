@@ -6,7 +6,7 @@
 /*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/07 11:46:56 by hcremers          #+#    #+#             */
-/*   Updated: 2023/01/03 12:09:42 by hcremers         ###   ########.fr       */
+/*   Updated: 2026/10/19 11:16:52 by hcremers         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,17 +17,20 @@
 # include <functional>	// std::less
 # include <memory>		// std::allocator
 
+# include "vector.hpp"
 # include "../Iterators/iterator_traits.hpp"
 # include "../Iterators/reverse_iterator.hpp"
 # include "../Iterators/tree_iterator.hpp"
+# include "../Others/aggregate.hpp"
 # include "../Others/algorithm.hpp"
+# include "../Others/node_handle.hpp"
 # include "../Others/pair.hpp"
 # include "../Others/red_black_node.hpp"
 # include "../Others/red_black_tree.hpp"
 
 namespace ft
 {
-	template<class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<pair<const Key, T> > >
+	template<class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<pair<const Key, T> >, class Aggregate = no_aggregate<pair<const Key, T> > >
 	class map
 	{
 		public:
@@ -37,7 +40,7 @@ namespace ft
 			typedef				Compare																									key_compare;
 			class																														value_compare
 			{
-				friend class map<Key, T, Compare, Alloc>;
+				friend class map<Key, T, Compare, Alloc, Aggregate>;
 				protected:
 					Compare comp;
 					value_compare(Compare c) : comp(c)
@@ -52,18 +55,30 @@ namespace ft
 			typedef typename	allocator_type::const_reference																			const_reference;
 			typedef typename	allocator_type::pointer																					pointer;
 			typedef typename	allocator_type::const_pointer																			const_pointer;
-			typedef typename	ft::tree_iterator<value_type, value_compare, red_black_node<value_type, value_compare> >				iterator;
-			typedef typename	ft::tree_iterator<const value_type, value_compare, red_black_node<const value_type, value_compare> >	const_iterator;
+			typedef typename	ft::tree_iterator<value_type, value_compare, red_black_node<value_type, value_compare, Aggregate> >				iterator;
+			typedef typename	ft::tree_iterator<const value_type, value_compare, red_black_node<const value_type, value_compare, Aggregate> >	const_iterator;
 			typedef typename	ft::reverse_iterator<iterator>																			reverse_iterator;
 			typedef typename	ft::reverse_iterator<const_iterator>																	const_reverse_iterator;
 			typedef typename	iterator_traits<iterator>::difference_type																difference_type;
 			typedef				size_t																									size_type;
+			typedef typename	Aggregate::result_type																					aggregate_type;
+			typedef				node_handle<Key, T, red_black_node<value_type, value_compare, Aggregate>, typename Alloc::template rebind<red_black_node<value_type, value_compare, Aggregate> >::other>	node_type;
 
-		private:
-			red_black_tree<value_type, Alloc, value_compare>	_tree;
-			size_type											_size;
-			key_compare											_key_comp;
-			value_compare										_val_comp;
+			struct	insert_return_type
+			{
+				iterator	position;
+				bool		inserted;
+				node_type	node;
+			};
+
+		protected:
+			typedef				red_black_tree<value_type, Alloc, value_compare, Aggregate>												tree_type;
+			typedef typename	tree_type::node_type																					tree_node;
+
+			key_compare			_key_comp;
+			value_compare		_val_comp;
+			tree_type			_tree;
+			size_type			_size;
 
 		public:
 			/* ----- CONSTRUCTORS AND DESTRUCTOR ----- */
@@ -72,9 +87,11 @@ namespace ft
 			- Empty container constructor (default constructor) -
 				Constructs an empty container, with no elements.
 
+				The tree keeps a copy of aggr, the Aggregate policy used to summarize its subtrees.
+
 			Source: https://cplusplus.com/reference/map/map/map/
 			-------------------------------------------------------------------------------- */
-			explicit map(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _tree(_val_comp), _size(0), _key_comp(comp), _val_comp(_key_comp)
+			explicit map(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type(), const Aggregate& aggr = Aggregate()) : _key_comp(comp), _val_comp(_key_comp), _tree(_val_comp, aggr), _size(0)
 			{
 				(void)alloc;
 				return;
@@ -83,12 +100,12 @@ namespace ft
 			/* --------------------------------------------------------------------------------
 			- Range constructor -
 				Constructs a container with as many elements as the range [first, last], with each element constructed from its corresponding element in that range.
-				The container keeps an internal copy of alloc and comp, which are used to allocate storage and to sort the elements throughout its lifetime.
+				The container keeps an internal copy of alloc and comp, which are used to allocate storage and to sort the elements throughout its lifetime, and of aggr, which summarizes its subtrees.
 
 			Source: https://cplusplus.com/reference/map/map/map/
 			-------------------------------------------------------------------------------- */
 			template<class InputIterator>
-			map(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _tree(_val_comp), _size(0), _key_comp(comp), _val_comp(_key_comp)
+			map(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type(), const Aggregate& aggr = Aggregate()) : _key_comp(comp), _val_comp(_key_comp), _tree(_val_comp, aggr), _size(0)
 			{
 				(void)alloc;
 				insert(first, last);
@@ -102,8 +119,11 @@ namespace ft
 
 			Source: https://cplusplus.com/reference/map/map/map/
 			-------------------------------------------------------------------------------- */
-			map(const map& x) : _tree(x._tree), _size(x.size()), _key_comp(x._key_comp), _val_comp(_key_comp)
-				{return;}
+			map(const map& x) : _key_comp(x._key_comp), _val_comp(_key_comp), _tree(_val_comp), _size(x.size())
+			{
+				_tree = x._tree;
+				return;
+			}
 
 			/* --------------------------------------------------------------------------------
 			- Map destructor -
@@ -124,13 +144,15 @@ namespace ft
 			- Copy container content -
 				Assigns new contents to the container, replacing its current content.
 				Copies all the elements from x into the container, changing its size accordingly.
-				The container preserves its current allocator, which is used to allocate additional storage if needed.
+				The container preserves its current allocator, which is used to allocate additional storage if needed, and takes a copy of the comparison object of x.
 				The elements stored in the container before the call are either assigned to or destroyed.
 
 			Source: https://cplusplus.com/reference/map/map/operator=/
 			-------------------------------------------------------------------------------- */
 			map&									operator=(const map& x)
 			{
+				_key_comp = x._key_comp;
+				_val_comp = x._val_comp;
 				_tree = x._tree;
 				_size = x._size;
 
@@ -170,12 +192,7 @@ namespace ft
 			Source: https://cplusplus.com/reference/map/map/begin/
 			-------------------------------------------------------------------------------- */
 			iterator								begin()
-			{
-				if (!_size)
-					return (end());
-
-				return (iterator(red_black_node<value_type, value_compare>::get_smallest(_tree.get_root())));
-			}
+				{return (iterator(_tree.get_begin()));}
 
 			/* --------------------------------------------------------------------------------
 			- Return iterator to beginning -
@@ -186,12 +203,7 @@ namespace ft
 			Source: https://cplusplus.com/reference/map/map/begin/
 			-------------------------------------------------------------------------------- */
 			const_iterator							begin() const
-			{
-				if (!_size)
-					return (end());
-
-				return (static_cast<const_iterator>(red_black_node<const value_type, value_compare>::get_smallest(_tree.get_root())));
-			}
+				{return (static_cast<const_iterator>(_tree.get_begin()));}
 
 			/* --------------------------------------------------------------------------------
 			- Return iterator to end -
@@ -247,7 +259,7 @@ namespace ft
 			Source: https://cplusplus.com/reference/map/map/rend/
 			-------------------------------------------------------------------------------- */
 			reverse_iterator						rend()
-				{return (reverse_iterator(red_black_node<value_type, value_compare>::get_smallest(_tree.get_root())));}
+				{return (reverse_iterator(begin()));}
 
 			/* --------------------------------------------------------------------------------
 			- Return reverse iterator to reverse end -
@@ -257,7 +269,7 @@ namespace ft
 			Source: https://cplusplus.com/reference/map/map/rend/
 			-------------------------------------------------------------------------------- */
 			const_reverse_iterator					rend() const
-				{return (const_reverse_iterator(red_black_node<value_type, value_compare>::get_smallest(_tree.get_root())));}
+				{return (const_reverse_iterator(begin()));}
 
 
 			/* --- Capacity --- */
@@ -308,7 +320,7 @@ namespace ft
 			-------------------------------------------------------------------------------- */
 			pair<iterator, bool>					insert(const value_type& val)
 			{
-				pair<red_black_node<value_type, value_compare>*, bool>	tmp = _tree.insert(val);
+				pair<tree_node*, bool>	tmp = _tree.insert(val);
 				pair<iterator, bool>									itp(iterator(tmp.first), tmp.second);
 
 				if (itp.second)
@@ -317,6 +329,26 @@ namespace ft
 				return (itp);
 			}
 
+			/* --------------------------------------------------------------------------------
+			- Insert or assign element -
+				Inserts (k, obj), or maps obj to k if there is already an element with key k, and refreshes the aggregates on the path to it.
+				Prefer it to operator[] when the Aggregate depends on the mapped value.
+
+			Returns a pair with an iterator to the element and whether it was inserted.
+			-------------------------------------------------------------------------------- */
+			pair<iterator, bool>					insert_or_assign(const key_type& k, const mapped_type& obj)
+			{
+				pair<iterator, bool>	itp = insert(value_type(k, obj));
+
+				if (!itp.second)
+				{
+					itp.first->second = obj;
+					_tree.refresh(itp.first.base());
+				}
+
+				return (itp);
+			}
+
 			/* --------------------------------------------------------------------------------
 			- Insert elements -
 				Extends the container by inserting new elements, effectively increasing the container size by the number of elements inserted.
@@ -331,7 +363,7 @@ namespace ft
 			-------------------------------------------------------------------------------- */
 			iterator								insert(iterator hint, const value_type& val)
 			{
-				pair<red_black_node<value_type, value_compare>*, bool>	tmp;
+				pair<tree_node*, bool>	tmp;
 
 				if (hint != begin() && hint != end() && _val_comp(*(--hint), val) && _val_comp(val, *(++hint)))
 					tmp = _tree.insert(val, hint);
@@ -359,7 +391,7 @@ namespace ft
 			{
 				while (first != last)
 				{
-					pair<red_black_node<value_type, value_compare>*, bool>	tmp = _tree.insert(*first);
+					pair<tree_node*, bool>	tmp = _tree.insert(*first);
 
 					first++;
 
@@ -369,6 +401,86 @@ namespace ft
 				return;
 			}
 
+			/* --------------------------------------------------------------------------------
+			- Insert node -
+				Links the node owned by nh, extracted from this map or from another map of the same type, if no element with an equivalent key is in the container; no element is copied and nothing is allocated.
+				Ownership is taken from nh, which is passed by value: on success the returned node is empty, otherwise it owns the node again.
+
+			Returns the position of the inserted element or of the element that prevented the insertion, whether the node was inserted, and the node handle.
+
+			Source: https://en.cppreference.com/w/cpp/container/map/insert
+			-------------------------------------------------------------------------------- */
+			insert_return_type						insert(node_type nh)
+			{
+				insert_return_type	ret;
+
+				ret.position = end();
+				ret.inserted = false;
+				if (nh.empty())
+					return (ret);
+
+				pair<tree_node*, bool>	tmp = _tree.insert_node(nh._node);
+
+				ret.position = iterator(tmp.first);
+				ret.inserted = tmp.second;
+				if (tmp.second)
+				{
+					nh._release();
+					_size++;
+				}
+				else
+					ret.node = nh;
+
+				return (ret);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert node with hint -
+				Same as insert(nh), returning only the position; the hint is not used since the node is linked in O(log n) either way.
+				When an equivalent key already exists, the node is destroyed along with nh.
+
+			Source: https://en.cppreference.com/w/cpp/container/map/insert
+			-------------------------------------------------------------------------------- */
+			iterator								insert(iterator hint, node_type nh)
+			{
+				(void)hint;
+
+				return (insert(nh).position);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Extract node -
+				Unlinks the element at position from the tree and returns a handle owning its node, which is neither destroyed nor deallocated.
+				Iterators to the other elements remain valid.
+
+			Source: https://en.cppreference.com/w/cpp/container/map/extract
+			-------------------------------------------------------------------------------- */
+			node_type								extract(iterator position)
+			{
+				tree_node*	node = position.base();
+
+				_tree.unlink(node);
+				_size--;
+
+				return (node_type(node, _tree.get_alloc()));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Extract node by key -
+				Unlinks the element with a key equivalent to k, if any, and returns a handle owning its node; the handle is empty otherwise.
+
+			Source: https://en.cppreference.com/w/cpp/container/map/extract
+			-------------------------------------------------------------------------------- */
+			node_type								extract(const key_type& k)
+			{
+				iterator	it = find(k);
+
+				if (it == end())
+					return (node_type());
+
+				return (extract(it));
+			}
+
 			/* --------------------------------------------------------------------------------
 			- Erase elements -
 				Removes from the map container a single element.
@@ -408,22 +520,13 @@ namespace ft
 			- Erase elements -
 				Removes from the map container a range of elements ([first, last]).
 				This effectively reduces the container size by the number of elements removed, which are destroyed.
+				The range is cut out of the tree by rank and destroyed in one walk, in O(k + log n) with no search per element; erasing everything is a clear().
 
 			Source: https://cplusplus.com/reference/map/map/erase/
 			-------------------------------------------------------------------------------- */
 			void									erase(iterator first, iterator last)
 			{
-				iterator	tmp;
-
-				while (first != last)
-				{
-					tmp = first;
-
-					if (_tree.erase(*first))
-						_size--;
-
-					first++;
-				}
+				_size -= _tree.erase(first.base(), last.base());
 
 				return;
 			}
@@ -462,6 +565,88 @@ namespace ft
 				return;
 			}
 
+			/* --------------------------------------------------------------------------------
+			- Merge another map -
+				Moves into this map every element of x whose key is not already here; the others stay in x.
+				Nodes are relinked rather than copied, and the two trees are combined by split and join in O(m log(n / m + 1)), where m is the size of the smaller one: linear for maps of similar sizes instead of O(m log(n + m)) for insertions one by one.
+			-------------------------------------------------------------------------------- */
+			void									merge(map& x)
+			{
+				_tree.merge(x._tree);
+				_size = _tree.size();
+				x._size = x._tree.size();
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Split off a key range -
+				Moves every element whose key is not less than k into x, whose previous content is destroyed. Splitting a map into itself leaves it unchanged.
+				The tree is split before the first key not less than k, found by comparing keys only: whole subtrees change owner in O(log n), and no element is copied or reallocated, so iterators to the moved elements remain valid and now belong to x.
+			-------------------------------------------------------------------------------- */
+			void									split_off(const key_type& k, map& x)
+			{
+				if (&x == this)
+					return;
+
+				x.clear();
+				_tree.split(_key_lower_bound(_tree, k), x._tree);
+				x._size = x._tree.size();
+				_size -= x._size;
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Splice a key range -
+				Moves the elements of x whose key is in [lo, hi) into this map, without copying or reallocating them.
+				x is split twice and its two outer parts joined back, in O(log n). When no key of this map falls between the first and the last moved keys, as when key ranges are handed over between shards, the range is joined into this map as a whole subtree in O(log n) as well.
+				Otherwise its nodes are relinked one at a time in O(log n) each, and the elements whose key is already in this map stay in x.
+			-------------------------------------------------------------------------------- */
+			void									splice_range(map& x, const key_type& lo, const key_type& hi)
+			{
+				tree_type	range(_val_comp);
+				tree_type	tail(_val_comp);
+
+				if (!_key_comp(lo, hi) || &x == this)
+					return;
+
+				x._tree.split(_key_lower_bound(x._tree, lo), range);
+				range.split(_key_lower_bound(range, hi), tail);
+				x._tree.join(tail);
+				x._size -= range.size();
+
+				if (!range.size())
+					return;
+
+				tree_node*	pos = _key_lower_bound(_tree, range.get_begin()->get_value().first);
+
+				if (pos == _tree.get_end() || _key_comp(range.get_end()->reverse_iterate()->get_value().first, pos->get_value().first))
+				{
+					_size += range.size();
+					_tree.split(pos, tail);
+					_tree.join(range);
+					_tree.join(tail);
+					return;
+				}
+
+				while (range.get_root())
+				{
+					tree_node*	node = range.get_begin();
+
+					range.unlink(node);
+					if (_tree.insert_node(node).second)
+						_size++;
+					else
+					{
+						x._tree.insert_node(node);
+						x._size++;
+					}
+				}
+
+				return;
+			}
+
 
 			/* --- Observers --- */
 
@@ -522,6 +707,38 @@ namespace ft
 				return (static_cast<const_iterator>(_tree.search(val)));
 			}
 
+			/* --------------------------------------------------------------------------------
+			- Get iterators to many elements -
+				Looks up every key in [first, last] and writes to out, in the same order, an iterator to the element with that key or map::end, as if by find.
+				The keys are sorted first, and the tree is searched for all of them in a single walk (see red_black_tree::search_batch): the nodes shared by several keys are visited once, and the descents of different keys overlap their cache misses.
+				Duplicate keys are allowed, and keys already in order are sorted in linear time.
+
+			Returns the output iterator past the last iterator written.
+			-------------------------------------------------------------------------------- */
+			template<class InputIterator, class OutputIterator>
+			OutputIterator							find_batch(InputIterator first, InputIterator last, OutputIterator out)
+			{
+				vector<tree_node*>	found;
+
+				_find_batch(first, last, found);
+				for (size_type i = 0; i < found.size(); i++)
+					*out++ = iterator(found[i]);
+
+				return (out);
+			}
+
+			template<class InputIterator, class OutputIterator>
+			OutputIterator							find_batch(InputIterator first, InputIterator last, OutputIterator out) const
+			{
+				vector<tree_node*>	found;
+
+				_find_batch(first, last, found);
+				for (size_type i = 0; i < found.size(); i++)
+					*out++ = const_iterator(reinterpret_cast<typename tree_type::node_const_type*>(found[i]));
+
+				return (out);
+			}
+
 			/* --------------------------------------------------------------------------------
 			- Count elements with a specific key -
 				Searches the container for elements with a key equivalent to k and returns the number of matches.
@@ -636,6 +853,33 @@ namespace ft
 				return (pair<iterator, iterator>(_tree.search_lower_bound(val), _tree.search_upper_bound(val)));
 			}
 
+			/* --------------------------------------------------------------------------------
+			- Aggregate of a range of keys -
+				Returns the aggregate, as defined by the Aggregate policy, of every element whose key is in [lo, hi), combined in key order.
+				The tree keeps the aggregate of every subtree up to date, so the query runs in O(log n) instead of visiting the elements of the range.
+			-------------------------------------------------------------------------------- */
+			aggregate_type							aggregate(const key_type& lo, const key_type& hi) const
+				{return (_tree.aggregate(value_type(lo, mapped_type()), value_type(hi, mapped_type())));}
+
+			/* --------------------------------------------------------------------------------
+			- Aggregate of the whole map -
+				Returns the aggregate of every element of the map, stored at the root, in O(1).
+			-------------------------------------------------------------------------------- */
+			aggregate_type							aggregate() const
+				{return (_tree.aggregate());}
+
+			/* --------------------------------------------------------------------------------
+			- Refresh aggregates -
+				Recomputes the aggregates on the path from position to the root.
+				Insertions and erasures keep them up to date, but a mapped value changed through operator[], an iterator or a reference is not seen: call refresh on its position afterwards, or use insert_or_assign.
+			-------------------------------------------------------------------------------- */
+			void									refresh(iterator position)
+			{
+				_tree.refresh(position.base());
+
+				return;
+			}
+
 
 			/* --- Allocator --- */
 
@@ -648,31 +892,98 @@ namespace ft
 			allocator_type							get_allocator() const
 				{return (allocator_type());}
 
+		private:
+			/* --------------------------------------------------------------------------------
+			- Key lower bound -
+				Returns the first node of tree whose key is not less than k, or its end node, comparing keys only so that no value has to be built around k.
+			-------------------------------------------------------------------------------- */
+			tree_node*								_key_lower_bound(tree_type& tree, const key_type& k) const
+			{
+				tree_node*	node = tree.get_root();
+				tree_node*	bound = tree.get_end();
+
+				while (node)
+				{
+					if (_key_comp(node->get_value().first, k))
+						node = node->get_right();
+					else
+					{
+						bound = node;
+						node = node->get_left();
+					}
+				}
+
+				return (bound);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Probe order -
+				Orders pointers to probe values by the keys they point to.
+			-------------------------------------------------------------------------------- */
+			struct	_probe_less
+			{
+				value_compare	comp;
+
+				_probe_less(const value_compare& c) : comp(c)
+					{return;}
+
+				bool	operator()(const value_type* x, const value_type* y) const
+					{return (comp(*x, *y));}
+			};
+
+			/* --------------------------------------------------------------------------------
+			- Batch lookup -
+				Copies the keys into probe values, sorts pointers to them, searches the tree for the sorted probes, and puts each node found back at the position of its key in found.
+			-------------------------------------------------------------------------------- */
+			template<class InputIterator>
+			void									_find_batch(InputIterator first, InputIterator last, vector<tree_node*>& found) const
+			{
+				vector<value_type>			probes;
+				vector<const value_type*>	sorted;
+				vector<tree_node*>			nodes;
+
+				for (; first != last; first++)
+					probes.push_back(value_type(*first, mapped_type()));
+				if (probes.empty())
+					return;
+
+				sorted.reserve(probes.size());
+				for (size_type i = 0; i < probes.size(); i++)
+					sorted.push_back(&probes[i]);
+				ft::stable_sort(sorted.begin(), sorted.end(), _probe_less(_val_comp));
+				nodes.resize(probes.size());
+				found.resize(probes.size());
+				_tree.search_batch(&sorted[0], sorted.size(), &nodes[0]);
+				for (size_type i = 0; i < sorted.size(); i++)
+					found[sorted[i] - &probes[0]] = nodes[i];
+
+				return;
+			}
 	};
 	/* ----- NON-MEMBER OPERATOR OVERLOADS ----- */
 
-	template<typename Key, typename T, typename Compare, typename Alloc>
-	bool	operator==(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs)
-		{return (equal(lhs.begin(), lhs.end(), rhs.begin()) && lhs.size() == rhs.size());}
+	template<typename Key, typename T, typename Compare, typename Alloc, typename Aggregate>
+	bool	operator==(const map<Key, T, Compare, Alloc, Aggregate>& lhs, const map<Key, T, Compare, Alloc, Aggregate>& rhs)
+		{return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));}
 
-	template<typename Key, typename T, typename Compare, typename Alloc>
-	bool	operator<(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs)
-		{return (lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));}
+	template<typename Key, typename T, typename Compare, typename Alloc, typename Aggregate>
+	bool	operator<(const map<Key, T, Compare, Alloc, Aggregate>& lhs, const map<Key, T, Compare, Alloc, Aggregate>& rhs)
+		{return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));}
 
-	template<typename Key, typename T, typename Compare, typename Alloc>
-	bool	operator!=(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs)
+	template<typename Key, typename T, typename Compare, typename Alloc, typename Aggregate>
+	bool	operator!=(const map<Key, T, Compare, Alloc, Aggregate>& lhs, const map<Key, T, Compare, Alloc, Aggregate>& rhs)
 		{return (!(lhs == rhs));}
 
-	template<typename Key, typename T, typename Compare, typename Alloc>
-	bool	operator>(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs)
+	template<typename Key, typename T, typename Compare, typename Alloc, typename Aggregate>
+	bool	operator>(const map<Key, T, Compare, Alloc, Aggregate>& lhs, const map<Key, T, Compare, Alloc, Aggregate>& rhs)
 		{return (rhs < lhs);}
 
-	template<typename Key, typename T, typename Compare, typename Alloc>
-	bool	operator<=(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs)
+	template<typename Key, typename T, typename Compare, typename Alloc, typename Aggregate>
+	bool	operator<=(const map<Key, T, Compare, Alloc, Aggregate>& lhs, const map<Key, T, Compare, Alloc, Aggregate>& rhs)
 		{return (!(rhs < lhs));}
 
-	template<typename Key, typename T, typename Compare, typename Alloc>
-	bool	operator>=(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs)
+	template<typename Key, typename T, typename Compare, typename Alloc, typename Aggregate>
+	bool	operator>=(const map<Key, T, Compare, Alloc, Aggregate>& lhs, const map<Key, T, Compare, Alloc, Aggregate>& rhs)
 		{return (!(lhs < rhs));}
 }
 
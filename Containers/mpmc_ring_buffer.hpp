@@ -0,0 +1,395 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mpmc_ring_buffer.hpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:06:26 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 10:06:26 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MPMC_RING_BUFFER_HPP
+# define MPMC_RING_BUFFER_HPP
+
+# include <cstddef>		// size_t, ptrdiff_t
+# include <memory>		// std::allocator
+# include <sched.h>		// sched_yield
+
+# include "ring_buffer.hpp"
+# include "../Others/prefetch.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Multi-producer multi-consumer ring buffer -
+		Bounded queue that any number of threads may push to and pop from at the same time, without a lock: a push claims the next position by moving the tail with a compare-and-swap, a pop the oldest by moving the head.
+		Each slot carries a sequence number that says which position it is ready for: equal to the position when it is free for the push that claimed it, to the position plus one once that push has written it, and to the position plus the capacity once the pop has read it, which frees it for the next lap. A push or a pop only claims a position whose slot is ready, so that push returns false when the buffer is full, pop when it is empty, and neither waits for another thread.
+		The head and the tail are on cache lines of their own, so that producers and consumers only contend among themselves.
+		push_n and pop_n claim a whole batch with one compare-and-swap, then wait for each slot of the batch that a pop or a push of the previous lap, claimed but descheduled, has not released yet.
+	-------------------------------------------------------------------------------- */
+	template<class T, class Alloc = std::allocator<T> >
+	class mpmc_ring_buffer
+	{
+		public:
+			typedef T													value_type;
+			typedef Alloc												allocator_type;
+			typedef size_t												size_type;
+
+		private:
+			/* full is false in a slot whose push threw, for the pop that claimed it to try again. */
+			struct	_cell
+			{
+				size_type		seq;
+				bool			full;
+				value_type		value;
+			};
+
+			typedef typename	Alloc::template rebind<_cell>::other	cell_allocator;
+
+			_cell*				_cells;
+			size_type			_mask;
+			allocator_type		_alloc;
+			cell_allocator		_cell_alloc;
+			char				_pad0[FT_CACHE_LINE];
+			size_type			_tail;
+			char				_pad1[FT_CACHE_LINE - sizeof(size_type)];
+			size_type			_head;
+			char				_pad2[FT_CACHE_LINE - sizeof(size_type)];
+
+			mpmc_ring_buffer(const mpmc_ring_buffer&);
+			mpmc_ring_buffer&	operator=(const mpmc_ring_buffer&);
+
+		public:
+			/* ----- CONSTRUCTOR AND DESTRUCTOR ----- */
+
+			/* --------------------------------------------------------------------------------
+			- Constructor -
+				Holds at most capacity elements, rounded up to a power of two.
+			-------------------------------------------------------------------------------- */
+			explicit mpmc_ring_buffer(size_type capacity) : _cells(NULL), _mask(ring_capacity(capacity) - 1), _alloc(), _cell_alloc(), _tail(0), _head(0)
+			{
+				_cells = _cell_alloc.allocate(_mask + 1);
+				for (size_type i = 0; i <= _mask; i++)
+				{
+					_cells[i].seq = i;
+					_cells[i].full = false;
+				}
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Destructor -
+				No other thread may still use the buffer.
+			-------------------------------------------------------------------------------- */
+			~mpmc_ring_buffer()
+			{
+				for (; _head != _tail; _head++)
+				{
+					if (_cells[_head & _mask].full)
+						_alloc.destroy(&_cells[_head & _mask].value);
+				}
+				_cell_alloc.deallocate(_cells, _mask + 1);
+
+				return;
+			}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			/* --------------------------------------------------------------------------------
+			- Return size -
+				Counts the claimed positions, some of which may still be being written or read.
+			-------------------------------------------------------------------------------- */
+			size_type				size() const
+			{
+				size_type	head = __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+				ptrdiff_t	size = __atomic_load_n(&_tail, __ATOMIC_ACQUIRE) - head;
+
+				if (size < 0)
+					return (0);
+
+				return (static_cast<size_type>(size) > _mask ? _mask + 1 : static_cast<size_type>(size));
+			}
+
+			bool					empty() const
+				{return (!size());}
+
+			size_type				capacity() const
+				{return (_mask + 1);}
+
+			/* --------------------------------------------------------------------------------
+			- Insert element -
+				Returns false, leaving the buffer unchanged, if it is full.
+			-------------------------------------------------------------------------------- */
+			bool					push(const value_type& val)
+			{
+				size_type	pos = __atomic_load_n(&_tail, __ATOMIC_RELAXED);
+				_cell*		cell;
+
+				while (true)
+				{
+					cell = _cells + (pos & _mask);
+
+					ptrdiff_t	diff = __atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE) - pos;
+
+					if (!diff)
+					{
+						if (__atomic_compare_exchange_n(&_tail, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+							break;
+					}
+					else if (diff < 0)
+						return (false);
+					else
+						pos = __atomic_load_n(&_tail, __ATOMIC_RELAXED);
+				}
+				_fill(cell, pos, val);
+
+				return (true);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert elements -
+				Pushes as many of the n elements from first as there is room for, in order, and returns how many; the batch is contiguous, no other push comes between.
+				If copying an element throws, the ones before it are pushed.
+			-------------------------------------------------------------------------------- */
+			template<class InputIterator>
+			size_type				push_n(InputIterator first, size_type n)
+			{
+				size_type	pos = __atomic_load_n(&_tail, __ATOMIC_RELAXED);
+				size_type	count;
+
+				do
+				{
+					ptrdiff_t	used = pos - __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+
+					if (used < 0)
+						used = 0;
+					count = _mask + 1 - used;
+					if (count > n)
+						count = n;
+					if (!count)
+						return (0);
+				}
+				while (!__atomic_compare_exchange_n(&_tail, &pos, pos + count, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+				size_type	i = 0;
+
+				try
+				{
+					for (; i < count; i++, ++first)
+						_fill(_wait(pos + i, 0), pos + i, *first);
+				}
+				catch (...)
+				{
+					while (++i < count)
+						_publish(_wait(pos + i, 0), pos + i, false);
+					throw;
+				}
+
+				return (count);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Remove next element -
+				Moves the oldest element into val and returns true, or returns false if the buffer is empty.
+				If copying the element throws, it is lost.
+			-------------------------------------------------------------------------------- */
+			bool					pop(value_type& val)
+			{
+				size_type	pos;
+				_cell*		cell;
+
+				while ((cell = _claim_front(pos)))
+				{
+					if (cell->full)
+					{
+						_take(cell, pos, val);
+						return (true);
+					}
+					_release(cell, pos);
+				}
+
+				return (false);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Remove next element -
+				Drops the oldest element and returns true, or returns false if the buffer is empty.
+			-------------------------------------------------------------------------------- */
+			bool					pop()
+			{
+				size_type	pos;
+				_cell*		cell;
+
+				while ((cell = _claim_front(pos)))
+				{
+					if (_drop(cell, pos))
+						return (true);
+				}
+
+				return (false);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Remove elements -
+				Moves up to n of the oldest elements, in order, to out, and returns how many; the batch is contiguous, no other pop comes between.
+				If copying an element throws, it and the rest of the batch are lost.
+			-------------------------------------------------------------------------------- */
+			template<class OutputIterator>
+			size_type				pop_n(OutputIterator out, size_type n)
+			{
+				size_type	pos = __atomic_load_n(&_head, __ATOMIC_RELAXED);
+				size_type	claimed;
+
+				do
+				{
+					ptrdiff_t	ready = __atomic_load_n(&_tail, __ATOMIC_ACQUIRE) - pos;
+
+					if (ready <= 0)
+						return (0);
+					claimed = static_cast<size_type>(ready) < n ? static_cast<size_type>(ready) : n;
+				}
+				while (!__atomic_compare_exchange_n(&_head, &pos, pos + claimed, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+				size_type	count = 0;
+
+				for (size_type i = 0; i < claimed; i++)
+				{
+					_cell*	cell = _wait(pos + i, 1);
+
+					if (!cell->full)
+					{
+						_release(cell, pos + i);
+						continue;
+					}
+					try
+					{
+						*out = cell->value;
+					}
+					catch (...)
+					{
+						for (; i < claimed; i++)
+							_drop(_wait(pos + i, 1), pos + i);
+						throw;
+					}
+					_drop(cell, pos + i);
+					++out;
+					count++;
+				}
+
+				return (count);
+			}
+
+		private:
+			/* --------------------------------------------------------------------------------
+			- Claim oldest position -
+				Moves the head past the oldest written slot, setting pos to its position, and returns the slot, or returns NULL if no slot is written.
+			-------------------------------------------------------------------------------- */
+			_cell*					_claim_front(size_type& pos)
+			{
+				pos = __atomic_load_n(&_head, __ATOMIC_RELAXED);
+
+				while (true)
+				{
+					_cell*		cell = _cells + (pos & _mask);
+					ptrdiff_t	diff = __atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE) - (pos + 1);
+
+					if (!diff)
+					{
+						if (__atomic_compare_exchange_n(&_head, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+							return (cell);
+					}
+					else if (diff < 0)
+						return (NULL);
+					else
+						pos = __atomic_load_n(&_head, __ATOMIC_RELAXED);
+				}
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Wait for slot -
+				Yields until the slot of position pos is free (offset 0) or written (offset 1), and returns it.
+			-------------------------------------------------------------------------------- */
+			_cell*					_wait(size_type pos, size_type offset) const
+			{
+				_cell*	cell = _cells + (pos & _mask);
+
+				while (__atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE) != pos + offset)
+					sched_yield();
+
+				return (cell);
+			}
+
+			void					_fill(_cell* cell, size_type pos, const value_type& val)
+			{
+				try
+				{
+					_alloc.construct(&cell->value, val);
+				}
+				catch (...)
+				{
+					_publish(cell, pos, false);
+					throw;
+				}
+				_publish(cell, pos, true);
+
+				return;
+			}
+
+			void					_publish(_cell* cell, size_type pos, bool full)
+			{
+				cell->full = full;
+				__atomic_store_n(&cell->seq, pos + 1, __ATOMIC_RELEASE);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Take element -
+				Moves the element of a claimed slot into val and frees the slot, even if the copy throws.
+			-------------------------------------------------------------------------------- */
+			void					_take(_cell* cell, size_type pos, value_type& val)
+			{
+				try
+				{
+					val = cell->value;
+				}
+				catch (...)
+				{
+					_alloc.destroy(&cell->value);
+					_release(cell, pos);
+					throw;
+				}
+				_alloc.destroy(&cell->value);
+				_release(cell, pos);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Drop element -
+				Destroys the element of a claimed slot, if its push did not throw, and frees the slot.
+			-------------------------------------------------------------------------------- */
+			bool					_drop(_cell* cell, size_type pos)
+			{
+				bool	full = cell->full;
+
+				if (full)
+					_alloc.destroy(&cell->value);
+				_release(cell, pos);
+
+				return (full);
+			}
+
+			void					_release(_cell* cell, size_type pos)
+			{
+				__atomic_store_n(&cell->seq, pos + _mask + 1, __ATOMIC_RELEASE);
+				return;
+			}
+	};
+}
+
+#endif
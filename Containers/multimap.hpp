@@ -0,0 +1,601 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   multimap.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:50:30 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 11:10:39 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MULTIMAP_HPP
+# define MULTIMAP_HPP
+
+# include <cstddef>		// size_t
+# include <functional>	// std::less
+# include <memory>		// std::allocator
+
+# include "../Iterators/iterator_traits.hpp"
+# include "../Iterators/reverse_iterator.hpp"
+# include "../Iterators/tree_iterator.hpp"
+# include "../Others/algorithm.hpp"
+# include "../Others/pair.hpp"
+# include "../Others/red_black_node.hpp"
+# include "../Others/red_black_tree.hpp"
+
+namespace ft
+{
+	template<class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<pair<const Key, T> > >
+	class multimap
+	{
+		public:
+			typedef				Key																																key_type;
+			typedef				T																																mapped_type;
+			typedef				pair<const key_type, mapped_type>																								value_type;
+			typedef				Compare																															key_compare;
+			class																																				value_compare
+			{
+				friend class multimap<Key, T, Compare, Alloc>;
+				protected:
+					Compare comp;
+					value_compare(Compare c) : comp(c)
+						{return;}
+
+				public:
+					bool operator()(const value_type& x, const value_type& y) const
+						{return (comp(x.first, y.first));}
+			};
+			typedef				Alloc																															allocator_type;
+			typedef typename	allocator_type::reference																										reference;
+			typedef typename	allocator_type::const_reference																									const_reference;
+			typedef typename	allocator_type::pointer																											pointer;
+			typedef typename	allocator_type::const_pointer																									const_pointer;
+			typedef typename	ft::tree_iterator<value_type, value_compare, red_black_node<value_type, value_compare, no_aggregate<value_type> > >				iterator;
+			typedef typename	ft::tree_iterator<const value_type, value_compare, red_black_node<const value_type, value_compare, no_aggregate<value_type> > >	const_iterator;
+			typedef typename	ft::reverse_iterator<iterator>																									reverse_iterator;
+			typedef typename	ft::reverse_iterator<const_iterator>																							const_reverse_iterator;
+			typedef typename	iterator_traits<iterator>::difference_type																						difference_type;
+			typedef				size_t																															size_type;
+
+		protected:
+			typedef				red_black_tree<value_type, Alloc, value_compare, no_aggregate<value_type> >														tree_type;
+			typedef typename	tree_type::node_type																											tree_node;
+
+			key_compare			_key_comp;
+			value_compare		_val_comp;
+			tree_type			_tree;
+			size_type			_size;
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTOR ----- */
+
+			/* --------------------------------------------------------------------------------
+			- Empty container constructor (default constructor) -
+				Constructs an empty container, with no elements.
+
+			Source: https://cplusplus.com/reference/map/multimap/multimap/
+			-------------------------------------------------------------------------------- */
+			explicit multimap(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _key_comp(comp), _val_comp(_key_comp), _tree(_val_comp), _size(0)
+			{
+				(void)alloc;
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Range constructor -
+				Constructs a container with as many elements as the range [first, last], with each element constructed from its corresponding element in that range.
+				The container keeps an internal copy of alloc and comp, which are used to allocate storage and to sort the elements throughout its lifetime.
+
+			Source: https://cplusplus.com/reference/map/multimap/multimap/
+			-------------------------------------------------------------------------------- */
+			template<class InputIterator>
+			multimap(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _key_comp(comp), _val_comp(_key_comp), _tree(_val_comp), _size(0)
+			{
+				(void)alloc;
+				insert(first, last);
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Copy constructor -
+				Constructs a container with a copy of each of the elements in x.
+				Creates a container that keeps and uses copies of x's allocator and comparison object.
+
+			Source: https://cplusplus.com/reference/map/multimap/multimap/
+			-------------------------------------------------------------------------------- */
+			multimap(const multimap& x) : _key_comp(x._key_comp), _val_comp(_key_comp), _tree(_val_comp), _size(x.size())
+			{
+				_tree = x._tree;
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Map destructor -
+				Destroys the container object.
+				This destroys all container elements, and deallocates all the storage capacity allocated by the multimap container using its allocator.
+
+			Source: https://cplusplus.com/reference/map/multimap/~multimap/
+			-------------------------------------------------------------------------------- */
+			~multimap()
+				{return;}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			/* --- Operator overloads --- */
+
+			/* --------------------------------------------------------------------------------
+			- Copy container content -
+				Assigns new contents to the container, replacing its current content.
+				Copies all the elements from x into the container, changing its size accordingly.
+				The container preserves its current allocator, which is used to allocate additional storage if needed, and takes a copy of the comparison object of x.
+				The elements stored in the container before the call are either assigned to or destroyed.
+
+			Source: https://cplusplus.com/reference/map/multimap/operator=/
+			-------------------------------------------------------------------------------- */
+			multimap&									operator=(const multimap& x)
+			{
+				_key_comp = x._key_comp;
+				_val_comp = x._val_comp;
+				_tree = x._tree;
+				_size = x._size;
+
+				return (*this);
+			}
+
+
+			/* --- Iterators --- */
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to beginning -
+				Returns an iterator referring to the first element in the multimap container.
+				Because multimap containers keep their elements ordered at all times, begin points to the element that goes first following the container's sorting criterion.
+				If the container is empty, the returned iterator value shall not be dereferenced.
+
+			Source: https://cplusplus.com/reference/map/multimap/begin/
+			-------------------------------------------------------------------------------- */
+			iterator								begin()
+				{return (iterator(_tree.get_begin()));}
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to beginning -
+				Returns an iterator referring to the first element in the multimap container.
+				Because multimap containers keep their elements ordered at all times, begin points to the element that goes first following the container's sorting criterion.
+				If the container is empty, the returned iterator value shall not be dereferenced.
+
+			Source: https://cplusplus.com/reference/map/multimap/begin/
+			-------------------------------------------------------------------------------- */
+			const_iterator							begin() const
+				{return (static_cast<const_iterator>(_tree.get_begin()));}
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to end -
+				Returns an iterator referring to the past-the-end element in the multimap container.
+				The past-the-end element is the theoretical element that would follow the last element in the multimap container. It does not point to any element, and thus shall not be dereferenced.
+				Because the ranges used by functions of the standard library do not include the element pointed by their closing iterator, this function is often used in combination with multimap::begin to specify a range including all the elements in the container.
+				If the container is empty, this function returns the same as multimap::begin.
+
+			Source: https://cplusplus.com/reference/map/multimap/end/
+			-------------------------------------------------------------------------------- */
+			iterator								end()
+				{return (iterator(_tree.get_end()));}
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to end -
+				Returns an iterator referring to the past-the-end element in the multimap container.
+				The past-the-end element is the theoretical element that would follow the last element in the multimap container. It does not point to any element, and thus shall not be dereferenced.
+				Because the ranges used by functions of the standard library do not include the element pointed by their closing iterator, this function is often used in combination with multimap::begin to specify a range including all the elements in the container.
+				If the container is empty, this function returns the same as multimap::begin.
+
+			Source: https://cplusplus.com/reference/map/multimap/end/
+			-------------------------------------------------------------------------------- */
+			const_iterator							end() const
+				{return (static_cast<const_iterator>(_tree.get_end()));}
+
+			/* --------------------------------------------------------------------------------
+			- Return reverse iterator to reverse beginning -
+				Returns a reverse iterator pointing to the last element in the container (i.e., its reverse beginning).
+				Reverse iterators iterate backwards: increasing them moves them towards the beginning of the container.
+				rbegin points to the element preceding the one that would be pointed to by member end.
+
+			Source: https://cplusplus.com/reference/map/multimap/rbegin/
+			-------------------------------------------------------------------------------- */
+			reverse_iterator						rbegin()
+				{return (reverse_iterator(_tree.get_end()));}
+
+			/* --------------------------------------------------------------------------------
+			- Return reverse iterator to reverse beginning -
+				Returns a reverse iterator pointing to the last element in the container (i.e., its reverse beginning).
+				Reverse iterators iterate backwards: increasing them moves them towards the beginning of the container.
+				rbegin points to the element preceding the one that would be pointed to by member end.
+
+			Source: https://cplusplus.com/reference/map/multimap/rbegin/
+			-------------------------------------------------------------------------------- */
+			const_reverse_iterator					rbegin() const
+				{return (const_reverse_iterator(_tree.get_end()));}
+
+			/* --------------------------------------------------------------------------------
+			- Return reverse iterator to reverse end -
+				Returns a reverse iterator pointing to the theoretical element right before the first element in the multimap container (which is considered its reverse end).
+				The range between multimap::rbegin and multimap::rend contains all the elements of the container (in reverse order).
+
+			Source: https://cplusplus.com/reference/map/multimap/rend/
+			-------------------------------------------------------------------------------- */
+			reverse_iterator						rend()
+				{return (reverse_iterator(begin()));}
+
+			/* --------------------------------------------------------------------------------
+			- Return reverse iterator to reverse end -
+				Returns a reverse iterator pointing to the theoretical element right before the first element in the multimap container (which is considered its reverse end).
+				The range between multimap::rbegin and multimap::rend contains all the elements of the container (in reverse order).
+
+			Source: https://cplusplus.com/reference/map/multimap/rend/
+			-------------------------------------------------------------------------------- */
+			const_reverse_iterator					rend() const
+				{return (const_reverse_iterator(begin()));}
+
+
+			/* --- Capacity --- */
+
+			/* --------------------------------------------------------------------------------
+			- Test whether container is empty -
+				Returns whether the multimap container is empty (i.e. whether its size is 0).
+				This function does not modify the container in any way. To clear the content of a multimap container, see multimap::clear.
+
+			Source: https://cplusplus.com/reference/map/multimap/empty/
+			-------------------------------------------------------------------------------- */
+			bool									empty() const
+				{return (!_size);}
+
+			/* --------------------------------------------------------------------------------
+			- Return container size -
+				Returns the number of elements in the multimap container.
+
+			Source: https://cplusplus.com/reference/map/multimap/size/
+			-------------------------------------------------------------------------------- */
+			size_type								size() const
+				{return (_size);}
+
+			/* --------------------------------------------------------------------------------
+			- Return maximum size -
+				Returns the maximum number of elements that the multimap container can hold.
+				This is the maximum potential size the container can reach due to known system or library implementation limitations, but the container is by no means guaranteed to be able to reach that size: it can still fail to allocate storage at any point before that size is reached.
+
+			Source: https://cplusplus.com/reference/map/multimap/max_size/
+			-------------------------------------------------------------------------------- */
+			size_type								max_size() const
+				{return (_tree.get_alloc().max_size());}
+
+
+			/* --- Modifiers --- */
+
+			/* --------------------------------------------------------------------------------
+			- Insert element -
+				Extends the container by inserting val, effectively increasing the container size by one.
+				Elements with a key equivalent to the one of val are kept: val is inserted after all of them, so equivalent elements stay in insertion order.
+
+			Returns an iterator pointing to the newly inserted element.
+
+			Source: https://cplusplus.com/reference/map/multimap/insert/
+			-------------------------------------------------------------------------------- */
+			iterator								insert(const value_type& val)
+			{
+				_size++;
+
+				return (iterator(_tree.insert_equal(val)));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert element with hint -
+				When val can go right before position, it is linked there in amortized O(1) instead of being searched from the root.
+
+			Returns an iterator pointing to the newly inserted element.
+
+			Source: https://cplusplus.com/reference/map/multimap/insert/
+			-------------------------------------------------------------------------------- */
+			iterator								insert(iterator position, const value_type& val)
+			{
+				_size++;
+
+				return (iterator(_tree.insert_equal(val, position.base())));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert range -
+				Inserts a copy of each element of [first, last); a sorted range is linked at the end of the tree, in amortized O(1) per element, when it comes after every element already in the container.
+
+			Source: https://cplusplus.com/reference/map/multimap/insert/
+			-------------------------------------------------------------------------------- */
+			template<class InputIterator>
+			void									insert(InputIterator first, InputIterator last)
+			{
+				for (; first != last; first++)
+					insert(end(), *first);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase element -
+				Removes from the multimap container the element pointed to by position, and only that one among the elements with an equivalent key.
+
+			Source: https://cplusplus.com/reference/map/multimap/erase/
+			-------------------------------------------------------------------------------- */
+			void									erase(iterator position)
+			{
+				if (_tree.erase(position.base()))
+					_size--;
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase elements by key -
+				Removes every element with a key equivalent to k.
+
+			Returns the number of elements erased.
+
+			Source: https://cplusplus.com/reference/map/multimap/erase/
+			-------------------------------------------------------------------------------- */
+			size_type								erase(const key_type& k)
+			{
+				pair<iterator, iterator>	range = equal_range(k);
+				size_type					n = _size;
+
+				erase(range.first, range.second);
+
+				return (n - _size);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase range -
+				Removes from the multimap container the elements in [first, last), cut out of the tree by rank in O(k + log n) rather than one search per element.
+
+			Source: https://cplusplus.com/reference/map/multimap/erase/
+			-------------------------------------------------------------------------------- */
+			void									erase(iterator first, iterator last)
+			{
+				_size -= _tree.erase(first.base(), last.base());
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Swap content -
+				Exchanges the content of the container by the content of x, which is another multimap of the same type. Sizes may differ.
+				After the call to this member function, the elements in this container are those which were in x before the call, and the elements of x are those which were in this. All iterators, references and pointers remain valid for the swapped objects.
+				Notice that a non-member function exists with the same name, swap, overloading that algorithm with an optimization that behaves like this member function.
+
+			Source: https://cplusplus.com/reference/map/multimap/swap/
+			-------------------------------------------------------------------------------- */
+			void									swap(multimap& x)
+			{
+				_tree.swap_content(x._tree);
+
+				size_type	tmp = x._size;
+
+				x._size = _size;
+				_size = tmp;
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Clear content -
+				Removes all elements from the multimap container (which are destroyed), leaving the container with a size of 0.
+
+			Source: https://cplusplus.com/reference/map/multimap/clear/
+			-------------------------------------------------------------------------------- */
+			void									clear()
+			{
+				_tree.clear();
+				_size = 0;
+
+				return;
+			}
+
+
+			/* --- Observers --- */
+
+			/* --------------------------------------------------------------------------------
+			- Return key comparison object -
+				Returns a copy of the comparison object used by the container to compare keys.
+				The comparison object of a multimap object is set on construction. Its type (member key_compare) is the third template parameter of the multimap template. By default, this is a less object, which returns the same as operator<.
+				This object determines the order of the elements in the container: it is a function pointer or a function object that takes two arguments of the same type as the element keys, and returns true if the first argument is considered to go before the second in the strict weak ordering it defines, and false otherwise.
+				Two keys are considered equivalent if key_comp returns false reflexively (i.e., no matter the order in which the keys are passed as arguments).
+
+			Source: https://cplusplus.com/reference/map/multimap/key_comp/
+			-------------------------------------------------------------------------------- */
+			key_compare								key_comp() const
+				{return (_key_comp);}
+
+			/* --------------------------------------------------------------------------------
+			Return value comparison object
+				Returns a comparison object that can be used to compare two elements to get whether the key of the first one goes before the second.
+				The arguments taken by this function object are of member type value_type (defined in multimap as an alias of pair<const key_type,mapped_type>), but the mapped_type part of the value is not taken into consideration in this comparison.
+				The comparison object returned is an object of the member type multimap::value_compare, which is a nested class that uses the internal comparison object to generate the appropriate comparison functional class.
+				The public member of this comparison class returns true if the key of the first argument is considered to go before that of the second (according to the strict weak ordering specified by the container's comparison object, key_comp), and false otherwise.
+				Notice that value_compare has no public constructor, therefore no objects can be directly created from this nested class outside multimap members.
+
+			Source: https://cplusplus.com/reference/map/multimap/
+			-------------------------------------------------------------------------------- */
+			value_compare							value_comp() const
+				{return (_val_comp);}
+
+			/* --- Operations --- */
+
+			/* --------------------------------------------------------------------------------
+			- Get iterator to element -
+				Searches the container for an element with a key equivalent to k and returns an iterator to the first of them if found, otherwise it returns an iterator to multimap::end.
+				Two keys are considered equivalent if the container's comparison object returns false reflexively (i.e., no matter the order in which the elements are passed as arguments).
+
+			Source: https://cplusplus.com/reference/map/multimap/find/
+			-------------------------------------------------------------------------------- */
+			iterator								find(const key_type& k)
+			{
+				value_type	val(k, mapped_type());
+
+				return (iterator(_tree.search(val)));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Get iterator to element -
+				Searches the container for an element with a key equivalent to k and returns an iterator to the first of them if found, otherwise it returns an iterator to multimap::end.
+				Two keys are considered equivalent if the container's comparison object returns false reflexively (i.e., no matter the order in which the elements are passed as arguments).
+
+			Source: https://cplusplus.com/reference/map/multimap/find/
+			-------------------------------------------------------------------------------- */
+			const_iterator							find(const key_type& k) const
+			{
+				value_type	val(k, mapped_type());
+
+				return (static_cast<const_iterator>(_tree.search(val)));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Count elements with a specific key -
+				Searches the container for elements with a key equivalent to k and returns the number of matches.
+				Both ends of the range are ranked with the subtree counts, in O(log n) whatever the number of matches.
+
+			Source: https://cplusplus.com/reference/map/multimap/count/
+			-------------------------------------------------------------------------------- */
+			size_type								count(const key_type& k) const
+				{return (ft::distance(lower_bound(k), upper_bound(k)));}
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to lower bound -
+				Returns an iterator pointing to the first element in the container whose key is not considered to go before k (i.e., either it is equivalent or goes after).
+				The function uses its internal comparison object (_key_comp) to determine this, returning an iterator to the first element for which key_comp(elementkey,k) would return false.
+				If the multimap class is instantiated with the default comparison type (less), the function returns an iterator to the first element whose key is not less than k.
+				A similar member function, upper_bound, has the same behavior as lower_bound, except in the case that the multimap contains an element with a key equivalent to k: In this case, lower_bound returns an iterator pointing to that element, whereas upper_bound returns an iterator pointing to the next element.
+
+			Source: https://cplusplus.com/reference/map/multimap/lower_bound/
+			-------------------------------------------------------------------------------- */
+			iterator								lower_bound(const key_type& k)
+			{
+				value_type	val(k, mapped_type());
+
+				return (iterator(_tree.search_lower_bound(val)));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to lower bound -
+				Returns an iterator pointing to the first element in the container whose key is not considered to go before k (i.e., either it is equivalent or goes after).
+				The function uses its internal comparison object (_key_comp) to determine this, returning an iterator to the first element for which key_comp(elementkey, k) would return false.
+				If the multimap class is instantiated with the default comparison type (less), the function returns an iterator to the first element whose key is not less than k.
+				A similar member function, upper_bound, has the same behavior as lower_bound, except in the case that the multimap contains an element with a key equivalent to k: In this case, lower_bound returns an iterator pointing to that element, whereas upper_bound returns an iterator pointing to the next element.
+
+			Source: https://cplusplus.com/reference/map/multimap/lower_bound/
+			-------------------------------------------------------------------------------- */
+			const_iterator							lower_bound(const key_type& k) const
+			{
+				value_type	val(k, mapped_type());
+
+				return (static_cast<const_iterator>(_tree.search_lower_bound(val)));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to upper bound -
+				Returns an iterator pointing to the first element in the container whose key is considered to go after k.
+				The function uses its internal comparison object (_key_comp) to determine this, returning an iterator to the first element for which key_comp(k, elementkey) would return true.
+				If the multimap class is instantiated with the default comparison type (less), the function returns an iterator to the first element whose key is greater than k.
+				A similar member function, lower_bound, has the same behavior as upper_bound, except in the case that the multimap contains an element with a key equivalent to k: In this case lower_bound returns an iterator pointing to that element, whereas upper_bound returns an iterator pointing to the next element.
+
+			Source: https://cplusplus.com/reference/map/multimap/upper_bound/
+			-------------------------------------------------------------------------------- */
+			iterator								upper_bound(const key_type& k)
+			{
+				value_type	val(k, mapped_type());
+
+				return (iterator(_tree.search_upper_bound(val)));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to upper bound -
+				Returns an iterator pointing to the first element in the container whose key is considered to go after k.
+				The function uses its internal comparison object (_key_comp) to determine this, returning an iterator to the first element for which key_comp(k,elementkey) would return true.
+				If the multimap class is instantiated with the default comparison type (less), the function returns an iterator to the first element whose key is greater than k.
+				A similar member function, lower_bound, has the same behavior as upper_bound, except in the case that the multimap contains an element with a key equivalent to k: In this case lower_bound returns an iterator pointing to that element, whereas upper_bound returns an iterator pointing to the next element.
+
+			Source: https://cplusplus.com/reference/map/multimap/upper_bound/
+			-------------------------------------------------------------------------------- */
+			const_iterator							upper_bound(const key_type& k) const
+			{
+				value_type	val(k, mapped_type());
+
+				return (static_cast<const_iterator>(_tree.search_upper_bound(val)));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Get range of equal elements -
+				Returns the bounds of a range that includes all the elements in the container which have a key equivalent to k.
+				If no matches are found, the range returned has a length of zero, with both iterators pointing to the first element that has a key considered to go after k according to the container's internal comparison object (_key_comp).
+				Two keys are considered equivalent if the container's comparison object returns false reflexively (i.e., no matter the order in which the keys are passed as arguments).
+
+			Source: https://cplusplus.com/reference/map/multimap/equal_range/
+			-------------------------------------------------------------------------------- */
+			pair<const_iterator, const_iterator>	equal_range(const key_type& k) const
+			{
+				value_type	val(k, mapped_type());
+
+				return (pair<const_iterator, const_iterator>(_tree.search_lower_bound(val), _tree.search_upper_bound(val)));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Get range of equal elements -
+				Returns the bounds of a range that includes all the elements in the container which have a key equivalent to k.
+				If no matches are found, the range returned has a length of zero, with both iterators pointing to the first element that has a key considered to go after k according to the container's internal comparison object (_key_comp).
+				Two keys are considered equivalent if the container's comparison object returns false reflexively (i.e., no matter the order in which the keys are passed as arguments).
+
+			Source: https://cplusplus.com/reference/map/multimap/equal_range/
+			-------------------------------------------------------------------------------- */
+			pair<iterator, iterator>				equal_range(const key_type& k)
+			{
+				value_type	val(k, mapped_type());
+
+				return (pair<iterator, iterator>(_tree.search_lower_bound(val), _tree.search_upper_bound(val)));
+			}
+
+
+			/* --- Allocator --- */
+
+			/* --------------------------------------------------------------------------------
+			- Get allocator -
+				Returns a copy of the allocator object associated with the multimap.
+
+			Source: https://cplusplus.com/reference/map/multimap/get_allocator/
+			-------------------------------------------------------------------------------- */
+			allocator_type							get_allocator() const
+				{return (allocator_type());}
+
+	};
+	/* ----- NON-MEMBER OPERATOR OVERLOADS ----- */
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator==(const multimap<Key, T, Compare, Alloc>& lhs, const multimap<Key, T, Compare, Alloc>& rhs)
+		{return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator<(const multimap<Key, T, Compare, Alloc>& lhs, const multimap<Key, T, Compare, Alloc>& rhs)
+		{return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator!=(const multimap<Key, T, Compare, Alloc>& lhs, const multimap<Key, T, Compare, Alloc>& rhs)
+		{return (!(lhs == rhs));}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator>(const multimap<Key, T, Compare, Alloc>& lhs, const multimap<Key, T, Compare, Alloc>& rhs)
+		{return (rhs < lhs);}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator<=(const multimap<Key, T, Compare, Alloc>& lhs, const multimap<Key, T, Compare, Alloc>& rhs)
+		{return (!(rhs < lhs));}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator>=(const multimap<Key, T, Compare, Alloc>& lhs, const multimap<Key, T, Compare, Alloc>& rhs)
+		{return (!(lhs < rhs));}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,449 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   multiset.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:50:07 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 11:10:39 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MULTISET_HPP
+# define MULTISET_HPP
+
+# include <cstddef>		// size_t
+# include <functional>	// std::less
+# include <memory>		// std::allocator
+
+# include "../Iterators/iterator_traits.hpp"
+# include "../Iterators/reverse_iterator.hpp"
+# include "../Iterators/tree_iterator.hpp"
+# include "../Others/aggregate.hpp"
+# include "../Others/algorithm.hpp"
+# include "../Others/pair.hpp"
+# include "../Others/red_black_node.hpp"
+# include "../Others/red_black_tree.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Multiset -
+		Multisets are containers that store elements following a specific order, and where multiple elements can have equivalent values.
+		Like set, the tree stores the keys alone; elements are inserted with the tree's duplicate-allowing insertion, after every element equivalent to them.
+
+	Source: https://cplusplus.com/reference/set/multiset/
+	-------------------------------------------------------------------------------- */
+	template<class T, class Compare = std::less<T>, class Alloc = std::allocator<T> >
+	class multiset
+	{
+		public:
+			typedef				T																																key_type;
+			typedef				T																																value_type;
+			typedef				Compare																															key_compare;
+			typedef				Compare																															value_compare;
+			typedef				Alloc																															allocator_type;
+			typedef typename	allocator_type::reference																										reference;
+			typedef typename	allocator_type::const_reference																									const_reference;
+			typedef typename	allocator_type::pointer																											pointer;
+			typedef typename	allocator_type::const_pointer																									const_pointer;
+			typedef typename	ft::tree_iterator<const value_type, value_compare, red_black_node<const value_type, value_compare, no_aggregate<value_type> > >	iterator;
+			typedef typename	ft::tree_iterator<const value_type, value_compare, red_black_node<const value_type, value_compare, no_aggregate<value_type> > >	const_iterator;
+			typedef typename	ft::reverse_iterator<iterator>																									reverse_iterator;
+			typedef typename	ft::reverse_iterator<const_iterator>																							const_reverse_iterator;
+			typedef typename	iterator_traits<iterator>::difference_type																						difference_type;
+			typedef				size_t																															size_type;
+
+		protected:
+			typedef				red_black_tree<value_type, Alloc, value_compare>	tree_type;
+			typedef typename	tree_type::node_type								tree_node;
+			typedef typename	tree_type::node_const_type							tree_const_node;
+
+			key_compare			_key_comp;
+			tree_type			_tree;
+			size_type			_size;
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTOR ----- */
+
+			/* --------------------------------------------------------------------------------
+			- Empty container constructor (default constructor) -
+				Constructs an empty container, with no elements.
+
+			Source: https://cplusplus.com/reference/set/multiset/multiset/
+			-------------------------------------------------------------------------------- */
+			explicit multiset(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _key_comp(comp), _tree(_key_comp), _size(0)
+			{
+				(void)alloc;
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Range constructor -
+				Constructs a container with as many elements as the range [first, last], with each element constructed from its corresponding element in that range.
+
+			Source: https://cplusplus.com/reference/set/multiset/multiset/
+			-------------------------------------------------------------------------------- */
+			template<class InputIterator>
+			multiset(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _key_comp(comp), _tree(_key_comp), _size(0)
+			{
+				(void)alloc;
+				insert(first, last);
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Copy constructor -
+				Constructs a container with a copy of each of the elements in x.
+				The copied tree compares with this container's own comparison object.
+
+			Source: https://cplusplus.com/reference/set/multiset/multiset/
+			-------------------------------------------------------------------------------- */
+			multiset(const multiset& x) : _key_comp(x._key_comp), _tree(_key_comp), _size(x._size)
+			{
+				_tree = x._tree;
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Set destructor -
+				Destroys the container object.
+
+			Source: https://cplusplus.com/reference/set/multiset/~multiset/
+			-------------------------------------------------------------------------------- */
+			~multiset()
+				{return;}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			/* --- Operator overloads --- */
+
+			/* --------------------------------------------------------------------------------
+			- Copy container content -
+				Assigns new contents to the container, replacing its current content, and takes a copy of the comparison object of x.
+
+			Source: https://cplusplus.com/reference/set/multiset/operator=/
+			-------------------------------------------------------------------------------- */
+			multiset&								operator=(const multiset& x)
+			{
+				_key_comp = x._key_comp;
+				_tree = x._tree;
+				_size = x._size;
+
+				return (*this);
+			}
+
+
+			/* --- Iterators --- */
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to beginning -
+				Returns an iterator referring to the first element in the multiset container.
+				If the container is empty, the returned iterator value shall not be dereferenced.
+
+			Source: https://cplusplus.com/reference/set/multiset/begin/
+			-------------------------------------------------------------------------------- */
+			iterator								begin() const
+				{return (iterator(_tree.get_begin()));}
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to end -
+				Returns an iterator referring to the past-the-end element in the multiset container.
+
+			Source: https://cplusplus.com/reference/set/multiset/end/
+			-------------------------------------------------------------------------------- */
+			iterator								end() const
+				{return (iterator(_tree.get_end()));}
+
+			/* --------------------------------------------------------------------------------
+			- Return reverse iterator to reverse beginning -
+				Returns a reverse iterator pointing to the last element in the container (i.e., its reverse beginning).
+
+			Source: https://cplusplus.com/reference/set/multiset/rbegin/
+			-------------------------------------------------------------------------------- */
+			reverse_iterator						rbegin() const
+				{return (reverse_iterator(end()));}
+
+			/* --------------------------------------------------------------------------------
+			- Return reverse iterator to reverse end -
+				Returns a reverse iterator pointing to the theoretical element right before the first element in the multiset container (which is considered its reverse end).
+
+			Source: https://cplusplus.com/reference/set/multiset/rend/
+			-------------------------------------------------------------------------------- */
+			reverse_iterator						rend() const
+				{return (reverse_iterator(begin()));}
+
+
+			/* --- Capacity --- */
+
+			/* --------------------------------------------------------------------------------
+			- Test whether container is empty -
+				Returns whether the multiset container is empty (i.e. whether its size is 0).
+
+			Source: https://cplusplus.com/reference/set/multiset/empty/
+			-------------------------------------------------------------------------------- */
+			bool									empty() const
+				{return (!_size);}
+
+			/* --------------------------------------------------------------------------------
+			- Return container size -
+				Returns the number of elements in the multiset container.
+
+			Source: https://cplusplus.com/reference/set/multiset/size/
+			-------------------------------------------------------------------------------- */
+			size_type								size() const
+				{return (_size);}
+
+			/* --------------------------------------------------------------------------------
+			- Return maximum size -
+				Returns the maximum number of elements that the multiset container can hold.
+
+			Source: https://cplusplus.com/reference/set/multiset/max_size/
+			-------------------------------------------------------------------------------- */
+			size_type								max_size() const
+				{return (_tree.get_alloc().max_size());}
+
+
+			/* --- Modifiers --- */
+
+			/* --------------------------------------------------------------------------------
+			- Insert element -
+				Extends the container by inserting val, after any element equivalent to it.
+
+			Returns an iterator pointing to the newly inserted element.
+
+			Source: https://cplusplus.com/reference/set/multiset/insert/
+			-------------------------------------------------------------------------------- */
+			iterator								insert(const value_type& val)
+			{
+				_size++;
+
+				return (_make_iterator(_tree.insert_equal(val)));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert element with hint -
+				When val can go right before position, it is linked there in amortized O(1) instead of being searched from the root.
+
+			Returns an iterator pointing to the newly inserted element.
+
+			Source: https://cplusplus.com/reference/set/multiset/insert/
+			-------------------------------------------------------------------------------- */
+			iterator								insert(iterator position, const value_type& val)
+			{
+				_size++;
+
+				return (_make_iterator(_tree.insert_equal(val, _node(position))));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert range -
+				Inserts a copy of each element of [first, last); a sorted range is linked at the end of the tree, in amortized O(1) per element, when it comes after every element already in the container.
+
+			Source: https://cplusplus.com/reference/set/multiset/insert/
+			-------------------------------------------------------------------------------- */
+			template<class InputIterator>
+			void									insert(InputIterator first, InputIterator last)
+			{
+				for (; first != last; first++)
+					insert(end(), *first);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase element -
+				Removes from the multiset container the element pointed to by position, and only that one among the elements equivalent to it.
+
+			Source: https://cplusplus.com/reference/set/multiset/erase/
+			-------------------------------------------------------------------------------- */
+			void									erase(iterator position)
+			{
+				if (_tree.erase(_node(position)))
+					_size--;
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase elements by value -
+				Removes every element equivalent to val.
+
+			Returns the number of elements erased.
+
+			Source: https://cplusplus.com/reference/set/multiset/erase/
+			-------------------------------------------------------------------------------- */
+			size_type								erase(const value_type& val)
+			{
+				pair<iterator, iterator>	range = equal_range(val);
+				size_type					n = _size;
+
+				erase(range.first, range.second);
+
+				return (n - _size);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase range -
+				Removes from the multiset container the elements in [first, last), cut out of the tree by rank in O(k + log n) rather than one search per element.
+
+			Source: https://cplusplus.com/reference/set/multiset/erase/
+			-------------------------------------------------------------------------------- */
+			void									erase(iterator first, iterator last)
+			{
+				_size -= _tree.erase(_node(first), _node(last));
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Swap content -
+				Exchanges the content of the container by the content of x, which is another multiset of the same type. Sizes may differ.
+
+			Source: https://cplusplus.com/reference/set/multiset/swap/
+			-------------------------------------------------------------------------------- */
+			void									swap(multiset& x)
+			{
+				_tree.swap_content(x._tree);
+
+				size_type	tmp = x._size;
+
+				x._size = _size;
+				_size = tmp;
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Clear content -
+				Removes all elements from the multiset container (which are destroyed), leaving the container with a size of 0.
+
+			Source: https://cplusplus.com/reference/set/multiset/clear/
+			-------------------------------------------------------------------------------- */
+			void									clear()
+			{
+				_tree.clear();
+				_size = 0;
+
+				return;
+			}
+
+
+			/* --- Observers --- */
+
+			/* --------------------------------------------------------------------------------
+			- Return comparison object -
+				Returns a copy of the comparison object used by the container.
+
+			Source: https://cplusplus.com/reference/set/multiset/key_comp/
+			-------------------------------------------------------------------------------- */
+			key_compare								key_comp() const
+				{return (_key_comp);}
+
+			/* --------------------------------------------------------------------------------
+			- Return comparison object -
+				In a multiset the elements are their own keys, so value_comp is the same object as key_comp.
+
+			Source: https://cplusplus.com/reference/set/multiset/value_comp/
+			-------------------------------------------------------------------------------- */
+			value_compare							value_comp() const
+				{return (_key_comp);}
+
+
+			/* --- Operations --- */
+
+			/* --------------------------------------------------------------------------------
+			- Get iterator to element -
+				Searches the container for an element equivalent to val and returns an iterator to the first of them if found, otherwise it returns an iterator to multiset::end.
+
+			Source: https://cplusplus.com/reference/set/multiset/find/
+			-------------------------------------------------------------------------------- */
+			iterator								find(const value_type& val) const
+				{return (iterator(_tree.search(val)));}
+
+			/* --------------------------------------------------------------------------------
+			- Count elements with a specific value -
+				Searches the container for elements equivalent to val and returns the number of matches.
+				Both ends of the range are ranked with the subtree counts, in O(log n) whatever the number of matches.
+
+			Source: https://cplusplus.com/reference/set/multiset/count/
+			-------------------------------------------------------------------------------- */
+			size_type								count(const value_type& val) const
+				{return (ft::distance(lower_bound(val), upper_bound(val)));}
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to lower bound -
+				Returns an iterator pointing to the first element in the container which is not considered to go before val.
+
+			Source: https://cplusplus.com/reference/set/multiset/lower_bound/
+			-------------------------------------------------------------------------------- */
+			iterator								lower_bound(const value_type& val) const
+				{return (iterator(_tree.search_lower_bound(val)));}
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to upper bound -
+				Returns an iterator pointing to the first element in the container which is considered to go after val.
+
+			Source: https://cplusplus.com/reference/set/multiset/upper_bound/
+			-------------------------------------------------------------------------------- */
+			iterator								upper_bound(const value_type& val) const
+				{return (iterator(_tree.search_upper_bound(val)));}
+
+			/* --------------------------------------------------------------------------------
+			- Get range of equal elements -
+				Returns the bounds of a range that includes all the elements in the container which are equivalent to val.
+
+			Source: https://cplusplus.com/reference/set/multiset/equal_range/
+			-------------------------------------------------------------------------------- */
+			pair<iterator, iterator>				equal_range(const value_type& val) const
+				{return (pair<iterator, iterator>(lower_bound(val), upper_bound(val)));}
+
+
+			/* --- Allocator --- */
+
+			/* --------------------------------------------------------------------------------
+			- Get allocator -
+				Returns a copy of the allocator object associated with the multiset.
+
+			Source: https://cplusplus.com/reference/set/multiset/get_allocator/
+			-------------------------------------------------------------------------------- */
+			allocator_type							get_allocator() const
+				{return (allocator_type());}
+
+		private:
+			static tree_node*						_node(const iterator& it)
+				{return (reinterpret_cast<tree_node*>(it.base()));}
+
+			static iterator							_make_iterator(tree_node* node)
+				{return (iterator(reinterpret_cast<tree_const_node*>(node)));}
+	};
+	/* ----- NON-MEMBER OPERATOR OVERLOADS ----- */
+
+	template<typename T, typename Compare, typename Alloc>
+	bool	operator==(const multiset<T, Compare, Alloc>& lhs, const multiset<T, Compare, Alloc>& rhs)
+		{return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));}
+
+	template<typename T, typename Compare, typename Alloc>
+	bool	operator<(const multiset<T, Compare, Alloc>& lhs, const multiset<T, Compare, Alloc>& rhs)
+		{return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));}
+
+	template<typename T, typename Compare, typename Alloc>
+	bool	operator!=(const multiset<T, Compare, Alloc>& lhs, const multiset<T, Compare, Alloc>& rhs)
+		{return (!(lhs == rhs));}
+
+	template<typename T, typename Compare, typename Alloc>
+	bool	operator>(const multiset<T, Compare, Alloc>& lhs, const multiset<T, Compare, Alloc>& rhs)
+		{return (rhs < lhs);}
+
+	template<typename T, typename Compare, typename Alloc>
+	bool	operator<=(const multiset<T, Compare, Alloc>& lhs, const multiset<T, Compare, Alloc>& rhs)
+		{return (!(rhs < lhs));}
+
+	template<typename T, typename Compare, typename Alloc>
+	bool	operator>=(const multiset<T, Compare, Alloc>& lhs, const multiset<T, Compare, Alloc>& rhs)
+		{return (!(lhs < rhs));}
+}
+
+#endif
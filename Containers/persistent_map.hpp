@@ -0,0 +1,305 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   persistent_map.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:52:16 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 09:52:16 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PERSISTENT_MAP_HPP
+# define PERSISTENT_MAP_HPP
+
+# include <cstddef>		// size_t
+# include <functional>	// std::less
+# include <memory>		// std::allocator
+
+# include "../Iterators/iterator_traits.hpp"
+# include "../Iterators/persistent_iterator.hpp"
+# include "../Iterators/reverse_iterator.hpp"
+# include "../Others/algorithm.hpp"
+# include "../Others/pair.hpp"
+# include "../Others/persistent_tree.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Persistent map -
+		Immutable map: insert, insert_or_assign and erase leave the map unchanged and return a new version of it, which shares every node but the O(log n) on the path to the change (see persistent_tree). Copying a version costs O(1).
+		So keeping every version of a map costs O(log n) nodes per update instead of a full copy, and any old version can still be searched and iterated.
+		The nodes are reference counted: a node is freed with the last version that reaches it. The counts are atomic, so that different threads may use and drop versions sharing nodes at the same time.
+		The iterators are those of a const map and stay valid as long as the version they come from.
+	-------------------------------------------------------------------------------- */
+	template<class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<pair<const Key, T> > >
+	class persistent_map
+	{
+		public:
+			typedef				Key														key_type;
+			typedef				T														mapped_type;
+			typedef				pair<const key_type, mapped_type>						value_type;
+			typedef				Compare													key_compare;
+			typedef				Alloc													allocator_type;
+			typedef typename	allocator_type::const_reference							reference;
+			typedef typename	allocator_type::const_reference							const_reference;
+			typedef typename	allocator_type::const_pointer							pointer;
+			typedef typename	allocator_type::const_pointer							const_pointer;
+			typedef				persistent_node<value_type>								node_type;
+			typedef				persistent_iterator<node_type, const value_type>		iterator;
+			typedef				persistent_iterator<node_type, const value_type>		const_iterator;
+			typedef typename	ft::reverse_iterator<iterator>							reverse_iterator;
+			typedef typename	ft::reverse_iterator<const_iterator>					const_reverse_iterator;
+			typedef typename	iterator_traits<iterator>::difference_type				difference_type;
+			typedef				size_t													size_type;
+
+		private:
+			typedef				persistent_tree<Key, T, Compare, Alloc>					tree_type;
+
+			node_type*			_root;
+			key_compare			_comp;
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTOR ----- */
+
+			/* --------------------------------------------------------------------------------
+			- Empty map constructor (default constructor) -
+			-------------------------------------------------------------------------------- */
+			explicit persistent_map(const key_compare& comp = key_compare()) : _root(NULL), _comp(comp)
+				{return;}
+
+			/* --------------------------------------------------------------------------------
+			- Range constructor -
+				Builds the version holding the elements in [first, last], keeping the first of equivalent keys; the intermediate versions are freed on the way.
+			-------------------------------------------------------------------------------- */
+			template<class InputIterator>
+			persistent_map(InputIterator first, InputIterator last, const key_compare& comp = key_compare()) : _root(NULL), _comp(comp)
+			{
+				for (; first != last; first++)
+					insert(*first).swap(*this);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Copy constructor -
+				Shares the version of x, in O(1).
+			-------------------------------------------------------------------------------- */
+			persistent_map(const persistent_map& x) : _root(x._root), _comp(x._comp)
+			{
+				tree_type::acquire(_root);
+				return;
+			}
+
+			~persistent_map()
+			{
+				tree_type(_comp).release(_root);
+				return;
+			}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			/* --- Operator overloads --- */
+
+			persistent_map&						operator=(const persistent_map& x)
+			{
+				persistent_map	tmp(x);
+
+				swap(tmp);
+
+				return (*this);
+			}
+
+
+			/* --- Iterators --- */
+
+			const_iterator						begin() const
+				{return (const_iterator(_root, 0));}
+
+			const_iterator						end() const
+				{return (const_iterator(_root, size()));}
+
+			const_reverse_iterator				rbegin() const
+				{return (const_reverse_iterator(end()));}
+
+			const_reverse_iterator				rend() const
+				{return (const_reverse_iterator(begin()));}
+
+
+			/* --- Capacity --- */
+
+			bool								empty() const
+				{return (!_root);}
+
+			size_type							size() const
+				{return (tree_type::size(_root));}
+
+
+			/* --- Modifiers --- */
+
+			/* --------------------------------------------------------------------------------
+			- Insert element -
+				Returns the version with val inserted, or this version if there is already an element with an equivalent key.
+			-------------------------------------------------------------------------------- */
+			persistent_map						insert(const value_type& val) const
+			{
+				tree_type	tree(_comp);
+				bool		inserted = false;
+
+				tree.begin_write();
+				try
+				{
+					return (persistent_map(tree, tree.insert(_root, val, false, inserted), _comp));
+				}
+				catch (...)
+				{
+					tree.abort_write();
+					throw;
+				}
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert or assign element -
+				Returns the version where k is mapped to obj, whether or not this version has an element with key k.
+			-------------------------------------------------------------------------------- */
+			persistent_map						insert_or_assign(const key_type& k, const mapped_type& obj) const
+			{
+				tree_type	tree(_comp);
+				bool		inserted = false;
+
+				tree.begin_write();
+				try
+				{
+					return (persistent_map(tree, tree.insert(_root, value_type(k, obj), true, inserted), _comp));
+				}
+				catch (...)
+				{
+					tree.abort_write();
+					throw;
+				}
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase element -
+				Returns the version without the element with key k, or this version if there is none.
+			-------------------------------------------------------------------------------- */
+			persistent_map						erase(const key_type& k) const
+			{
+				tree_type	tree(_comp);
+				bool		erased = false;
+
+				tree.begin_write();
+				try
+				{
+					return (persistent_map(tree, tree.erase(_root, k, erased), _comp));
+				}
+				catch (...)
+				{
+					tree.abort_write();
+					throw;
+				}
+			}
+
+			void								swap(persistent_map& x)
+			{
+				node_type*	root = x._root;
+				key_compare	comp = x._comp;
+
+				x._root = _root;
+				x._comp = _comp;
+				_root = root;
+				_comp = comp;
+
+				return;
+			}
+
+
+			/* --- Observers --- */
+
+			key_compare							key_comp() const
+				{return (_comp);}
+
+
+			/* --- Operations --- */
+
+			const_iterator						find(const key_type& k) const
+			{
+				const_iterator	it = lower_bound(k);
+
+				if (it != end() && _comp(k, it->first))
+					return (end());
+
+				return (it);
+			}
+
+			size_type							count(const key_type& k) const
+				{return (tree_type(_comp).find(_root, k) != NULL);}
+
+			const_iterator						lower_bound(const key_type& k) const
+				{return (const_iterator(_root, tree_type(_comp).lower_rank(_root, k)));}
+
+			const_iterator						upper_bound(const key_type& k) const
+				{return (const_iterator(_root, tree_type(_comp).upper_rank(_root, k)));}
+
+			pair<const_iterator, const_iterator>	equal_range(const key_type& k) const
+				{return (ft::make_pair(lower_bound(k), upper_bound(k)));}
+
+			/* --------------------------------------------------------------------------------
+			- Shares structure -
+				Returns whether x is the very same version as this one, which only needs a pointer comparison and implies equality.
+			-------------------------------------------------------------------------------- */
+			bool								same(const persistent_map& x) const
+				{return (_root == x._root);}
+
+		private:
+			/* --------------------------------------------------------------------------------
+			- Version constructor -
+				Takes the version rooted at root that tree has just written.
+			-------------------------------------------------------------------------------- */
+			persistent_map(tree_type& tree, node_type* root, const key_compare& comp) : _root(root), _comp(comp)
+			{
+				tree.share_created();
+				tree_type::acquire(_root);
+
+				return;
+			}
+	};
+
+
+	/* ----- NON-MEMBER OPERATOR OVERLOADS ----- */
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator==(const persistent_map<Key, T, Compare, Alloc>& lhs, const persistent_map<Key, T, Compare, Alloc>& rhs)
+		{return (lhs.same(rhs) || (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin())));}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator!=(const persistent_map<Key, T, Compare, Alloc>& lhs, const persistent_map<Key, T, Compare, Alloc>& rhs)
+		{return (!(lhs == rhs));}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator<(const persistent_map<Key, T, Compare, Alloc>& lhs, const persistent_map<Key, T, Compare, Alloc>& rhs)
+		{return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator>(const persistent_map<Key, T, Compare, Alloc>& lhs, const persistent_map<Key, T, Compare, Alloc>& rhs)
+		{return (rhs < lhs);}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator<=(const persistent_map<Key, T, Compare, Alloc>& lhs, const persistent_map<Key, T, Compare, Alloc>& rhs)
+		{return (!(rhs < lhs));}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	bool	operator>=(const persistent_map<Key, T, Compare, Alloc>& lhs, const persistent_map<Key, T, Compare, Alloc>& rhs)
+		{return (!(lhs < rhs));}
+
+	template<typename Key, typename T, typename Compare, typename Alloc>
+	void	swap(persistent_map<Key, T, Compare, Alloc>& x, persistent_map<Key, T, Compare, Alloc>& y)
+	{
+		x.swap(y);
+		return;
+	}
+}
+
+#endif
@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   priority_queue.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:12:53 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 10:12:53 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PRIORITY_QUEUE_HPP
+# define PRIORITY_QUEUE_HPP
+
+# include <cstddef>		// size_t
+# include <functional>	// std::less
+
+# include "vector.hpp"
+# include "../Others/algorithm.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Priority queue -
+		Container adaptor that keeps its elements as a heap in one contiguous container, so that the greatest element, by comp, is always at the front: top is O(1), push and pop O(log n), without an allocation per element.
+		Arity is the number of children per node of the heap. The default of 4 halves the depth of the binary heap, and the 4 children of a node are contiguous: a pop compares more elements per level, but touches half as many cache lines, and a push compares with half as many ancestors.
+	-------------------------------------------------------------------------------- */
+	template<class T, class Container = vector<T>, class Compare = std::less<typename Container::value_type>, size_t Arity = 4>
+	class priority_queue
+	{
+		public:
+			typedef typename Container::value_type		value_type;
+			typedef Container							container_type;
+			typedef Compare								value_compare;
+			typedef size_t								size_type;
+
+		protected:
+			container_type		c;
+			value_compare		comp;
+
+		public:
+			/* ----- CONSTRUCTORS ----- */
+
+			/* --------------------------------------------------------------------------------
+			- Construct priority queue -
+				Constructs a priority_queue container adaptor object.
+				A priority_queue keeps internally a comparing function and a container object as data, which are copies of comp and ctnr respectively.
+				The range version, on top that, inserts the elements between first and last (before modifying the container into a heap).
+				The container is then organized into a heap with make_heap.
+
+			Source: https://cplusplus.com/reference/queue/priority_queue/priority_queue/
+			-------------------------------------------------------------------------------- */
+			explicit priority_queue(const value_compare& comp = value_compare(), const container_type& ctnr = container_type()) : c(ctnr), comp(comp)
+			{
+				ft::dary_make_heap<Arity>(c.begin(), c.end(), comp);
+				return;
+			}
+
+			template<class InputIterator>
+			priority_queue(InputIterator first, InputIterator last, const value_compare& comp = value_compare(), const container_type& ctnr = container_type()) : c(ctnr), comp(comp)
+			{
+				c.insert(c.end(), first, last);
+				ft::dary_make_heap<Arity>(c.begin(), c.end(), comp);
+				return;
+			}
+
+
+			/* ----- OPERATOR OVERLOADS ----- */
+
+			/* --------------------------------------------------------------------------------
+			- Assign content -
+				Assigns new contents to the container, replacing its current contents.
+			-------------------------------------------------------------------------------- */
+			priority_queue&		operator=(const priority_queue& cpy)
+			{
+				c = cpy.c;
+				comp = cpy.comp;
+				return (*this);
+			}
+
+
+			/* ----- MEMBER FUNCTIONS -----*/
+
+			/* --------------------------------------------------------------------------------
+			- Test whether container is empty -
+				Returns whether the priority_queue is empty: i.e. whether its size is zero.
+				This member function effectively calls member empty of the underlying container object.
+
+			Source: https://cplusplus.com/reference/queue/priority_queue/empty/
+			-------------------------------------------------------------------------------- */
+			bool				empty() const
+				{return (c.empty());}
+
+			/* --------------------------------------------------------------------------------
+			- Return size -
+				Returns the number of elements in the priority_queue.
+				This member function effectively calls member size of the underlying container object.
+
+			Source: https://cplusplus.com/reference/queue/priority_queue/size/
+			-------------------------------------------------------------------------------- */
+			size_type			size() const
+				{return (c.size());}
+
+			/* --------------------------------------------------------------------------------
+			- Access top element -
+				Returns a constant reference to the top element in the priority_queue.
+				The top element is the element that compares higher in the priority_queue, and the next that is removed from the container when priority_queue::pop is called.
+				This member function effectively calls member front of the underlying container object.
+
+			Source: https://cplusplus.com/reference/queue/priority_queue/top/
+			-------------------------------------------------------------------------------- */
+			const value_type&	top() const
+				{return (c.front());}
+
+			/* --------------------------------------------------------------------------------
+			- Insert element -
+				Inserts a new element in the priority_queue. The content of this new element is initialized to val.
+				This member function effectively calls the member function push_back of the underlying container object, and then reorders it to its location in the heap by calling the push_heap algorithm on the range that includes all the elements of the container.
+
+			Source: https://cplusplus.com/reference/queue/priority_queue/push/
+			-------------------------------------------------------------------------------- */
+			void				push(const value_type& val)
+			{
+				c.push_back(val);
+				ft::dary_push_heap<Arity>(c.begin(), c.end(), comp);
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Remove top element -
+				Removes the element on top of the priority_queue, effectively reducing its size by one. The element removed is the one with the highest value.
+				This member function effectively calls the pop_heap algorithm to keep the heap property of priority_queues and then calls the member function pop_back of the underlying container object to remove the element.
+
+			Source: https://cplusplus.com/reference/queue/priority_queue/pop/
+			-------------------------------------------------------------------------------- */
+			void				pop()
+			{
+				ft::dary_pop_heap<Arity>(c.begin(), c.end(), comp);
+				c.pop_back();
+				return;
+			}
+	};
+}
+
+#endif
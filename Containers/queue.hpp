@@ -0,0 +1,210 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   queue.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:06:50 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 10:06:50 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef QUEUE_HPP
+# define QUEUE_HPP
+
+# include "ring_buffer.hpp"
+
+namespace ft
+{
+	template<typename T, class Container = ring_buffer<T> >
+	class queue
+	{
+		public:
+			typedef T			value_type;
+			typedef Container	container_type;
+			typedef size_t		size_type;
+
+		protected:
+			container_type		c;
+
+		public:
+			/* ----- CONSTRUCTOR ----- */
+
+			/* --------------------------------------------------------------------------------
+			- Construct queue -
+				Constructs a queue container adaptor object.
+				A container adaptor keeps internally a container object as data. This container object is a copy of the ctnr argument passed to the constructor, if any, otherwise it is an empty container.
+
+			Source: https://cplusplus.com/reference/queue/queue/queue/
+			-------------------------------------------------------------------------------- */
+			explicit queue(const container_type& ctnr = container_type()) : c(ctnr)
+				{return;}
+
+
+			/* ----- OPERATOR OVERLOADS ----- */
+
+			/* --------------------------------------------------------------------------------
+			- Assign content -
+				Assigns new contents to the container, replacing its current contents.
+			-------------------------------------------------------------------------------- */
+			queue&				operator=(const queue& cpy)
+			{
+				c = cpy.c;
+				return (*this);
+			}
+
+
+			/* ----- MEMBER FUNCTIONS -----*/
+
+			/* --------------------------------------------------------------------------------
+			- Test whether container is empty -
+				Returns whether the queue is empty: i.e. whether its size is zero.
+				This member function effectively calls member empty of the underlying container object.
+
+			Source: https://cplusplus.com/reference/queue/queue/empty/
+			-------------------------------------------------------------------------------- */
+			bool				empty() const
+				{return (c.empty());}
+
+			/* --------------------------------------------------------------------------------
+			- Return size -
+				Returns the number of elements in the queue.
+				This member function effectively calls member size of the underlying container object.
+
+			Source: https://cplusplus.com/reference/queue/queue/size/
+			-------------------------------------------------------------------------------- */
+			size_type			size() const
+				{return (c.size());}
+
+			/* --------------------------------------------------------------------------------
+			- Access next element -
+				Returns a reference to the next element in the queue.
+				The next element is the "oldest" element in the queue and the same element that is popped out from the queue when queue::pop is called.
+				This member function effectively calls member front of the underlying container object.
+
+			Source: https://cplusplus.com/reference/queue/queue/front/
+			-------------------------------------------------------------------------------- */
+			value_type&			front()
+				{return (c.front());}
+
+			const value_type&	front() const
+				{return (c.front());}
+
+			/* --------------------------------------------------------------------------------
+			- Access last element -
+				Returns a reference to the last element in the queue. This is the "newest" element in the queue (i.e. the last element pushed into the queue).
+				This member function effectively calls member back of the underlying container object.
+
+			Source: https://cplusplus.com/reference/queue/queue/back/
+			-------------------------------------------------------------------------------- */
+			value_type&			back()
+				{return (c.back());}
+
+			const value_type&	back() const
+				{return (c.back());}
+
+			/* --------------------------------------------------------------------------------
+			- Insert element -
+				Inserts a new element at the end of the queue, after its current last element. The content of this new element is initialized to val.
+				This member function effectively calls the member function push_back of the underlying container object.
+
+			Source: https://cplusplus.com/reference/queue/queue/push/
+			-------------------------------------------------------------------------------- */
+			void				push(const value_type& val)
+			{
+				c.push_back(val);
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Remove next element -
+				Removes the next element in the queue, effectively reducing its size by one.
+				The element removed is the "oldest" element in the queue whose value can be retrieved by calling member queue::front.
+				This calls the removed element's destructor.
+				This member function effectively calls the member function pop_front of the underlying container object.
+
+			Source: https://cplusplus.com/reference/queue/queue/pop/
+			-------------------------------------------------------------------------------- */
+			void				pop()
+			{
+				c.pop_front();
+				return;
+			}
+
+			template <class T1, class Container1>
+			friend bool operator==(const queue<T1, Container1>& lhs, const queue<T1, Container1>& rhs);
+
+			template <class T1, class Container1>
+			friend bool operator<(const queue<T1, Container1>& lhs, const queue<T1, Container1>& rhs);
+	};
+	/* ----- RELATIONAL OPERATORS ----- */
+
+	/* --------------------------------------------------------------------------------
+	- "Equal to" operator for queue -
+		Performs the appropriate comparison operation between lhs and rhs.
+		Calls the same operator on the underlying container objects.
+
+	Source: https://cplusplus.com/reference/queue/queue/operators/
+	-------------------------------------------------------------------------------- */
+	template<class T, class Container>
+	bool	operator==(const queue<T, Container>& lhs, const queue<T, Container>& rhs)
+		{return (lhs.c == rhs.c);}
+
+	/* --------------------------------------------------------------------------------
+	- "Not equal to" operator for queue -
+		Performs the appropriate comparison operation between lhs and rhs.
+		Calls the same operator on the underlying container objects.
+
+	Source: https://cplusplus.com/reference/queue/queue/operators/
+	-------------------------------------------------------------------------------- */
+	template<class T, class Container>
+	bool	operator!=(const queue<T, Container>& lhs, const queue<T, Container>& rhs)
+		{return (!(lhs == rhs));}
+
+	/* --------------------------------------------------------------------------------
+	- "Less than" operator for queue -
+		Performs the appropriate comparison operation between lhs and rhs.
+		Calls the same operator on the underlying container objects.
+
+	Source: https://cplusplus.com/reference/queue/queue/operators/
+	-------------------------------------------------------------------------------- */
+	template<class T, class Container>
+	bool	operator<(const queue<T, Container>& lhs, const queue<T, Container>& rhs)
+		{return (lhs.c < rhs.c);}
+
+	/* --------------------------------------------------------------------------------
+	- "Less than or equal to" operator for queue -
+		Performs the appropriate comparison operation between lhs and rhs.
+		Calls the same operator on the underlying container objects.
+
+	Source: https://cplusplus.com/reference/queue/queue/operators/
+	-------------------------------------------------------------------------------- */
+	template<class T, class Container>
+	bool	operator<=(const queue<T, Container>& lhs, const queue<T, Container>& rhs)
+		{return (!(rhs < lhs));}
+
+	/* --------------------------------------------------------------------------------
+	- "Greater than" operator for queue -
+		Performs the appropriate comparison operation between lhs and rhs.
+		Calls the same operator on the underlying container objects.
+
+	Source: https://cplusplus.com/reference/queue/queue/operators/
+	-------------------------------------------------------------------------------- */
+	template<class T, class Container>
+	bool	operator>(const queue<T, Container>& lhs, const queue<T, Container>& rhs)
+		{return (rhs < lhs);}
+
+	/* --------------------------------------------------------------------------------
+	- "Greater than or equal to" operator for queue -
+		Performs the appropriate comparison operation between lhs and rhs.
+		Calls the same operator on the underlying container objects.
+
+	Source: https://cplusplus.com/reference/queue/queue/operators/
+	-------------------------------------------------------------------------------- */
+	template<class T, class Container>
+	bool	operator>=(const queue<T, Container>& lhs, const queue<T, Container>& rhs)
+		{return (!(lhs < rhs));}
+}
+
+#endif
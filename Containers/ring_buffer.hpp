@@ -0,0 +1,293 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ring_buffer.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:05:14 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 10:05:14 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef RING_BUFFER_HPP
+# define RING_BUFFER_HPP
+
+# include <cstddef>		// size_t
+# include <memory>		// std::allocator
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Ring capacity -
+		Smallest power of two of at least n (and 1), so that a position maps to its slot with a mask instead of a division.
+	-------------------------------------------------------------------------------- */
+	inline size_t	ring_capacity(size_t n)
+	{
+		size_t	capacity = 1;
+
+		while (capacity < n)
+			capacity <<= 1;
+
+		return (capacity);
+	}
+
+	/* --------------------------------------------------------------------------------
+	- Ring buffer -
+		Sequence that grows at the back and shrinks at the front, kept in one array used circularly: element i is in slot (head + i) & mask, so push_back and pop_front never move the other elements.
+		The capacity is a power of two, of at least 8 slots, and doubles when the array is full; the elements are then copied in order to the start of the new array.
+		The default container of queue. For a queue between threads, see spsc_ring_buffer and mpmc_ring_buffer.
+	-------------------------------------------------------------------------------- */
+	template<class T, class Alloc = std::allocator<T> >
+	class ring_buffer
+	{
+		public:
+			typedef				T									value_type;
+			typedef				Alloc								allocator_type;
+			typedef typename	allocator_type::reference			reference;
+			typedef typename	allocator_type::const_reference		const_reference;
+			typedef				size_t								size_type;
+
+		private:
+			enum											{_min_capacity = 8};
+
+			value_type*			_slots;
+			size_type			_capacity;
+			size_type			_head;
+			size_type			_size;
+			allocator_type		_alloc;
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTOR ----- */
+
+			explicit ring_buffer(const allocator_type& alloc = allocator_type()) : _slots(NULL), _capacity(0), _head(0), _size(0), _alloc(alloc)
+				{return;}
+
+			ring_buffer(const ring_buffer& cpy) : _slots(NULL), _capacity(0), _head(0), _size(0), _alloc(cpy._alloc)
+			{
+				*this = cpy;
+				return;
+			}
+
+			~ring_buffer()
+			{
+				clear();
+				if (_slots)
+					_alloc.deallocate(_slots, _capacity);
+
+				return;
+			}
+
+
+			/* ----- OPERATOR OVERLOADS ----- */
+
+			ring_buffer&			operator=(const ring_buffer& cpy)
+			{
+				if (this == &cpy)
+					return (*this);
+
+				clear();
+				reserve(cpy._size);
+				for (size_type i = 0; i < cpy._size; i++)
+					push_back(cpy[i]);
+
+				return (*this);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Access element -
+				Returns a reference to the element at position n from the front. Not checked.
+			-------------------------------------------------------------------------------- */
+			reference				operator[](size_type n)
+				{return (_slots[(_head + n) & (_capacity - 1)]);}
+
+			const_reference			operator[](size_type n) const
+				{return (_slots[(_head + n) & (_capacity - 1)]);}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			bool					empty() const
+				{return (!_size);}
+
+			size_type				size() const
+				{return (_size);}
+
+			size_type				max_size() const
+				{return (_alloc.max_size());}
+
+			size_type				capacity() const
+				{return (_capacity);}
+
+			allocator_type			get_allocator() const
+				{return (_alloc);}
+
+			reference				front()
+				{return (_slots[_head]);}
+
+			const_reference			front() const
+				{return (_slots[_head]);}
+
+			reference				back()
+				{return ((*this)[_size - 1]);}
+
+			const_reference			back() const
+				{return ((*this)[_size - 1]);}
+
+			/* --------------------------------------------------------------------------------
+			- Request a change in capacity -
+				Grows the array to the smallest power of two of at least n slots, if it has fewer.
+			-------------------------------------------------------------------------------- */
+			void					reserve(size_type n)
+			{
+				if (n <= _capacity)
+					return;
+
+				size_type	capacity = ring_capacity(n);
+
+				if (capacity < _min_capacity)
+					capacity = _min_capacity;
+
+				value_type*	slots = _alloc.allocate(capacity);
+				size_type	i = 0;
+
+				try
+				{
+					for (; i < _size; i++)
+						_alloc.construct(slots + i, (*this)[i]);
+				}
+				catch (...)
+				{
+					while (i)
+						_alloc.destroy(slots + --i);
+					_alloc.deallocate(slots, capacity);
+					throw;
+				}
+				for (i = 0; i < _size; i++)
+					_alloc.destroy(&(*this)[i]);
+				if (_slots)
+					_alloc.deallocate(_slots, _capacity);
+				_slots = slots;
+				_capacity = capacity;
+				_head = 0;
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Add element at the end -
+				Doubles the capacity first if the array is full.
+			-------------------------------------------------------------------------------- */
+			void					push_back(const value_type& val)
+			{
+				if (_size == _capacity)
+					reserve(_capacity + 1);
+				_alloc.construct(&(*this)[_size], val);
+				_size++;
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Delete first element -
+				The slot is reused by a later push_back; the array never shrinks.
+			-------------------------------------------------------------------------------- */
+			void					pop_front()
+			{
+				_alloc.destroy(_slots + _head);
+				_head = (_head + 1) & (_capacity - 1);
+				_size--;
+
+				return;
+			}
+
+			void					clear()
+			{
+				while (_size)
+					pop_front();
+				_head = 0;
+
+				return;
+			}
+
+			void					swap(ring_buffer& x)
+			{
+				value_type*		slots = x._slots;
+				size_type		capacity = x._capacity;
+				size_type		head = x._head;
+				size_type		size = x._size;
+				allocator_type	alloc = x._alloc;
+
+				x._slots = _slots;
+				x._capacity = _capacity;
+				x._head = _head;
+				x._size = _size;
+				x._alloc = _alloc;
+				_slots = slots;
+				_capacity = capacity;
+				_head = head;
+				_size = size;
+				_alloc = alloc;
+
+				return;
+			}
+	};
+	/* ----- RELATIONAL OPERATORS ----- */
+
+	template<class T, class Alloc>
+	bool	operator==(const ring_buffer<T, Alloc>& lhs, const ring_buffer<T, Alloc>& rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return (false);
+		for (size_t i = 0; i < lhs.size(); i++)
+		{
+			if (!(lhs[i] == rhs[i]))
+				return (false);
+		}
+
+		return (true);
+	}
+
+	template<class T, class Alloc>
+	bool	operator!=(const ring_buffer<T, Alloc>& lhs, const ring_buffer<T, Alloc>& rhs)
+		{return (!(lhs == rhs));}
+
+	/* --------------------------------------------------------------------------------
+	- "Less than" operator for ring_buffer -
+		Compares the elements front to back, lexicographically.
+	-------------------------------------------------------------------------------- */
+	template<class T, class Alloc>
+	bool	operator<(const ring_buffer<T, Alloc>& lhs, const ring_buffer<T, Alloc>& rhs)
+	{
+		for (size_t i = 0; i < lhs.size() && i < rhs.size(); i++)
+		{
+			if (lhs[i] < rhs[i])
+				return (true);
+			if (rhs[i] < lhs[i])
+				return (false);
+		}
+
+		return (lhs.size() < rhs.size());
+	}
+
+	template<class T, class Alloc>
+	bool	operator<=(const ring_buffer<T, Alloc>& lhs, const ring_buffer<T, Alloc>& rhs)
+		{return (!(rhs < lhs));}
+
+	template<class T, class Alloc>
+	bool	operator>(const ring_buffer<T, Alloc>& lhs, const ring_buffer<T, Alloc>& rhs)
+		{return (rhs < lhs);}
+
+	template<class T, class Alloc>
+	bool	operator>=(const ring_buffer<T, Alloc>& lhs, const ring_buffer<T, Alloc>& rhs)
+		{return (!(lhs < rhs));}
+
+	template<class T, class Alloc>
+	void	swap(ring_buffer<T, Alloc>& x, ring_buffer<T, Alloc>& y)
+	{
+		x.swap(y);
+		return;
+	}
+}
+
+#endif
@@ -0,0 +1,476 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   set.hpp                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:48:35 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 11:10:39 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SET_HPP
+# define SET_HPP
+
+# include <cstddef>		// size_t
+# include <functional>	// std::less
+# include <memory>		// std::allocator
+
+# include "../Iterators/iterator_traits.hpp"
+# include "../Iterators/reverse_iterator.hpp"
+# include "../Iterators/tree_iterator.hpp"
+# include "../Others/aggregate.hpp"
+# include "../Others/algorithm.hpp"
+# include "../Others/pair.hpp"
+# include "../Others/red_black_node.hpp"
+# include "../Others/red_black_tree.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Set -
+		Sets are containers that store unique elements following a specific order.
+		The value of an element is also the key used to identify it, so the tree stores the keys alone and compares them with key_comp directly: there is no mapped value to carry around in every node.
+		Elements of a set cannot be modified once in the container, which is why iterator and const_iterator are the same constant iterator.
+
+	Source: https://cplusplus.com/reference/set/set/
+	-------------------------------------------------------------------------------- */
+	template<class T, class Compare = std::less<T>, class Alloc = std::allocator<T> >
+	class set
+	{
+		public:
+			typedef				T																																key_type;
+			typedef				T																																value_type;
+			typedef				Compare																															key_compare;
+			typedef				Compare																															value_compare;
+			typedef				Alloc																															allocator_type;
+			typedef typename	allocator_type::reference																										reference;
+			typedef typename	allocator_type::const_reference																									const_reference;
+			typedef typename	allocator_type::pointer																											pointer;
+			typedef typename	allocator_type::const_pointer																									const_pointer;
+			typedef typename	ft::tree_iterator<const value_type, value_compare, red_black_node<const value_type, value_compare, no_aggregate<value_type> > >	iterator;
+			typedef typename	ft::tree_iterator<const value_type, value_compare, red_black_node<const value_type, value_compare, no_aggregate<value_type> > >	const_iterator;
+			typedef typename	ft::reverse_iterator<iterator>																									reverse_iterator;
+			typedef typename	ft::reverse_iterator<const_iterator>																							const_reverse_iterator;
+			typedef typename	iterator_traits<iterator>::difference_type																						difference_type;
+			typedef				size_t																															size_type;
+
+		protected:
+			typedef				red_black_tree<value_type, Alloc, value_compare>	tree_type;
+			typedef typename	tree_type::node_type								tree_node;
+			typedef typename	tree_type::node_const_type							tree_const_node;
+
+			key_compare			_key_comp;
+			tree_type			_tree;
+			size_type			_size;
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTOR ----- */
+
+			/* --------------------------------------------------------------------------------
+			- Empty container constructor (default constructor) -
+				Constructs an empty container, with no elements.
+
+			Source: https://cplusplus.com/reference/set/set/set/
+			-------------------------------------------------------------------------------- */
+			explicit set(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _key_comp(comp), _tree(_key_comp), _size(0)
+			{
+				(void)alloc;
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Range constructor -
+				Constructs a container with as many elements as the range [first, last], with each element constructed from its corresponding element in that range.
+
+			Source: https://cplusplus.com/reference/set/set/set/
+			-------------------------------------------------------------------------------- */
+			template<class InputIterator>
+			set(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _key_comp(comp), _tree(_key_comp), _size(0)
+			{
+				(void)alloc;
+				insert(first, last);
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Copy constructor -
+				Constructs a container with a copy of each of the elements in x.
+				The copied tree compares with this container's own comparison object.
+
+			Source: https://cplusplus.com/reference/set/set/set/
+			-------------------------------------------------------------------------------- */
+			set(const set& x) : _key_comp(x._key_comp), _tree(_key_comp), _size(x._size)
+			{
+				_tree = x._tree;
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Set destructor -
+				Destroys the container object.
+
+			Source: https://cplusplus.com/reference/set/set/~set/
+			-------------------------------------------------------------------------------- */
+			~set()
+				{return;}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			/* --- Operator overloads --- */
+
+			/* --------------------------------------------------------------------------------
+			- Copy container content -
+				Assigns new contents to the container, replacing its current content, and takes a copy of the comparison object of x.
+
+			Source: https://cplusplus.com/reference/set/set/operator=/
+			-------------------------------------------------------------------------------- */
+			set&									operator=(const set& x)
+			{
+				_key_comp = x._key_comp;
+				_tree = x._tree;
+				_size = x._size;
+
+				return (*this);
+			}
+
+
+			/* --- Iterators --- */
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to beginning -
+				Returns an iterator referring to the first element in the set container.
+				If the container is empty, the returned iterator value shall not be dereferenced.
+
+			Source: https://cplusplus.com/reference/set/set/begin/
+			-------------------------------------------------------------------------------- */
+			iterator								begin() const
+				{return (iterator(_tree.get_begin()));}
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to end -
+				Returns an iterator referring to the past-the-end element in the set container.
+
+			Source: https://cplusplus.com/reference/set/set/end/
+			-------------------------------------------------------------------------------- */
+			iterator								end() const
+				{return (iterator(_tree.get_end()));}
+
+			/* --------------------------------------------------------------------------------
+			- Return reverse iterator to reverse beginning -
+				Returns a reverse iterator pointing to the last element in the container (i.e., its reverse beginning).
+
+			Source: https://cplusplus.com/reference/set/set/rbegin/
+			-------------------------------------------------------------------------------- */
+			reverse_iterator						rbegin() const
+				{return (reverse_iterator(end()));}
+
+			/* --------------------------------------------------------------------------------
+			- Return reverse iterator to reverse end -
+				Returns a reverse iterator pointing to the theoretical element right before the first element in the set container (which is considered its reverse end).
+
+			Source: https://cplusplus.com/reference/set/set/rend/
+			-------------------------------------------------------------------------------- */
+			reverse_iterator						rend() const
+				{return (reverse_iterator(begin()));}
+
+
+			/* --- Capacity --- */
+
+			/* --------------------------------------------------------------------------------
+			- Test whether container is empty -
+				Returns whether the set container is empty (i.e. whether its size is 0).
+
+			Source: https://cplusplus.com/reference/set/set/empty/
+			-------------------------------------------------------------------------------- */
+			bool									empty() const
+				{return (!_size);}
+
+			/* --------------------------------------------------------------------------------
+			- Return container size -
+				Returns the number of elements in the set container.
+
+			Source: https://cplusplus.com/reference/set/set/size/
+			-------------------------------------------------------------------------------- */
+			size_type								size() const
+				{return (_size);}
+
+			/* --------------------------------------------------------------------------------
+			- Return maximum size -
+				Returns the maximum number of elements that the set container can hold.
+
+			Source: https://cplusplus.com/reference/set/set/max_size/
+			-------------------------------------------------------------------------------- */
+			size_type								max_size() const
+				{return (_tree.get_alloc().max_size());}
+
+
+			/* --- Modifiers --- */
+
+			/* --------------------------------------------------------------------------------
+			- Insert element -
+				Extends the container by inserting val, if no element equivalent to it is already in the container.
+
+			Returns a pair, with its member pair::first set to an iterator pointing to either the newly inserted element or to the equivalent element already in the set. The pair::second element in the pair is set to true if a new element was inserted or false if an equivalent element already existed.
+
+			Source: https://cplusplus.com/reference/set/set/insert/
+			-------------------------------------------------------------------------------- */
+			pair<iterator, bool>					insert(const value_type& val)
+			{
+				pair<tree_node*, bool>	tmp = _tree.insert(val);
+
+				if (tmp.second)
+					_size++;
+
+				return (pair<iterator, bool>(_make_iterator(tmp.first), tmp.second));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert element with hint -
+				When val goes right before position, the search starts from the predecessor of position instead of the root.
+
+			Returns an iterator pointing to either the newly inserted element or to the element that was already equivalent to it in the set.
+
+			Source: https://cplusplus.com/reference/set/set/insert/
+			-------------------------------------------------------------------------------- */
+			iterator								insert(iterator position, const value_type& val)
+			{
+				pair<tree_node*, bool>	tmp;
+				iterator				prev = position;
+
+				if (position != begin() && (position == end() || _key_comp(val, *position)) && _key_comp(*(--prev), val))
+					tmp = _tree.insert(val, _node(prev));
+				else
+					tmp = _tree.insert(val);
+
+				if (tmp.second)
+					_size++;
+
+				return (_make_iterator(tmp.first));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert range -
+				Inserts a copy of each element of [first, last) that is not already in the container.
+
+			Source: https://cplusplus.com/reference/set/set/insert/
+			-------------------------------------------------------------------------------- */
+			template<class InputIterator>
+			void									insert(InputIterator first, InputIterator last)
+			{
+				for (; first != last; first++)
+					if (_tree.insert(*first).second)
+						_size++;
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase element -
+				Removes from the set container the element pointed to by position, without searching for it again.
+
+			Source: https://cplusplus.com/reference/set/set/erase/
+			-------------------------------------------------------------------------------- */
+			void									erase(iterator position)
+			{
+				if (_tree.erase(_node(position)))
+					_size--;
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase element by value -
+				Removes the element equivalent to val, if any.
+
+			Returns the number of elements erased.
+
+			Source: https://cplusplus.com/reference/set/set/erase/
+			-------------------------------------------------------------------------------- */
+			size_type								erase(const value_type& val)
+			{
+				if (_tree.erase(val))
+				{
+					_size--;
+					return (1);
+				}
+
+				return (0);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase range -
+				Removes from the set container the elements in [first, last), cut out of the tree by rank in O(k + log n) rather than one search per element.
+
+			Source: https://cplusplus.com/reference/set/set/erase/
+			-------------------------------------------------------------------------------- */
+			void									erase(iterator first, iterator last)
+			{
+				_size -= _tree.erase(_node(first), _node(last));
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Swap content -
+				Exchanges the content of the container by the content of x, which is another set of the same type. Sizes may differ.
+
+			Source: https://cplusplus.com/reference/set/set/swap/
+			-------------------------------------------------------------------------------- */
+			void									swap(set& x)
+			{
+				_tree.swap_content(x._tree);
+
+				size_type	tmp = x._size;
+
+				x._size = _size;
+				_size = tmp;
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Clear content -
+				Removes all elements from the set container (which are destroyed), leaving the container with a size of 0.
+
+			Source: https://cplusplus.com/reference/set/set/clear/
+			-------------------------------------------------------------------------------- */
+			void									clear()
+			{
+				_tree.clear();
+				_size = 0;
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Merge another set -
+				Moves into this set every element of x that is not already here, relinking the nodes by split and join in O(m log(n / m + 1)); the others stay in x.
+			-------------------------------------------------------------------------------- */
+			void									merge(set& x)
+			{
+				_tree.merge(x._tree);
+				_size = _tree.size();
+				x._size = x._tree.size();
+
+				return;
+			}
+
+
+			/* --- Observers --- */
+
+			/* --------------------------------------------------------------------------------
+			- Return comparison object -
+				Returns a copy of the comparison object used by the container.
+
+			Source: https://cplusplus.com/reference/set/set/key_comp/
+			-------------------------------------------------------------------------------- */
+			key_compare								key_comp() const
+				{return (_key_comp);}
+
+			/* --------------------------------------------------------------------------------
+			- Return comparison object -
+				In a set the elements are their own keys, so value_comp is the same object as key_comp.
+
+			Source: https://cplusplus.com/reference/set/set/value_comp/
+			-------------------------------------------------------------------------------- */
+			value_compare							value_comp() const
+				{return (_key_comp);}
+
+
+			/* --- Operations --- */
+
+			/* --------------------------------------------------------------------------------
+			- Get iterator to element -
+				Searches the container for an element equivalent to val and returns an iterator to it if found, otherwise it returns an iterator to set::end.
+
+			Source: https://cplusplus.com/reference/set/set/find/
+			-------------------------------------------------------------------------------- */
+			iterator								find(const value_type& val) const
+				{return (iterator(_tree.search(val)));}
+
+			/* --------------------------------------------------------------------------------
+			- Count elements with a specific value -
+				Because all elements in a set container are unique, the function can only return 1 (if the element is found) or zero (otherwise).
+
+			Source: https://cplusplus.com/reference/set/set/count/
+			-------------------------------------------------------------------------------- */
+			size_type								count(const value_type& val) const
+				{return (_tree.search(val) != _tree.get_end());}
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to lower bound -
+				Returns an iterator pointing to the first element in the container which is not considered to go before val.
+
+			Source: https://cplusplus.com/reference/set/set/lower_bound/
+			-------------------------------------------------------------------------------- */
+			iterator								lower_bound(const value_type& val) const
+				{return (iterator(_tree.search_lower_bound(val)));}
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to upper bound -
+				Returns an iterator pointing to the first element in the container which is considered to go after val.
+
+			Source: https://cplusplus.com/reference/set/set/upper_bound/
+			-------------------------------------------------------------------------------- */
+			iterator								upper_bound(const value_type& val) const
+				{return (iterator(_tree.search_upper_bound(val)));}
+
+			/* --------------------------------------------------------------------------------
+			- Get range of equal elements -
+				Because the elements in a set container are unique, the range returned will contain a single element at most.
+
+			Source: https://cplusplus.com/reference/set/set/equal_range/
+			-------------------------------------------------------------------------------- */
+			pair<iterator, iterator>				equal_range(const value_type& val) const
+				{return (pair<iterator, iterator>(lower_bound(val), upper_bound(val)));}
+
+
+			/* --- Allocator --- */
+
+			/* --------------------------------------------------------------------------------
+			- Get allocator -
+				Returns a copy of the allocator object associated with the set.
+
+			Source: https://cplusplus.com/reference/set/set/get_allocator/
+			-------------------------------------------------------------------------------- */
+			allocator_type							get_allocator() const
+				{return (allocator_type());}
+
+		private:
+			static tree_node*						_node(const iterator& it)
+				{return (reinterpret_cast<tree_node*>(it.base()));}
+
+			static iterator							_make_iterator(tree_node* node)
+				{return (iterator(reinterpret_cast<tree_const_node*>(node)));}
+	};
+	/* ----- NON-MEMBER OPERATOR OVERLOADS ----- */
+
+	template<typename T, typename Compare, typename Alloc>
+	bool	operator==(const set<T, Compare, Alloc>& lhs, const set<T, Compare, Alloc>& rhs)
+		{return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));}
+
+	template<typename T, typename Compare, typename Alloc>
+	bool	operator<(const set<T, Compare, Alloc>& lhs, const set<T, Compare, Alloc>& rhs)
+		{return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));}
+
+	template<typename T, typename Compare, typename Alloc>
+	bool	operator!=(const set<T, Compare, Alloc>& lhs, const set<T, Compare, Alloc>& rhs)
+		{return (!(lhs == rhs));}
+
+	template<typename T, typename Compare, typename Alloc>
+	bool	operator>(const set<T, Compare, Alloc>& lhs, const set<T, Compare, Alloc>& rhs)
+		{return (rhs < lhs);}
+
+	template<typename T, typename Compare, typename Alloc>
+	bool	operator<=(const set<T, Compare, Alloc>& lhs, const set<T, Compare, Alloc>& rhs)
+		{return (!(rhs < lhs));}
+
+	template<typename T, typename Compare, typename Alloc>
+	bool	operator>=(const set<T, Compare, Alloc>& lhs, const set<T, Compare, Alloc>& rhs)
+		{return (!(lhs < rhs));}
+}
+
+#endif
@@ -0,0 +1,334 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sharded_map.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:54:36 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 10:49:36 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SHARDED_MAP_HPP
+# define SHARDED_MAP_HPP
+
+# include <cstddef>		// size_t
+# include <functional>	// std::less
+# include <memory>		// std::allocator
+# include <pthread.h>	// pthread_mutex_t
+
+# include "map.hpp"
+# include "../Others/hash.hpp"
+# include "../Others/pair.hpp"
+# include "../Others/prefetch.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Sharded map -
+		Map for many threads writing at once: the keys are spread by hash over Shards independent maps, each behind a mutex of its own, so that threads writing different keys rarely wait for each other, where a single map behind a single lock lets one writer in at a time.
+		Each shard (its mutex and its map) is followed by a cache line of padding, so that two shards never share a line: a thread taking one lock does not slow down the cores working on the others.
+		Operations on one key lock one shard. size, clear and for_each lock all the shards, in order, and see a consistent state; for_each visits the elements in key order by merging the shards.
+		Not copyable, since the mutexes are not.
+	-------------------------------------------------------------------------------- */
+	template<class Key, class T, size_t Shards = 16, class Hash = hash<Key>, class Compare = std::less<Key>, class Alloc = std::allocator<pair<const Key, T> > >
+	class sharded_map
+	{
+		public:
+			typedef				Key											key_type;
+			typedef				T											mapped_type;
+			typedef				pair<const key_type, mapped_type>			value_type;
+			typedef				Hash										hasher;
+			typedef				Compare										key_compare;
+			typedef				Alloc										allocator_type;
+			typedef				map<Key, T, Compare, Alloc>					map_type;
+			typedef				size_t										size_type;
+
+		private:
+			struct	_shard
+			{
+				pthread_mutex_t		mutex;
+				map_type			map;
+				char				pad[FT_CACHE_LINE];
+			};
+
+			mutable _shard				_shards[Shards];
+			hasher						_hash;
+			key_compare					_comp;
+
+			sharded_map(const sharded_map&);
+			sharded_map&				operator=(const sharded_map&);
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTOR ----- */
+
+			explicit sharded_map(const hasher& hf = hasher(), const key_compare& comp = key_compare()) : _hash(hf), _comp(comp)
+			{
+				for (size_type i = 0; i < Shards; i++)
+				{
+					pthread_mutex_init(&_shards[i].mutex, NULL);
+					_shards[i].map = map_type(comp);
+				}
+
+				return;
+			}
+
+			~sharded_map()
+			{
+				for (size_type i = 0; i < Shards; i++)
+					pthread_mutex_destroy(&_shards[i].mutex);
+
+				return;
+			}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			/* --- Capacity --- */
+
+			bool						empty() const
+				{return (!size());}
+
+			size_type					size() const
+			{
+				size_type	n = 0;
+
+				_lock_all();
+				for (size_type i = 0; i < Shards; i++)
+					n += _shards[i].map.size();
+				_unlock_all();
+
+				return (n);
+			}
+
+
+			/* --- Lookup --- */
+
+			/* --------------------------------------------------------------------------------
+			- Get element -
+				Copies the value mapped to k into obj, and returns false, leaving obj unchanged, if there is no such element.
+			-------------------------------------------------------------------------------- */
+			bool						get(const key_type& k, mapped_type& obj) const
+			{
+				_shard&									s = _shard_of(k);
+				const map_type&							m = s.map;
+				bool									found;
+
+				pthread_mutex_lock(&s.mutex);
+				try
+				{
+					typename map_type::const_iterator	it = m.find(k);
+
+					found = (it != m.end());
+					if (found)
+						obj = it->second;
+				}
+				catch (...)
+				{
+					pthread_mutex_unlock(&s.mutex);
+					throw;
+				}
+				pthread_mutex_unlock(&s.mutex);
+
+				return (found);
+			}
+
+			size_type					count(const key_type& k) const
+			{
+				_shard&		s = _shard_of(k);
+				size_type	n;
+
+				pthread_mutex_lock(&s.mutex);
+				n = s.map.count(k);
+				pthread_mutex_unlock(&s.mutex);
+
+				return (n);
+			}
+
+
+			/* --- Modifiers --- */
+
+			/* --------------------------------------------------------------------------------
+			- Insert element -
+				Inserts val unless there is already an element with an equivalent key, and returns whether it did.
+			-------------------------------------------------------------------------------- */
+			bool						insert(const value_type& val)
+			{
+				_shard&	s = _shard_of(val.first);
+				bool	inserted;
+
+				pthread_mutex_lock(&s.mutex);
+				try
+				{
+					inserted = s.map.insert(val).second;
+				}
+				catch (...)
+				{
+					pthread_mutex_unlock(&s.mutex);
+					throw;
+				}
+				pthread_mutex_unlock(&s.mutex);
+
+				return (inserted);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Update element -
+				Calls f on the value mapped to k, inserting a value-initialized one first if there is none, with the shard of k locked; returns f.
+				The read-modify-write of a shared counter, for instance, is a single update.
+			-------------------------------------------------------------------------------- */
+			template<class Function>
+			Function					update(const key_type& k, Function f)
+			{
+				_shard&	s = _shard_of(k);
+
+				pthread_mutex_lock(&s.mutex);
+				try
+				{
+					f(s.map[k]);
+				}
+				catch (...)
+				{
+					pthread_mutex_unlock(&s.mutex);
+					throw;
+				}
+				pthread_mutex_unlock(&s.mutex);
+
+				return (f);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert or assign element -
+				Maps obj to k, inserting it if there is no element with key k, and returns whether it inserted.
+			-------------------------------------------------------------------------------- */
+			bool						insert_or_assign(const key_type& k, const mapped_type& obj)
+			{
+				_shard&								s = _shard_of(k);
+				bool								inserted;
+
+				pthread_mutex_lock(&s.mutex);
+				try
+				{
+					typename map_type::iterator		it = s.map.lower_bound(k);
+
+					inserted = (it == s.map.end() || _comp(k, it->first));
+					if (inserted)
+						s.map.insert(it, value_type(k, obj));
+					else
+						it->second = obj;
+				}
+				catch (...)
+				{
+					pthread_mutex_unlock(&s.mutex);
+					throw;
+				}
+				pthread_mutex_unlock(&s.mutex);
+
+				return (inserted);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase element -
+				Returns the number of elements erased, 0 or 1.
+			-------------------------------------------------------------------------------- */
+			size_type					erase(const key_type& k)
+			{
+				_shard&		s = _shard_of(k);
+				size_type	n;
+
+				pthread_mutex_lock(&s.mutex);
+				n = s.map.erase(k);
+				pthread_mutex_unlock(&s.mutex);
+
+				return (n);
+			}
+
+			void						clear()
+			{
+				_lock_all();
+				for (size_type i = 0; i < Shards; i++)
+					_shards[i].map.clear();
+				_unlock_all();
+
+				return;
+			}
+
+
+			/* --- Iteration --- */
+
+			/* --------------------------------------------------------------------------------
+			- Apply function to elements -
+				Calls f on every element in key order and returns it, with all the shards locked: f must not call back into the map.
+				Merges the shards, which are each sorted, by taking the smallest of their next elements at every step: O(Shards) comparisons per element.
+			-------------------------------------------------------------------------------- */
+			template<class Function>
+			Function					for_each(Function f) const
+			{
+				const map_type*						maps[Shards];
+				typename map_type::const_iterator	next[Shards];
+
+				_lock_all();
+				try
+				{
+					for (size_type i = 0; i < Shards; i++)
+					{
+						maps[i] = &_shards[i].map;
+						next[i] = maps[i]->begin();
+					}
+					while (true)
+					{
+						size_type	min = Shards;
+
+						for (size_type i = 0; i < Shards; i++)
+						{
+							if (next[i] != maps[i]->end() && (min == Shards || _comp(next[i]->first, next[min]->first)))
+								min = i;
+						}
+						if (min == Shards)
+							break;
+						f(*next[min]++);
+					}
+				}
+				catch (...)
+				{
+					_unlock_all();
+					throw;
+				}
+				_unlock_all();
+
+				return (f);
+			}
+
+
+			/* --- Observers --- */
+
+			hasher						hash_function() const
+				{return (_hash);}
+
+			key_compare					key_comp() const
+				{return (_comp);}
+
+		private:
+			_shard&						_shard_of(const key_type& k) const
+				{return (_shards[hash_mix(_hash(k)) % Shards]);}
+
+			void						_lock_all() const
+			{
+				for (size_type i = 0; i < Shards; i++)
+					pthread_mutex_lock(&_shards[i].mutex);
+
+				return;
+			}
+
+			void						_unlock_all() const
+			{
+				for (size_type i = Shards; i > 0; i--)
+					pthread_mutex_unlock(&_shards[i - 1].mutex);
+
+				return;
+			}
+	};
+}
+
+#endif
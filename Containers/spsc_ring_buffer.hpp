@@ -0,0 +1,239 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spsc_ring_buffer.hpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:06:00 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 10:06:00 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SPSC_RING_BUFFER_HPP
+# define SPSC_RING_BUFFER_HPP
+
+# include <cstddef>		// size_t
+# include <memory>		// std::allocator
+
+# include "ring_buffer.hpp"
+# include "../Others/prefetch.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Single-producer single-consumer ring buffer -
+		Bounded queue between exactly two threads, one that pushes and one that pops, without a lock or a compare-and-swap: each index is written by one thread only, the tail by the producer and the head by the consumer, and published with a release store that the other side reads with an acquire load.
+		The indices count every push and pop since construction; an element's slot is its index masked with the capacity minus one, which is why the capacity is rounded up to a power of two.
+		The head and the tail are on cache lines of their own, each next to the copy its owner keeps of the other index: the producer only reads the head again when its copy says the buffer is full, and the consumer the tail when its copy says it is empty, so that in a steady stream the two cores rarely pull each other's line.
+		push_n and pop_n move a whole batch for one index update.
+	-------------------------------------------------------------------------------- */
+	template<class T, class Alloc = std::allocator<T> >
+	class spsc_ring_buffer
+	{
+		public:
+			typedef T				value_type;
+			typedef Alloc			allocator_type;
+			typedef size_t			size_type;
+
+		private:
+			value_type*			_slots;
+			size_type			_mask;
+			allocator_type		_alloc;
+			char				_pad0[FT_CACHE_LINE];
+			size_type			_head;
+			size_type			_tail_cache;
+			char				_pad1[FT_CACHE_LINE - 2 * sizeof(size_type)];
+			size_type			_tail;
+			size_type			_head_cache;
+			char				_pad2[FT_CACHE_LINE - 2 * sizeof(size_type)];
+
+			spsc_ring_buffer(const spsc_ring_buffer&);
+			spsc_ring_buffer&	operator=(const spsc_ring_buffer&);
+
+		public:
+			/* ----- CONSTRUCTOR AND DESTRUCTOR ----- */
+
+			/* --------------------------------------------------------------------------------
+			- Constructor -
+				Holds at most capacity elements, rounded up to a power of two.
+			-------------------------------------------------------------------------------- */
+			explicit spsc_ring_buffer(size_type capacity) : _slots(NULL), _mask(ring_capacity(capacity) - 1), _alloc(), _head(0), _tail_cache(0), _tail(0), _head_cache(0)
+			{
+				_slots = _alloc.allocate(_mask + 1);
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Destructor -
+				Neither thread may still use the buffer.
+			-------------------------------------------------------------------------------- */
+			~spsc_ring_buffer()
+			{
+				for (; _head != _tail; _head++)
+					_alloc.destroy(_slots + (_head & _mask));
+				_alloc.deallocate(_slots, _mask + 1);
+
+				return;
+			}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			/* --------------------------------------------------------------------------------
+			- Return size -
+				Exact from the producer or the consumer when the other is idle; otherwise a value the size had between the two loads.
+			-------------------------------------------------------------------------------- */
+			size_type				size() const
+			{
+				size_type	head = __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+
+				return (__atomic_load_n(&_tail, __ATOMIC_ACQUIRE) - head);
+			}
+
+			bool					empty() const
+				{return (!size());}
+
+			size_type				capacity() const
+				{return (_mask + 1);}
+
+			/* --------------------------------------------------------------------------------
+			- Insert element -
+				Producer only. Returns false, leaving the buffer unchanged, if it is full.
+			-------------------------------------------------------------------------------- */
+			bool					push(const value_type& val)
+			{
+				size_type	tail = _tail;
+
+				if (tail - _head_cache > _mask)
+				{
+					_head_cache = __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+					if (tail - _head_cache > _mask)
+						return (false);
+				}
+				_alloc.construct(_slots + (tail & _mask), val);
+				__atomic_store_n(&_tail, tail + 1, __ATOMIC_RELEASE);
+
+				return (true);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert elements -
+				Producer only. Pushes as many of the n elements from first as there is room for, and returns how many.
+				If copying an element throws, the ones before it are pushed.
+			-------------------------------------------------------------------------------- */
+			template<class InputIterator>
+			size_type				push_n(InputIterator first, size_type n)
+			{
+				size_type	tail = _tail;
+				size_type	room = _mask + 1 - (tail - _head_cache);
+
+				if (room < n)
+				{
+					_head_cache = __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+					room = _mask + 1 - (tail - _head_cache);
+				}
+				if (n > room)
+					n = room;
+
+				size_type	i = 0;
+
+				try
+				{
+					for (; i < n; i++, ++first)
+						_alloc.construct(_slots + ((tail + i) & _mask), *first);
+				}
+				catch (...)
+				{
+					__atomic_store_n(&_tail, tail + i, __ATOMIC_RELEASE);
+					throw;
+				}
+				__atomic_store_n(&_tail, tail + n, __ATOMIC_RELEASE);
+
+				return (n);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Remove next element -
+				Consumer only. Moves the oldest element into val and returns true, or returns false if the buffer is empty.
+				If copying the element throws, it stays in the buffer.
+			-------------------------------------------------------------------------------- */
+			bool					pop(value_type& val)
+			{
+				size_type	head = _head;
+
+				if (!_ready(head, 1))
+					return (false);
+				val = _slots[head & _mask];
+				_alloc.destroy(_slots + (head & _mask));
+				__atomic_store_n(&_head, head + 1, __ATOMIC_RELEASE);
+
+				return (true);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Remove next element -
+				Consumer only. Drops the oldest element and returns true, or returns false if the buffer is empty.
+			-------------------------------------------------------------------------------- */
+			bool					pop()
+			{
+				size_type	head = _head;
+
+				if (!_ready(head, 1))
+					return (false);
+				_alloc.destroy(_slots + (head & _mask));
+				__atomic_store_n(&_head, head + 1, __ATOMIC_RELEASE);
+
+				return (true);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Remove elements -
+				Consumer only. Moves up to n of the oldest elements, in order, to out, and returns how many.
+				If copying an element throws, the ones before it are removed and it stays in the buffer.
+			-------------------------------------------------------------------------------- */
+			template<class OutputIterator>
+			size_type				pop_n(OutputIterator out, size_type n)
+			{
+				size_type	head = _head;
+
+				if (!_ready(head, n))
+					n = _tail_cache - head;
+
+				size_type	i = 0;
+
+				try
+				{
+					for (; i < n; i++, ++out)
+					{
+						*out = _slots[(head + i) & _mask];
+						_alloc.destroy(_slots + ((head + i) & _mask));
+					}
+				}
+				catch (...)
+				{
+					__atomic_store_n(&_head, head + i, __ATOMIC_RELEASE);
+					throw;
+				}
+				__atomic_store_n(&_head, head + n, __ATOMIC_RELEASE);
+
+				return (n);
+			}
+
+		private:
+			/* --------------------------------------------------------------------------------
+			- Check for elements -
+				Returns whether at least n elements follow head, loading the tail again only if the consumer's copy of it says there are fewer.
+			-------------------------------------------------------------------------------- */
+			bool					_ready(size_type head, size_type n)
+			{
+				if (_tail_cache - head >= n)
+					return (true);
+				_tail_cache = __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+
+				return (_tail_cache - head >= n);
+			}
+	};
+}
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/07 11:46:53 by hcremers          #+#    #+#             */
-/*   Updated: 2022/12/20 15:50:12 by hcremers         ###   ########.fr       */
+/*   Updated: 2026/10/19 10:17:40 by hcremers         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -127,6 +127,63 @@ namespace ft
 				return;
 			}
 
+			/* --------------------------------------------------------------------------------
+			- Construct and insert element -
+				Adds a new element at the top of the stack, above its current top element. This new element is constructed in place passing args as the arguments for its constructor.
+				This member function effectively calls the member function emplace_back of the underlying container, which has one overload per number of arguments, up to three.
+
+			Source: https://cplusplus.com/reference/stack/stack/emplace/
+			-------------------------------------------------------------------------------- */
+			void				emplace()
+			{
+				c.emplace_back();
+				return;
+			}
+
+			template<class A1>
+			void				emplace(const A1& a1)
+			{
+				c.emplace_back(a1);
+				return;
+			}
+
+			template<class A1, class A2>
+			void				emplace(const A1& a1, const A2& a2)
+			{
+				c.emplace_back(a1, a2);
+				return;
+			}
+
+			template<class A1, class A2, class A3>
+			void				emplace(const A1& a1, const A2& a2, const A3& a3)
+			{
+				c.emplace_back(a1, a2, a3);
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert range of elements -
+				Pushes the elements of [first, last) in order, so that the last one ends up on top.
+				This member function effectively calls the member function insert of the underlying container object at its end, which makes room for the whole range at once instead of growing once per element.
+			-------------------------------------------------------------------------------- */
+			template<class InputIterator>
+			void				push_range(InputIterator first, InputIterator last)
+			{
+				c.insert(c.end(), first, last);
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Remove top elements -
+				Removes the n top elements, which must be at most size().
+				This member function effectively calls the member function erase of the underlying container object on its last n elements, destroying them in one pass.
+			-------------------------------------------------------------------------------- */
+			void				pop_n(size_type n)
+			{
+				c.erase(c.end() - n, c.end());
+				return;
+			}
+
 			template <class T1, class Container1>
 			friend bool operator==(const stack<T1, Container1>& lhs, const stack<T1, Container1>& rhs);
 
@@ -0,0 +1,368 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   static_index.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:26:12 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 09:26:12 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef STATIC_INDEX_HPP
+# define STATIC_INDEX_HPP
+
+# include <cstddef>		// size_t
+# include <functional>	// std::less
+# include <memory>		// std::allocator
+
+# include "map.hpp"
+# include "vector.hpp"
+# include "../Iterators/eytzinger_iterator.hpp"
+# include "../Iterators/reverse_iterator.hpp"
+# include "../Others/pair.hpp"
+# include "../Others/prefetch.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Static index -
+		Read-only snapshot of a map, built once from a map or from a range sorted by key with unique keys, and searched with lower_bound and friends faster than the map or a binary search can.
+		The keys are laid out in Eytzinger order: the array is a complete binary search tree in breadth-first order, the children of slot k being slots 2k and 2k + 1, so the first levels of every search share the same few cache lines.
+		The descent is branchless (the next slot is 2k plus the result of the comparison), so it never mispredicts, and it prefetches the cache line holding the descendants of the current slot four levels down (for 4-byte keys) while comparing: the memory latency of the lower levels overlaps with the comparisons of the upper ones.
+		The elements are kept in the same order in an array of their own, so that the slot found is also the index of the element: a search touches the key array and one element.
+		Iterating walks both in sorted order, as an in-order walk of the implicit tree.
+	-------------------------------------------------------------------------------- */
+	template<class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<pair<const Key, T> > >
+	class static_index
+	{
+		public:
+			typedef				Key																key_type;
+			typedef				T																mapped_type;
+			typedef				pair<const key_type, mapped_type>								value_type;
+			typedef				Compare															key_compare;
+			typedef				Alloc															allocator_type;
+			typedef typename	allocator_type::const_reference									reference;
+			typedef typename	allocator_type::const_reference									const_reference;
+			typedef typename	allocator_type::const_pointer									pointer;
+			typedef typename	allocator_type::const_pointer									const_pointer;
+			typedef				eytzinger_iterator<const value_type>							iterator;
+			typedef				eytzinger_iterator<const value_type>							const_iterator;
+			typedef typename	ft::reverse_iterator<iterator>									reverse_iterator;
+			typedef typename	ft::reverse_iterator<const_iterator>							const_reverse_iterator;
+			typedef typename	iterator_traits<iterator>::difference_type						difference_type;
+			typedef				size_t															size_type;
+
+		private:
+			typedef typename	Alloc::template rebind<Key>::other								key_allocator;
+
+			/* Number of keys per cache line, rounded down to a power of two: the descendants of slot k that many levels below, all in a row from slot k * _block, share one line. */
+			enum																				{_block = (sizeof(Key) >= FT_CACHE_LINE / 2 ? 1 : (sizeof(Key) >= FT_CACHE_LINE / 4 ? 2 : (sizeof(Key) >= FT_CACHE_LINE / 8 ? 4 : (sizeof(Key) >= FT_CACHE_LINE / 16 ? 8 : 16))))};
+
+			key_type*			_storage;
+			key_type*			_keys;
+			vector<value_type>	_values;
+			key_compare			_comp;
+			key_allocator		_key_alloc;
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTOR ----- */
+
+			/* --------------------------------------------------------------------------------
+			- Empty index constructor (default constructor) -
+			-------------------------------------------------------------------------------- */
+			explicit static_index(const key_compare& comp = key_compare()) : _storage(NULL), _keys(NULL), _values(), _comp(comp), _key_alloc()
+				{return;}
+
+			/* --------------------------------------------------------------------------------
+			- Range constructor -
+				Builds the index of the elements in [first, last], which must be sorted by key with no two equivalent keys, such as the elements of a map or a sorted vector.
+			-------------------------------------------------------------------------------- */
+			template<class InputIterator>
+			static_index(InputIterator first, InputIterator last, const key_compare& comp = key_compare()) : _storage(NULL), _keys(NULL), _values(), _comp(comp), _key_alloc()
+			{
+				vector<value_type>	sorted;
+
+				for (; first != last; first++)
+					sorted.push_back(*first);
+				_build(sorted);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Map constructor -
+				Builds the index of the elements of m, with the same comparison object.
+			-------------------------------------------------------------------------------- */
+			template<class MapAlloc, class Aggregate>
+			explicit static_index(const map<Key, T, Compare, MapAlloc, Aggregate>& m) : _storage(NULL), _keys(NULL), _values(), _comp(m.key_comp()), _key_alloc()
+			{
+				vector<value_type>	sorted;
+
+				sorted.reserve(m.size());
+				for (typename map<Key, T, Compare, MapAlloc, Aggregate>::const_iterator it = m.begin(); it != m.end(); it++)
+					sorted.push_back(*it);
+				_build(sorted);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Copy constructor -
+			-------------------------------------------------------------------------------- */
+			static_index(const static_index& x) : _storage(NULL), _keys(NULL), _values(x._values), _comp(x._comp), _key_alloc()
+			{
+				_build_keys();
+				return;
+			}
+
+			~static_index()
+			{
+				_free();
+				return;
+			}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			/* --- Operator overloads --- */
+
+			static_index&							operator=(const static_index& x)
+			{
+				if (this == &x)
+					return (*this);
+
+				static_index	tmp(x);
+
+				swap(tmp);
+
+				return (*this);
+			}
+
+
+			/* --- Iterators --- */
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to beginning -
+				Iterates over the elements in sorted order.
+			-------------------------------------------------------------------------------- */
+			const_iterator							begin() const
+				{return (++end());}
+
+			const_iterator							end() const
+				{return (_at(0));}
+
+			const_reverse_iterator					rbegin() const
+				{return (const_reverse_iterator(end()));}
+
+			const_reverse_iterator					rend() const
+				{return (const_reverse_iterator(begin()));}
+
+
+			/* --- Capacity --- */
+
+			bool									empty() const
+				{return (_values.empty());}
+
+			size_type								size() const
+				{return (_values.size());}
+
+
+			/* --- Operations --- */
+
+			/* --------------------------------------------------------------------------------
+			- Get iterator to element -
+			-------------------------------------------------------------------------------- */
+			const_iterator							find(const key_type& k) const
+			{
+				const_iterator	it = lower_bound(k);
+
+				if (it != end() && _comp(k, it->first))
+					return (end());
+
+				return (it);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Count elements with a specific key -
+			-------------------------------------------------------------------------------- */
+			size_type								count(const key_type& k) const
+				{return (find(k) != end());}
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to lower bound -
+				Descends from slot 1, going to slot 2k + 1 when the key at slot k is less than k and to 2k otherwise, until past the last slot.
+				The bits of the final slot record the path: the right turns taken after the last left turn are its trailing ones, and dropping them along with that last left turn leaves the slot of the lower bound (0 if the path only turned right, for end()).
+			-------------------------------------------------------------------------------- */
+			const_iterator							lower_bound(const key_type& k) const
+			{
+				size_type	n = size();
+				size_type	i = 1;
+
+				while (i <= n)
+				{
+					FT_PREFETCH(_keys + i * _block);
+					i = 2 * i + _comp(_keys[i], k);
+				}
+
+				return (_at(_drop_right_turns(i)));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to upper bound -
+				Same descent, going right when the key at slot k is not greater than k.
+			-------------------------------------------------------------------------------- */
+			const_iterator							upper_bound(const key_type& k) const
+			{
+				size_type	n = size();
+				size_type	i = 1;
+
+				while (i <= n)
+				{
+					FT_PREFETCH(_keys + i * _block);
+					i = 2 * i + !_comp(k, _keys[i]);
+				}
+
+				return (_at(_drop_right_turns(i)));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Get range of equal elements -
+			-------------------------------------------------------------------------------- */
+			pair<const_iterator, const_iterator>	equal_range(const key_type& k) const
+			{
+				const_iterator	it = lower_bound(k);
+
+				if (it == end() || _comp(k, it->first))
+					return (pair<const_iterator, const_iterator>(it, it));
+
+				return (pair<const_iterator, const_iterator>(it, ++const_iterator(it)));
+			}
+
+
+			/* --- Modifiers --- */
+
+			void									swap(static_index& x)
+			{
+				key_type*	tmp_storage = _storage;
+				key_type*	tmp_keys = _keys;
+				key_compare	tmp_comp = _comp;
+
+				_storage = x._storage;
+				_keys = x._keys;
+				_comp = x._comp;
+				x._storage = tmp_storage;
+				x._keys = tmp_keys;
+				x._comp = tmp_comp;
+				_values.swap(x._values);
+
+				return;
+			}
+
+
+			/* --- Observers --- */
+
+			key_compare								key_comp() const
+				{return (_comp);}
+
+		private:
+			const_iterator							_at(size_type slot) const
+				{return (const_iterator(_values.begin().base(), size(), slot));}
+
+			static size_type						_drop_right_turns(size_type i)
+			{
+# ifdef __GNUC__
+				return (i >> (__builtin_ctzl(~i) + 1));
+# else
+				while (i & 1)
+					i >>= 1;
+
+				return (i >> 1);
+# endif
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Build Eytzinger layout -
+				Walks the implicit tree in order, giving each slot the next element in sorted order, then appends the elements slot by slot.
+				The in-order successor of a slot is the leftmost slot of its right subtree, or else the parent it is in the left subtree of: the same right turns to drop as at the end of a search.
+			-------------------------------------------------------------------------------- */
+			void									_build(const vector<value_type>& sorted)
+			{
+				size_type			n = sorted.size();
+				vector<size_type>	rank;
+				size_type			i = 1;
+
+				rank.resize(n + 1);
+				while (2 * i <= n)
+					i *= 2;
+				for (size_type r = 0; r < n; r++)
+				{
+					rank[i] = r;
+					if (2 * i + 1 <= n)
+					{
+						i = 2 * i + 1;
+						while (2 * i <= n)
+							i *= 2;
+					}
+					else
+						i = _drop_right_turns(i);
+				}
+				_values.reserve(n);
+				for (i = 1; i <= n; i++)
+					_values.push_back(sorted[rank[i]]);
+				_build_keys();
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Build key array -
+				Copies the key of each element to its slot, in an array with room to align slot 0 on a cache line when the size of Key allows it.
+				Slot 0 is never searched; it holds a copy of the first key so that every slot is constructed.
+			-------------------------------------------------------------------------------- */
+			void									_build_keys()
+			{
+				size_type	n = _values.size();
+
+				if (!n)
+					return;
+
+				_storage = _key_alloc.allocate(n + 1 + _block);
+				_keys = _storage;
+				if (!(FT_CACHE_LINE % sizeof(Key)))
+					_keys += (FT_CACHE_LINE - reinterpret_cast<size_t>(_storage) % FT_CACHE_LINE) % FT_CACHE_LINE / sizeof(Key) % _block;
+				_key_alloc.construct(_keys, _values[0].first);
+				for (size_type i = 1; i <= n; i++)
+					_key_alloc.construct(_keys + i, _values[i - 1].first);
+
+				return;
+			}
+
+			void									_free()
+			{
+				if (!_storage)
+					return;
+
+				for (size_type i = 0; i <= size(); i++)
+					_key_alloc.destroy(_keys + i);
+				_key_alloc.deallocate(_storage, size() + 1 + _block);
+				_storage = NULL;
+				_keys = NULL;
+
+				return;
+			}
+	};
+
+
+	/* ----- NON-MEMBER FUNCTION ----- */
+
+	template<class Key, class T, class Compare, class Alloc>
+	void	swap(static_index<Key, T, Compare, Alloc>& x, static_index<Key, T, Compare, Alloc>& y)
+	{
+		x.swap(y);
+		return;
+	}
+}
+
+#endif
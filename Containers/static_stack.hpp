@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   static_stack.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:18:38 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 10:18:38 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef STATIC_STACK_HPP
+# define STATIC_STACK_HPP
+
+# include <cstddef>		// size_t
+
+# include "stack.hpp"
+# include "static_vector.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Static stack -
+		Stack of at most N elements, over a static_vector: the elements are stored inside the object, with no allocation.
+		Pushing onto a full stack throws std::out_of_range and leaves it unchanged; full tells whether the next push would.
+	-------------------------------------------------------------------------------- */
+	template<typename T, size_t N>
+	class static_stack : public stack<T, static_vector<T, N> >
+	{
+		public:
+			typedef typename stack<T, static_vector<T, N> >::container_type	container_type;
+			typedef typename stack<T, static_vector<T, N> >::size_type		size_type;
+
+			/* ----- CONSTRUCTOR ----- */
+
+			explicit static_stack(const container_type& ctnr = container_type()) : stack<T, static_vector<T, N> >(ctnr)
+				{return;}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			bool				full() const
+				{return (this->c.full());}
+
+			size_type			capacity() const
+				{return (N);}
+	};
+}
+
+#endif
@@ -0,0 +1,535 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   static_vector.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:18:29 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 11:09:16 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef STATIC_VECTOR_HPP
+# define STATIC_VECTOR_HPP
+
+# include <cstddef>		// size_t
+# include <new>			// placement new
+# include <stdexcept>	// std::out_of_range
+
+# include "../Iterators/iterator_traits.hpp"
+# include "../Iterators/random_access_iterator.hpp"
+# include "../Iterators/reverse_iterator.hpp"
+# include "../Others/algorithm.hpp"
+# include "../Others/type_traits.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Static vector -
+		Vector of at most N elements, stored in a buffer inside the object itself, aligned for T: it never allocates, so one declared on the stack costs no allocator call, and its elements are next to the rest of the frame.
+		The interface is that of vector, with a capacity that is always N. Going over it is an error, not a reallocation: every member that would grow the vector past N elements throws std::out_of_range, before changing anything, and full tells whether the next push_back would.
+	-------------------------------------------------------------------------------- */
+	template<typename T, size_t N>
+	class static_vector
+	{
+		public:
+			typedef				T												value_type;
+			typedef				value_type&										reference;
+			typedef				const value_type&								const_reference;
+			typedef				value_type*										pointer;
+			typedef				const value_type*								const_pointer;
+			typedef typename	ft::random_access_iterator<value_type>			iterator;
+			typedef typename	ft::random_access_iterator<const value_type>	const_iterator;
+			typedef typename	ft::reverse_iterator<iterator>					reverse_iterator;
+			typedef typename	ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+			typedef typename	iterator_traits<iterator>::difference_type		difference_type;
+			typedef				size_t											size_type;
+
+		private:
+			/* --------------------------------------------------------------------------------
+			- Element buffer -
+				Raw bytes for N elements. C++98 has no alignas: the other members, never used, give the union the strictest alignment of the fundamental types, which is enough for any T.
+			-------------------------------------------------------------------------------- */
+			union			_buffer
+			{
+				char		bytes[sizeof(T) * (N ? N : 1)];
+				long double	align_long_double;
+				double		align_double;
+				long		align_long;
+				void*		align_pointer;
+				void		(*align_function)();
+			};
+
+			_buffer			_storage;
+			size_type		_size;
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTOR ----- */
+
+			static_vector() : _size(0)
+				{return;}
+
+			explicit static_vector(size_type n, const value_type& val = value_type()) : _size(0)
+			{
+				assign(n, val);
+				return;
+			}
+
+			template<class InputIterator>
+			static_vector(InputIterator first, InputIterator last, typename enable_if<!is_integral<InputIterator>::value>::type* = NULL) : _size(0)
+			{
+				assign(first, last);
+				return;
+			}
+
+			static_vector(const static_vector& x) : _size(0)
+			{
+				assign(x.begin(), x.end());
+				return;
+			}
+
+			~static_vector()
+			{
+				clear();
+				return;
+			}
+
+
+			/* ----- OPERATOR OVERLOADS ----- */
+
+			static_vector&			operator=(const static_vector& x)
+			{
+				if (this != &x)
+					assign(x.begin(), x.end());
+
+				return (*this);
+			}
+
+			reference				operator[](size_type n)
+				{return (_data()[n]);}
+
+			const_reference			operator[](size_type n) const
+				{return (_data()[n]);}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			/* ITERATORS */
+
+			iterator				begin()
+				{return (iterator(_data()));}
+
+			const_iterator			begin() const
+				{return (const_iterator(_data()));}
+
+			iterator				end()
+				{return (iterator(_data() + _size));}
+
+			const_iterator			end() const
+				{return (const_iterator(_data() + _size));}
+
+			reverse_iterator		rbegin()
+				{return (reverse_iterator(end()));}
+
+			const_reverse_iterator	rbegin() const
+				{return (const_reverse_iterator(end()));}
+
+			reverse_iterator		rend()
+				{return (reverse_iterator(begin()));}
+
+			const_reverse_iterator	rend() const
+				{return (const_reverse_iterator(begin()));}
+
+			/* CAPACITY */
+
+			size_type				size() const
+				{return (_size);}
+
+			size_type				max_size() const
+				{return (N);}
+
+			size_type				capacity() const
+				{return (N);}
+
+			bool					empty() const
+				{return (!_size);}
+
+			bool					full() const
+				{return (_size == N);}
+
+			void					resize(size_type n, value_type val = value_type())
+			{
+				_check(n, "static_vector::resize");
+				while (_size < n)
+					push_back(val);
+				while (_size > n)
+					pop_back();
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Request a change in capacity -
+				Nothing to allocate: only throws std::out_of_range if n is greater than N.
+			-------------------------------------------------------------------------------- */
+			void					reserve(size_type n)
+			{
+				_check(n, "static_vector::reserve");
+				return;
+			}
+
+			/* ELEMENT ACCESS */
+
+			reference				at(size_type n)
+			{
+				if (n >= _size)
+					throw (std::out_of_range("static_vector::at"));
+
+				return (_data()[n]);
+			}
+
+			const_reference			at(size_type n) const
+			{
+				if (n >= _size)
+					throw (std::out_of_range("static_vector::at"));
+
+				return (_data()[n]);
+			}
+
+			reference				front()
+				{return (_data()[0]);}
+
+			const_reference			front() const
+				{return (_data()[0]);}
+
+			reference				back()
+				{return (_data()[_size - 1]);}
+
+			const_reference			back() const
+				{return (_data()[_size - 1]);}
+
+			pointer					data()
+				{return (_data());}
+
+			const_pointer			data() const
+				{return (_data());}
+
+			/* MODIFIERS */
+
+			template<class InputIterator>
+			void					assign(InputIterator first, InputIterator last, typename enable_if<!is_integral<InputIterator>::value>::type* = NULL)
+			{
+				_assign_range(first, last, ft::_pass_category(typename iterator_traits<InputIterator>::iterator_category()));
+
+				return;
+			}
+
+			void					assign(size_type n, const value_type& val)
+			{
+				_check(n, "static_vector::assign");
+
+				value_type	tmp(val);
+
+				clear();
+				while (_size < n)
+					_construct(_size, tmp);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Add element at the end -
+				Throws std::out_of_range if the vector is full.
+			-------------------------------------------------------------------------------- */
+			void					push_back(const value_type& val)
+			{
+				_check(_size + 1, "static_vector::push_back");
+				_construct(_size, val);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Construct and insert element at the end -
+				As vector::emplace_back, one overload per number of arguments, up to three. Throws std::out_of_range if the vector is full.
+			-------------------------------------------------------------------------------- */
+			void					emplace_back()
+			{
+				_check(_size + 1, "static_vector::emplace_back");
+				::new (static_cast<void*>(_data() + _size)) value_type();
+				_size++;
+
+				return;
+			}
+
+			template<class A1>
+			void					emplace_back(const A1& a1)
+			{
+				_check(_size + 1, "static_vector::emplace_back");
+				::new (static_cast<void*>(_data() + _size)) value_type(a1);
+				_size++;
+
+				return;
+			}
+
+			template<class A1, class A2>
+			void					emplace_back(const A1& a1, const A2& a2)
+			{
+				_check(_size + 1, "static_vector::emplace_back");
+				::new (static_cast<void*>(_data() + _size)) value_type(a1, a2);
+				_size++;
+
+				return;
+			}
+
+			template<class A1, class A2, class A3>
+			void					emplace_back(const A1& a1, const A2& a2, const A3& a3)
+			{
+				_check(_size + 1, "static_vector::emplace_back");
+				::new (static_cast<void*>(_data() + _size)) value_type(a1, a2, a3);
+				_size++;
+
+				return;
+			}
+
+			void					pop_back()
+			{
+				if (!_size)
+					return;
+
+				_size--;
+				_data()[_size].~value_type();
+
+				return;
+			}
+
+			iterator				insert(iterator position, const value_type& val)
+			{
+				difference_type	pos = position - begin();
+
+				insert(position, 1, val);
+
+				return (begin() + pos);
+			}
+
+			void					insert(iterator position, size_type n, const value_type& val)
+			{
+				_check(_size + n, "static_vector::insert");
+
+				value_type	tmp(val);
+				size_type	pos = position - begin();
+				size_type	old = _open(pos, n);
+
+				for (size_type i = pos; i < pos + n; i++)
+					_fill(i, old, tmp);
+
+				return;
+			}
+
+			template<class InputIterator>
+			void					insert(iterator position, InputIterator first, InputIterator last, typename enable_if<!is_integral<InputIterator>::value>::type* = NULL)
+			{
+				_insert_range(position, first, last, ft::_pass_category(typename iterator_traits<InputIterator>::iterator_category()));
+
+				return;
+			}
+
+			iterator				erase(iterator position)
+				{return (erase(position, position + 1));}
+
+			iterator				erase(iterator first, iterator last)
+			{
+				iterator	it = first;
+
+				for (iterator next = last; next != end(); ++it, ++next)
+					*it = *next;
+				while (end() != it)
+					pop_back();
+
+				return (first);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Swap content -
+				Swaps the elements one by one, the buffers being part of the objects: O(max(size(), x.size())), not O(1) as for vector.
+			-------------------------------------------------------------------------------- */
+			void					swap(static_vector& x)
+			{
+				static_vector&	small = (_size < x._size ? *this : x);
+				static_vector&	large = (_size < x._size ? x : *this);
+				size_type		n = small._size;
+
+				for (size_type i = 0; i < n; i++)
+				{
+					value_type	tmp(small[i]);
+
+					small[i] = large[i];
+					large[i] = tmp;
+				}
+				for (size_type i = n; i < large._size; i++)
+					small._construct(i, large[i]);
+				while (large._size > n)
+					large.pop_back();
+
+				return;
+			}
+
+			void					clear()
+			{
+				while (_size)
+					pop_back();
+
+				return;
+			}
+
+		private:
+			pointer					_data()
+				{return (static_cast<pointer>(static_cast<void*>(_storage.bytes)));}
+
+			const_pointer			_data() const
+				{return (static_cast<const_pointer>(static_cast<const void*>(_storage.bytes)));}
+
+			/* --------------------------------------------------------------------------------
+			- Range assign and insert helpers -
+				A range of forward iterators is counted and checked against N before anything changes, then copied in one pass.
+				A single-pass range cannot be counted without being consumed: it is pushed back one element at a time into a temporary static_vector, whose push_back checks the capacity, and copied from there, so that going over N still throws before this vector changes.
+			-------------------------------------------------------------------------------- */
+			template<class InputIterator>
+			void					_assign_range(InputIterator first, InputIterator last, input_iterator_tag)
+			{
+				static_vector	tmp;
+
+				for (; first != last; ++first)
+					tmp.push_back(*first);
+				_assign_range(tmp.begin(), tmp.end(), forward_iterator_tag());
+
+				return;
+			}
+
+			template<class ForwardIterator>
+			void					_assign_range(ForwardIterator first, ForwardIterator last, forward_iterator_tag)
+			{
+				_check(ft::distance(first, last), "static_vector::assign");
+				clear();
+				for (; first != last; ++first)
+					_construct(_size, *first);
+
+				return;
+			}
+
+			template<class InputIterator>
+			void					_insert_range(iterator position, InputIterator first, InputIterator last, input_iterator_tag)
+			{
+				static_vector	tmp;
+
+				for (; first != last; ++first)
+					tmp.push_back(*first);
+				_insert_range(position, tmp.begin(), tmp.end(), forward_iterator_tag());
+
+				return;
+			}
+
+			template<class ForwardIterator>
+			void					_insert_range(iterator position, ForwardIterator first, ForwardIterator last, forward_iterator_tag)
+			{
+				size_type	n = ft::distance(first, last);
+
+				_check(_size + n, "static_vector::insert");
+
+				size_type	pos = position - begin();
+				size_type	old = _open(pos, n);
+
+				for (size_type i = pos; i < pos + n; i++, ++first)
+					_fill(i, old, *first);
+
+				return;
+			}
+
+			void					_check(size_type n, const char* what) const
+			{
+				if (n > N)
+					throw (std::out_of_range(what));
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Construct element -
+				Constructs a copy of val in slot i, which must be the first free slot.
+			-------------------------------------------------------------------------------- */
+			void					_construct(size_type i, const value_type& val)
+			{
+				::new (static_cast<void*>(_data() + i)) value_type(val);
+				_size = i + 1;
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Open gap -
+				Moves the elements from position pos on n slots towards the end, and returns the previous size: the slots of the gap before it still hold elements, to assign, the others are free, to construct (see _fill).
+			-------------------------------------------------------------------------------- */
+			size_type				_open(size_type pos, size_type n)
+			{
+				size_type	old = _size;
+
+				if (!n)
+					return (old);
+				for (size_type i = old; i-- > pos; )
+				{
+					if (i + n >= old)
+						::new (static_cast<void*>(_data() + i + n)) value_type(_data()[i]);
+					else
+						_data()[i + n] = _data()[i];
+				}
+				_size = old + n;
+
+				return (old);
+			}
+
+			void					_fill(size_type i, size_type old, const value_type& val)
+			{
+				if (i < old)
+					_data()[i] = val;
+				else
+					::new (static_cast<void*>(_data() + i)) value_type(val);
+
+				return;
+			}
+	};
+	/* ----- RELATIONAL OPERATORS ----- */
+
+	template<class T, size_t N>
+	bool	operator==(const static_vector<T, N>& lhs, const static_vector<T, N>& rhs)
+		{return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));}
+
+	template<class T, size_t N>
+	bool	operator!=(const static_vector<T, N>& lhs, const static_vector<T, N>& rhs)
+		{return (!(lhs == rhs));}
+
+	template<class T, size_t N>
+	bool	operator<(const static_vector<T, N>& lhs, const static_vector<T, N>& rhs)
+		{return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));}
+
+	template<class T, size_t N>
+	bool	operator<=(const static_vector<T, N>& lhs, const static_vector<T, N>& rhs)
+		{return (!(rhs < lhs));}
+
+	template<class T, size_t N>
+	bool	operator>(const static_vector<T, N>& lhs, const static_vector<T, N>& rhs)
+		{return (rhs < lhs);}
+
+	template<class T, size_t N>
+	bool	operator>=(const static_vector<T, N>& lhs, const static_vector<T, N>& rhs)
+		{return (!(lhs < rhs));}
+
+	template<class T, size_t N>
+	void	swap(static_vector<T, N>& x, static_vector<T, N>& y)
+	{
+		x.swap(y);
+		return;
+	}
+}
+
+#endif
@@ -0,0 +1,497 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unordered_map.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:22:51 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 09:22:51 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef UNORDERED_MAP_HPP
+# define UNORDERED_MAP_HPP
+
+# include <cstddef>		// size_t
+# include <functional>	// std::equal_to
+# include <memory>		// std::allocator
+
+# include "vector.hpp"
+# include "../Iterators/hash_iterator.hpp"
+# include "../Iterators/iterator_traits.hpp"
+# include "../Others/hash.hpp"
+# include "../Others/hash_table.hpp"
+# include "../Others/pair.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Unordered map -
+		Unordered maps are associative containers that store elements formed by the combination of a key value and a mapped value, and which allows for fast retrieval of individual elements based on their keys.
+		The elements are kept in a hash_table: one array of slots probed linearly, with a control byte per slot so that 16 slots are checked at once before any key is compared. A lookup usually touches one group of control bytes and one slot.
+		Inserting may rehash the table, and erasing shifts elements back into the erased slot: both invalidate the iterators, pointers and references to the other elements.
+
+	Source: https://cplusplus.com/reference/unordered_map/unordered_map/
+	-------------------------------------------------------------------------------- */
+	template<class Key, class T, class Hash = ft::hash<Key>, class Pred = std::equal_to<Key>, class Alloc = std::allocator<pair<const Key, T> > >
+	class unordered_map
+	{
+		public:
+			typedef				Key																				key_type;
+			typedef				T																				mapped_type;
+			typedef				pair<const key_type, mapped_type>												value_type;
+			typedef				Hash																			hasher;
+			typedef				Pred																			key_equal;
+			typedef				Alloc																			allocator_type;
+			typedef typename	allocator_type::reference														reference;
+			typedef typename	allocator_type::const_reference													const_reference;
+			typedef typename	allocator_type::pointer															pointer;
+			typedef typename	allocator_type::const_pointer													const_pointer;
+			typedef				hash_iterator<value_type, value_type>											iterator;
+			typedef				hash_iterator<const value_type, value_type>										const_iterator;
+			typedef typename	iterator_traits<iterator>::difference_type										difference_type;
+			typedef				size_t																			size_type;
+
+		private:
+			typedef				hash_table<value_type, key_type, select_first<value_type>, Hash, Pred, Alloc>	table_type;
+
+			table_type			_table;
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTOR ----- */
+
+			/* --------------------------------------------------------------------------------
+			- Empty container constructor (default constructor) -
+				Constructs an empty container, with no elements; with n, the table is allocated at once with room for n elements.
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/unordered_map/
+			-------------------------------------------------------------------------------- */
+			explicit unordered_map(size_type n = 0, const hasher& hf = hasher(), const key_equal& eql = key_equal(), const allocator_type& alloc = allocator_type()) : _table(hf, eql, alloc)
+			{
+				if (n)
+					reserve(n);
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Range constructor -
+				Constructs a container with as many elements as the range [first, last], with each element constructed from its corresponding element in that range.
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/unordered_map/
+			-------------------------------------------------------------------------------- */
+			template<class InputIterator>
+			unordered_map(InputIterator first, InputIterator last, size_type n = 0, const hasher& hf = hasher(), const key_equal& eql = key_equal(), const allocator_type& alloc = allocator_type()) : _table(hf, eql, alloc)
+			{
+				if (n)
+					reserve(n);
+				insert(first, last);
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Copy constructor -
+				Constructs a container with a copy of the table of ump: every element lands in the same slot, without being hashed again.
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/unordered_map/
+			-------------------------------------------------------------------------------- */
+			unordered_map(const unordered_map& ump) : _table(ump._table)
+				{return;}
+
+			/* --------------------------------------------------------------------------------
+			- Destroy unordered map -
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/~unordered_map/
+			-------------------------------------------------------------------------------- */
+			~unordered_map()
+				{return;}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			/* --- Operator overloads --- */
+
+			/* --------------------------------------------------------------------------------
+			- Assign content -
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/operator=/
+			-------------------------------------------------------------------------------- */
+			unordered_map&							operator=(const unordered_map& ump)
+			{
+				_table = ump._table;
+				return (*this);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Access element -
+				Returns a reference to the mapped value of the element with key k, inserting one with a default constructed mapped value if there is none.
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/operator[]/
+			-------------------------------------------------------------------------------- */
+			mapped_type&							operator[](const key_type& k)
+			{
+				size_type	i = _table.find(k);
+
+				if (i == _table.get_capacity())
+					i = _table.insert_unique(value_type(k, mapped_type())).first;
+
+				return (_table.get_slots()[i].second);
+			}
+
+
+			/* --- Capacity --- */
+
+			/* --------------------------------------------------------------------------------
+			- Test whether container is empty -
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/empty/
+			-------------------------------------------------------------------------------- */
+			bool									empty() const
+				{return (!_table.size());}
+
+			/* --------------------------------------------------------------------------------
+			- Return container size -
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/size/
+			-------------------------------------------------------------------------------- */
+			size_type								size() const
+				{return (_table.size());}
+
+			/* --------------------------------------------------------------------------------
+			- Return maximum size -
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/max_size/
+			-------------------------------------------------------------------------------- */
+			size_type								max_size() const
+				{return (_table.get_alloc().max_size());}
+
+
+			/* --- Iterators --- */
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to beginning -
+				Returns an iterator to the first full slot of the table.
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/begin/
+			-------------------------------------------------------------------------------- */
+			iterator								begin()
+				{return (_make_iterator(_table.first()));}
+
+			const_iterator							begin() const
+				{return (_make_iterator(_table.first()));}
+
+			/* --------------------------------------------------------------------------------
+			- Return iterator to end -
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/end/
+			-------------------------------------------------------------------------------- */
+			iterator								end()
+				{return (_make_iterator(_table.get_capacity()));}
+
+			const_iterator							end() const
+				{return (_make_iterator(_table.get_capacity()));}
+
+
+			/* --- Element lookup --- */
+
+			/* --------------------------------------------------------------------------------
+			- Get iterator to element -
+				Probes the groups of control bytes from the home slot of k, comparing keys only where the 7 bits of its hash match.
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/find/
+			-------------------------------------------------------------------------------- */
+			iterator								find(const key_type& k)
+				{return (_make_iterator(_table.find(k)));}
+
+			const_iterator							find(const key_type& k) const
+				{return (_make_iterator(_table.find(k)));}
+
+			/* --------------------------------------------------------------------------------
+			- Count elements with a specific key -
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/count/
+			-------------------------------------------------------------------------------- */
+			size_type								count(const key_type& k) const
+				{return (_table.find(k) != _table.get_capacity());}
+
+			/* --------------------------------------------------------------------------------
+			- Get range of elements with specific key -
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/equal_range/
+			-------------------------------------------------------------------------------- */
+			pair<iterator, iterator>				equal_range(const key_type& k)
+			{
+				iterator	it = find(k);
+
+				if (it == end())
+					return (pair<iterator, iterator>(it, it));
+
+				return (pair<iterator, iterator>(it, ++iterator(it)));
+			}
+
+			pair<const_iterator, const_iterator>	equal_range(const key_type& k) const
+			{
+				const_iterator	it = find(k);
+
+				if (it == end())
+					return (pair<const_iterator, const_iterator>(it, it));
+
+				return (pair<const_iterator, const_iterator>(it, ++const_iterator(it)));
+			}
+
+
+			/* --- Modifiers --- */
+
+			/* --------------------------------------------------------------------------------
+			- Insert element -
+
+			Returns a pair with an iterator to the inserted element, or to the element that prevented the insertion, and whether val was inserted.
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/insert/
+			-------------------------------------------------------------------------------- */
+			pair<iterator, bool>					insert(const value_type& val)
+			{
+				pair<size_type, bool>	ret = _table.insert_unique(val);
+
+				return (pair<iterator, bool>(_make_iterator(ret.first), ret.second));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert element with hint -
+				The position of an element only depends on its hash, so hint is ignored.
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/insert/
+			-------------------------------------------------------------------------------- */
+			iterator								insert(const_iterator hint, const value_type& val)
+			{
+				(void)hint;
+				return (insert(val).first);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert range -
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/insert/
+			-------------------------------------------------------------------------------- */
+			template<class InputIterator>
+			void									insert(InputIterator first, InputIterator last)
+			{
+				for (; first != last; first++)
+					_table.insert_unique(*first);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase element -
+				Elements after position in its run may be shifted back into its slot, so iterators to other elements are invalidated.
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/erase/
+			-------------------------------------------------------------------------------- */
+			void									erase(const_iterator position)
+			{
+				_table.erase(position.base() - _table.get_slots());
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase element by key -
+
+			Returns the number of elements erased.
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/erase/
+			-------------------------------------------------------------------------------- */
+			size_type								erase(const key_type& k)
+			{
+				size_type	i = _table.find(k);
+
+				if (i == _table.get_capacity())
+					return (0);
+
+				_table.erase(i);
+
+				return (1);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase range -
+				Since erasing shifts elements, the keys of the range are gathered first and then erased one by one.
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/erase/
+			-------------------------------------------------------------------------------- */
+			void									erase(const_iterator first, const_iterator last)
+			{
+				if (first == begin() && last == end())
+				{
+					clear();
+					return;
+				}
+
+				vector<key_type>	keys;
+
+				for (; first != last; first++)
+					keys.push_back(first->first);
+				for (size_type i = 0; i < keys.size(); i++)
+					erase(keys[i]);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Clear content -
+				Destroys every element; the table keeps its slots.
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/clear/
+			-------------------------------------------------------------------------------- */
+			void									clear()
+			{
+				_table.clear();
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Swap content -
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/swap/
+			-------------------------------------------------------------------------------- */
+			void									swap(unordered_map& ump)
+			{
+				_table.swap(ump._table);
+				return;
+			}
+
+
+			/* --- Buckets --- */
+
+			/* --------------------------------------------------------------------------------
+			- Return number of buckets -
+				Each slot of the table is a bucket of at most one element.
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/bucket_count/
+			-------------------------------------------------------------------------------- */
+			size_type								bucket_count() const
+				{return (_table.get_capacity());}
+
+
+			/* --- Hash policy --- */
+
+			/* --------------------------------------------------------------------------------
+			- Return load factor -
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/load_factor/
+			-------------------------------------------------------------------------------- */
+			float									load_factor() const
+				{return (bucket_count() ? static_cast<float>(size()) / bucket_count() : 0.0f);}
+
+			/* --------------------------------------------------------------------------------
+			- Get or set maximum load factor -
+				Defaults to 0.875; open addressing needs it below 1, so it is kept within [0.25, 0.9375].
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/max_load_factor/
+			-------------------------------------------------------------------------------- */
+			float									max_load_factor() const
+				{return (_table.get_max_load());}
+
+			void									max_load_factor(float z)
+			{
+				_table.set_max_load(z);
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Set number of buckets -
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/rehash/
+			-------------------------------------------------------------------------------- */
+			void									rehash(size_type n)
+			{
+				_table.rehash(n);
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Request a capacity change -
+				Sets the number of buckets to hold at least n elements without exceeding the maximum load factor.
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/reserve/
+			-------------------------------------------------------------------------------- */
+			void									reserve(size_type n)
+			{
+				_table.rehash(static_cast<size_type>(n / max_load_factor()) + 1);
+				return;
+			}
+
+
+			/* --- Observers --- */
+
+			/* --------------------------------------------------------------------------------
+			- Get hash function -
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/hash_function/
+			-------------------------------------------------------------------------------- */
+			hasher									hash_function() const
+				{return (_table.get_hash());}
+
+			/* --------------------------------------------------------------------------------
+			- Get key equivalence predicate -
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/key_eq/
+			-------------------------------------------------------------------------------- */
+			key_equal								key_eq() const
+				{return (_table.get_eq());}
+
+			/* --------------------------------------------------------------------------------
+			- Get allocator -
+
+			Source: https://cplusplus.com/reference/unordered_map/unordered_map/get_allocator/
+			-------------------------------------------------------------------------------- */
+			allocator_type							get_allocator() const
+				{return (_table.get_alloc());}
+
+		private:
+			iterator								_make_iterator(size_type i)
+				{return (iterator(_table.get_ctrl() + i, _table.get_ctrl() + _table.get_capacity(), _table.get_slots() + i));}
+
+			const_iterator							_make_iterator(size_type i) const
+				{return (const_iterator(_table.get_ctrl() + i, _table.get_ctrl() + _table.get_capacity(), _table.get_slots() + i));}
+	};
+
+
+	/* ----- NON-MEMBER OPERATOR OVERLOADS ----- */
+
+	/* --------------------------------------------------------------------------------
+	- Relational operators for unordered_map -
+		Two unordered maps are equal if they have the same size and every element of one has an element with an equivalent key and an equal mapped value in the other, whatever their slots.
+
+	Source: https://cplusplus.com/reference/unordered_map/unordered_map/operators/
+	-------------------------------------------------------------------------------- */
+	template<class Key, class T, class Hash, class Pred, class Alloc>
+	bool	operator==(const unordered_map<Key, T, Hash, Pred, Alloc>& lhs, const unordered_map<Key, T, Hash, Pred, Alloc>& rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return (false);
+
+		for (typename unordered_map<Key, T, Hash, Pred, Alloc>::const_iterator it = lhs.begin(); it != lhs.end(); it++)
+		{
+			typename unordered_map<Key, T, Hash, Pred, Alloc>::const_iterator	match = rhs.find(it->first);
+
+			if (match == rhs.end() || !(match->second == it->second))
+				return (false);
+		}
+
+		return (true);
+	}
+
+	template<class Key, class T, class Hash, class Pred, class Alloc>
+	bool	operator!=(const unordered_map<Key, T, Hash, Pred, Alloc>& lhs, const unordered_map<Key, T, Hash, Pred, Alloc>& rhs)
+		{return (!(lhs == rhs));}
+
+	template<class Key, class T, class Hash, class Pred, class Alloc>
+	void	swap(unordered_map<Key, T, Hash, Pred, Alloc>& x, unordered_map<Key, T, Hash, Pred, Alloc>& y)
+	{
+		x.swap(y);
+		return;
+	}
+}
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/07 11:46:38 by hcremers          #+#    #+#             */
-/*   Updated: 2022/12/20 16:09:53 by hcremers         ###   ########.fr       */
+/*   Updated: 2026/10/19 11:08:21 by hcremers         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,6 +15,7 @@
 
 # include <cstddef>		// size_t
 # include <memory>		// std::allocator
+# include <new>			// placement new
 # include <stdexcept>	// std::out_of_range
 # include <sys/types.h> // ssize_t
 
@@ -87,14 +88,9 @@ namespace ft
 			Source: https://cplusplus.com/reference/vector/vector/vector/
 			-------------------------------------------------------------------------------- */
 			template<class InputIterator>
-			vector(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(), typename enable_if<!is_integral<InputIterator>::value>::type* = NULL) : _alloc(alloc)
+			vector(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(), typename enable_if<!is_integral<InputIterator>::value>::type* = NULL) : _container(NULL), _size(0), _capacity(0), _alloc(alloc)
 			{
-				_size = ft::distance(first, last);
-				_capacity = _size;
-				_container = _alloc.allocate(_size);
-
-				for (size_type i = 0; first != last; first++, i++)
-					_alloc.construct(_container + i, *first);
+				_construct_range(first, last, ft::_pass_category(typename iterator_traits<InputIterator>::iterator_category()));
 
 				return;
 			}
@@ -472,21 +468,7 @@ namespace ft
 			template<class InputIterator>
 			void					assign(InputIterator first, InputIterator last, typename enable_if<!is_integral<InputIterator>::value>::type* = NULL)
 			{
-				size_type	size = ft::distance(first, last);
-
-				clear();
-
-				if (size > _capacity)
-				{
-					_alloc.deallocate(_container, _capacity);
-					_container = _alloc.allocate(size);
-					_capacity = size;
-				}
-
-				for (size_type i = 0; i < size; i++, first++)
-					_alloc.construct(_container + i, *first);
-
-				_size = size;
+				_assign_range(first, last, ft::_pass_category(typename iterator_traits<InputIterator>::iterator_category()));
 
 				return;
 			}
@@ -529,8 +511,7 @@ namespace ft
 			-------------------------------------------------------------------------------- */
 			void					push_back(const value_type& val)
 			{
-				if (_size + 1 > _capacity)
-					reserve(_capacity ? _capacity * 2 : 1);
+				_grow_by_one();
 
 				_alloc.construct(_container + _size, val);
 				_size++;
@@ -538,6 +519,52 @@ namespace ft
 				return;
 			}
 
+			/* --------------------------------------------------------------------------------
+			- Construct and insert element at the end -
+				Inserts a new element at the end of the vector, right after its current last element. This new element is constructed in place using args as the arguments for its constructor.
+				C++98 has no variadic templates nor perfect forwarding: there is one overload per number of arguments, up to three, each taking them by const reference. The arguments must not refer to elements of the vector, which a reallocation would destroy before the new element is constructed.
+
+			Source: https://cplusplus.com/reference/vector/vector/emplace_back/
+			-------------------------------------------------------------------------------- */
+			void					emplace_back()
+			{
+				_grow_by_one();
+				::new (static_cast<void*>(_container + _size)) value_type();
+				_size++;
+
+				return;
+			}
+
+			template<class A1>
+			void					emplace_back(const A1& a1)
+			{
+				_grow_by_one();
+				::new (static_cast<void*>(_container + _size)) value_type(a1);
+				_size++;
+
+				return;
+			}
+
+			template<class A1, class A2>
+			void					emplace_back(const A1& a1, const A2& a2)
+			{
+				_grow_by_one();
+				::new (static_cast<void*>(_container + _size)) value_type(a1, a2);
+				_size++;
+
+				return;
+			}
+
+			template<class A1, class A2, class A3>
+			void					emplace_back(const A1& a1, const A2& a2, const A3& a3)
+			{
+				_grow_by_one();
+				::new (static_cast<void*>(_container + _size)) value_type(a1, a2, a3);
+				_size++;
+
+				return;
+			}
+
 			/* --------------------------------------------------------------------------------
 			- Delete last element -
 				Removes the last element in the vector, effectively reducing the container size by one.
@@ -624,11 +651,23 @@ namespace ft
 				}
 				else
 				{
+					value_type	copy(val);
+
 					for (ssize_t i = _size - 1; i >= static_cast<ssize_t>(pos); i--)
-						_container[i + n] = _container[i];
+					{
+						if (i + n >= _size)
+							_alloc.construct(_container + i + n, _container[i]);
+						else
+							_container[i + n] = _container[i];
+					}
 
 					for (size_type i = pos; i < (pos + n); i++)
-						_alloc.construct(_container + i, val);
+					{
+						if (i < _size)
+							_container[i] = copy;
+						else
+							_alloc.construct(_container + i, copy);
+					}
 				}
 				_size += n;
 
@@ -647,45 +686,7 @@ namespace ft
 			template<class InputIterator>
 			void					insert(iterator position, InputIterator first, InputIterator last, typename enable_if<!is_integral<InputIterator>::value>::type* = NULL)
 			{
-				size_type	pos = ft::distance(begin(), position);
-				size_type	dist = ft::distance(first, last);
-
-				if (_size + dist > _capacity)
-				{
-					if (!_capacity)
-						_capacity = 1;
-					size_type	size = 2;
-
-					while (_capacity * size < _size + dist)
-						size *= 2;
-					if (_capacity * size > max_size())
-						throw std::out_of_range("vector::insert");
-					pointer	tmp = _alloc.allocate(_capacity * size);
-
-					for (size_type i = 0; i < pos; i++)
-					{
-						_alloc.construct(tmp + i, _container[i]);
-						_alloc.destroy(_container + i);
-					}
-					for (size_type i = 0; i < dist; i++, first++)
-						_alloc.construct(tmp + pos + i, *first);
-					for (size_type i = pos; i < _size; i++)
-					{
-						_alloc.construct(tmp + i + dist, _container[i]);
-						_alloc.destroy(_container + i);
-					}
-					_alloc.deallocate(_container, _capacity);
-					_container = tmp;
-					_capacity = _capacity * size;
-				}
-				else
-				{
-					for (ssize_t i = _size - 1; i >= static_cast<ssize_t>(pos); i--)
-						_container[i + dist] = _container[i];
-					for (size_t i = pos; i < (pos + dist); i++)
-						_alloc.construct(_container + i, *first++);
-				}
-				_size += dist;
+				_insert_range(position, first, last, ft::_pass_category(typename iterator_traits<InputIterator>::iterator_category()));
 
 				return;
 			}
@@ -703,11 +704,10 @@ namespace ft
 				iterator	it = position;
 				iterator	ite = end();
 
-				_alloc.destroy(position.base());
-
 				for (iterator tmp = it + 1; tmp != ite; ++it, ++tmp)
 					*it = *tmp;
 
+				_alloc.destroy(it.base());
 				--_size;
 
 				return (position);
@@ -723,15 +723,15 @@ namespace ft
 			-------------------------------------------------------------------------------- */
 			iterator				erase(iterator first, iterator last)
 			{
-				for (iterator it = first; it != last; ++it)
-					_alloc.destroy(it.base());
-
 				iterator	it = first;
 				iterator	itp = last;
 
 				for (; itp != end(); it++, itp++)
 					*it = *itp;
 
+				for (iterator ite = end(); it != ite; ++it)
+					_alloc.destroy(it.base());
+
 				_size -= ft::distance(first, last);
 
 				return (iterator(_container + ft::distance(begin(), first)));
@@ -789,6 +789,144 @@ namespace ft
 			-------------------------------------------------------------------------------- */
 			allocator_type			get_allocator() const
 				{return (_alloc);}
+
+		private:
+			/* --------------------------------------------------------------------------------
+			- Make room for one more element -
+				Doubles the capacity if the vector is full, for push_back and emplace_back.
+			-------------------------------------------------------------------------------- */
+			void					_grow_by_one()
+			{
+				if (_size + 1 > _capacity)
+					reserve(_capacity ? _capacity * 2 : 1);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Range constructor, assign and insert helpers -
+				A range of forward iterators is counted first, so that the storage is allocated once and the elements copied in one pass.
+				A single-pass range, such as one read from a stream, cannot be walked twice: its elements are pushed back one at a time, and an insertion copies them into a temporary vector first.
+			-------------------------------------------------------------------------------- */
+			template<class InputIterator>
+			void					_construct_range(InputIterator first, InputIterator last, input_iterator_tag)
+			{
+				for (; first != last; ++first)
+					push_back(*first);
+
+				return;
+			}
+
+			template<class ForwardIterator>
+			void					_construct_range(ForwardIterator first, ForwardIterator last, forward_iterator_tag)
+			{
+				_size = ft::distance(first, last);
+				_capacity = _size;
+				_container = _alloc.allocate(_size);
+
+				for (size_type i = 0; first != last; first++, i++)
+					_alloc.construct(_container + i, *first);
+
+				return;
+			}
+
+			template<class InputIterator>
+			void					_assign_range(InputIterator first, InputIterator last, input_iterator_tag)
+			{
+				clear();
+				for (; first != last; ++first)
+					push_back(*first);
+
+				return;
+			}
+
+			template<class ForwardIterator>
+			void					_assign_range(ForwardIterator first, ForwardIterator last, forward_iterator_tag)
+			{
+				size_type	size = ft::distance(first, last);
+
+				clear();
+
+				if (size > _capacity)
+				{
+					_alloc.deallocate(_container, _capacity);
+					_container = _alloc.allocate(size);
+					_capacity = size;
+				}
+
+				for (size_type i = 0; i < size; i++, first++)
+					_alloc.construct(_container + i, *first);
+
+				_size = size;
+
+				return;
+			}
+
+			template<class InputIterator>
+			void					_insert_range(iterator position, InputIterator first, InputIterator last, input_iterator_tag)
+			{
+				vector	tmp(first, last, _alloc);
+
+				_insert_range(position, tmp.begin(), tmp.end(), forward_iterator_tag());
+
+				return;
+			}
+
+			template<class ForwardIterator>
+			void					_insert_range(iterator position, ForwardIterator first, ForwardIterator last, forward_iterator_tag)
+			{
+				size_type	pos = ft::distance(begin(), position);
+				size_type	dist = ft::distance(first, last);
+
+				if (_size + dist > _capacity)
+				{
+					if (!_capacity)
+						_capacity = 1;
+					size_type	size = 2;
+
+					while (_capacity * size < _size + dist)
+						size *= 2;
+					if (_capacity * size > max_size())
+						throw std::out_of_range("vector::insert");
+					pointer	tmp = _alloc.allocate(_capacity * size);
+
+					for (size_type i = 0; i < pos; i++)
+					{
+						_alloc.construct(tmp + i, _container[i]);
+						_alloc.destroy(_container + i);
+					}
+					for (size_type i = 0; i < dist; i++, first++)
+						_alloc.construct(tmp + pos + i, *first);
+					for (size_type i = pos; i < _size; i++)
+					{
+						_alloc.construct(tmp + i + dist, _container[i]);
+						_alloc.destroy(_container + i);
+					}
+					_alloc.deallocate(_container, _capacity);
+					_container = tmp;
+					_capacity = _capacity * size;
+				}
+				else
+				{
+					for (ssize_t i = _size - 1; i >= static_cast<ssize_t>(pos); i--)
+					{
+						if (i + dist >= _size)
+							_alloc.construct(_container + i + dist, _container[i]);
+						else
+							_container[i + dist] = _container[i];
+					}
+					for (size_t i = pos; i < (pos + dist); i++, first++)
+					{
+						if (i < _size)
+							_container[i] = *first;
+						else
+							_alloc.construct(_container + i, *first);
+					}
+				}
+				_size += dist;
+
+				return;
+			}
 	};
 
 
@@ -803,7 +941,7 @@ namespace ft
 	-------------------------------------------------------------------------------- */
 	template<class T, class Alloc>
 	bool							operator==(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs)
-		{return (lhs.size() == rhs.size() && equal(lhs.begin(), lhs.end(), rhs.begin()));}
+		{return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));}
 
 	/* --------------------------------------------------------------------------------
 	- "Not equal to" operator for vector -
@@ -825,7 +963,7 @@ namespace ft
 	-------------------------------------------------------------------------------- */
 	template<class T, class Alloc>
 	bool							operator<(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs)
-		{return (lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));}
+		{return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));}
 
 	/* --------------------------------------------------------------------------------
 	- "Less than or equal to" operator for vector -
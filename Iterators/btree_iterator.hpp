@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_iterator.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:10:05 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 09:14:24 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BTREE_ITERATOR_HPP
+# define BTREE_ITERATOR_HPP
+
+# include <cstddef>		// ptrdiff_t, size_t
+
+# include "iterator_traits.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- B-tree iterator -
+		Points to the element at position pos of a leaf; the past-the-end iterator points one past the last element of the last leaf, or to no leaf at all for an empty map.
+		Stepping within a leaf only moves pos, and the leaves are linked to each other, so iterating a btree_map reads its elements almost sequentially.
+	-------------------------------------------------------------------------------- */
+	template<class T, class Leaf>
+	class btree_iterator
+	{
+		public:
+			typedef T							value_type;
+			typedef T&							reference;
+			typedef T*							pointer;
+			typedef ptrdiff_t					difference_type;
+			typedef size_t						size_type;
+			typedef Leaf*						node_pointer;
+			typedef btree_iterator<T, Leaf>		iterator;
+			typedef bidirectional_iterator_tag	iterator_category;
+
+		private:
+			node_pointer	_node;
+			size_type		_pos;
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTORS ----- */
+
+			btree_iterator() : _node(NULL), _pos(0)
+				{return;}
+
+			btree_iterator(const btree_iterator& src) : _node(src._node), _pos(src._pos)
+				{return;}
+
+			btree_iterator(node_pointer node, size_type pos) : _node(node), _pos(pos)
+				{return;}
+
+			~btree_iterator()
+				{return;}
+
+
+			/* ----- OPERATOR OVERLOADS ----- */
+
+			operator			btree_iterator<const T, Leaf>() const
+				{return (btree_iterator<const T, Leaf>(_node, _pos));}
+
+			iterator&			operator=(const btree_iterator& rhs)
+			{
+				_node = rhs._node;
+				_pos = rhs._pos;
+				return (*this);
+			}
+
+			reference			operator*() const
+				{return (_node->get_value(_pos));}
+
+			pointer				operator->() const
+				{return (&_node->get_value(_pos));}
+
+			iterator&			operator++()
+			{
+				if (++_pos == _node->get_count() && _node->get_next())
+				{
+					_node = _node->get_next();
+					_pos = 0;
+				}
+
+				return (*this);
+			}
+
+			iterator			operator++(int)
+			{
+				btree_iterator	tmp(*this);
+
+				++(*this);
+
+				return (tmp);
+			}
+
+			iterator&			operator--()
+			{
+				if (!_pos)
+				{
+					_node = _node->get_prev();
+					_pos = _node->get_count();
+				}
+				_pos--;
+
+				return (*this);
+			}
+
+			iterator			operator--(int)
+			{
+				btree_iterator	tmp(*this);
+
+				--(*this);
+
+				return (tmp);
+			}
+
+
+			/* ----- MEMBER FUNCTION ----- */
+
+			const node_pointer&	base() const
+				{return (_node);}
+
+			size_type			position() const
+				{return (_pos);}
+	};
+
+
+	/* ----- NON-MEMBER OPERATOR OVERLOADS ----- */
+
+	template<class T1, class T2, class Leaf>
+	bool	operator==(const btree_iterator<T1, Leaf>& left, const btree_iterator<T2, Leaf>& right)
+		{return (left.base() == right.base() && left.position() == right.position());}
+
+	template<class T1, class T2, class Leaf>
+	bool	operator!=(const btree_iterator<T1, Leaf>& left, const btree_iterator<T2, Leaf>& right)
+		{return (!(left == right));}
+}
+
+#endif
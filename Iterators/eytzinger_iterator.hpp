@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   eytzinger_iterator.hpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:29:48 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 09:29:48 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef EYTZINGER_ITERATOR_HPP
+# define EYTZINGER_ITERATOR_HPP
+
+# include <cstddef>		// ptrdiff_t, size_t
+
+# include "iterator_traits.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Eytzinger iterator -
+		Walks an array laid out in Eytzinger order (slot k has children 2k and 2k + 1, slot k being at index k - 1) in sorted order, as an in-order walk of the implicit tree; slot 0 is the past-the-end position.
+		The successor of a slot is the leftmost slot of its right subtree if it has one, or else the parent it is in the left subtree of; the predecessor mirrors it.
+	-------------------------------------------------------------------------------- */
+	template<class T>
+	class eytzinger_iterator
+	{
+		public:
+			typedef T							value_type;
+			typedef T&							reference;
+			typedef T*							pointer;
+			typedef ptrdiff_t					difference_type;
+			typedef size_t						size_type;
+			typedef eytzinger_iterator<T>		iterator;
+			typedef bidirectional_iterator_tag	iterator_category;
+
+		private:
+			pointer		_data;
+			size_type	_size;
+			size_type	_slot;
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTORS ----- */
+
+			eytzinger_iterator() : _data(NULL), _size(0), _slot(0)
+				{return;}
+
+			eytzinger_iterator(const eytzinger_iterator& src) : _data(src._data), _size(src._size), _slot(src._slot)
+				{return;}
+
+			eytzinger_iterator(pointer data, size_type size, size_type slot) : _data(data), _size(size), _slot(slot)
+				{return;}
+
+			~eytzinger_iterator()
+				{return;}
+
+
+			/* ----- OPERATOR OVERLOADS ----- */
+
+			operator			eytzinger_iterator<const T>() const
+				{return (eytzinger_iterator<const T>(_data, _size, _slot));}
+
+			iterator&			operator=(const eytzinger_iterator& rhs)
+			{
+				_data = rhs._data;
+				_size = rhs._size;
+				_slot = rhs._slot;
+				return (*this);
+			}
+
+			reference			operator*() const
+				{return (_data[_slot - 1]);}
+
+			pointer				operator->() const
+				{return (_data + _slot - 1);}
+
+			iterator&			operator++()
+			{
+				if (2 * _slot + 1 <= _size)
+				{
+					_slot = 2 * _slot + 1;
+					while (2 * _slot <= _size)
+						_slot *= 2;
+				}
+				else
+				{
+					while (_slot & 1)
+						_slot >>= 1;
+					_slot >>= 1;
+				}
+
+				return (*this);
+			}
+
+			iterator			operator++(int)
+			{
+				eytzinger_iterator	tmp(*this);
+
+				++(*this);
+
+				return (tmp);
+			}
+
+			iterator&			operator--()
+			{
+				if (!_slot)
+					_slot = 1;
+				else if (2 * _slot <= _size)
+					_slot *= 2;
+				else
+				{
+					while (_slot && !(_slot & 1))
+						_slot >>= 1;
+					_slot >>= 1;
+					return (*this);
+				}
+				while (2 * _slot + 1 <= _size)
+					_slot = 2 * _slot + 1;
+
+				return (*this);
+			}
+
+			iterator			operator--(int)
+			{
+				eytzinger_iterator	tmp(*this);
+
+				--(*this);
+
+				return (tmp);
+			}
+
+
+			/* ----- MEMBER FUNCTION ----- */
+
+			size_type			slot() const
+				{return (_slot);}
+	};
+
+
+	/* ----- NON-MEMBER OPERATOR OVERLOADS ----- */
+
+	template<class T1, class T2>
+	bool	operator==(const eytzinger_iterator<T1>& left, const eytzinger_iterator<T2>& right)
+		{return (left.slot() == right.slot());}
+
+	template<class T1, class T2>
+	bool	operator!=(const eytzinger_iterator<T1>& left, const eytzinger_iterator<T2>& right)
+		{return (!(left == right));}
+}
+
+#endif
@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash_iterator.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:21:15 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 09:21:15 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HASH_ITERATOR_HPP
+# define HASH_ITERATOR_HPP
+
+# include <cstddef>		// ptrdiff_t, size_t
+
+# include "iterator_traits.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Hash iterator -
+		Points to a slot of a hash table along with its control byte; moving forward skips the slots whose control byte marks them empty (negative) until the end of the control bytes.
+		The slots are visited in the order of the array, which has nothing to do with the order of the keys and changes when the table is rehashed.
+	-------------------------------------------------------------------------------- */
+	template<class T, class Value>
+	class hash_iterator
+	{
+		public:
+			typedef T							value_type;
+			typedef T&							reference;
+			typedef T*							pointer;
+			typedef ptrdiff_t					difference_type;
+			typedef size_t						size_type;
+			typedef Value*						slot_pointer;
+			typedef const signed char*			control_pointer;
+			typedef hash_iterator<T, Value>		iterator;
+			typedef forward_iterator_tag		iterator_category;
+
+		private:
+			control_pointer	_ctrl;
+			control_pointer	_end;
+			slot_pointer	_slot;
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTORS ----- */
+
+			hash_iterator() : _ctrl(NULL), _end(NULL), _slot(NULL)
+				{return;}
+
+			hash_iterator(const hash_iterator& src) : _ctrl(src._ctrl), _end(src._end), _slot(src._slot)
+				{return;}
+
+			hash_iterator(control_pointer ctrl, control_pointer end, slot_pointer slot) : _ctrl(ctrl), _end(end), _slot(slot)
+				{return;}
+
+			~hash_iterator()
+				{return;}
+
+
+			/* ----- OPERATOR OVERLOADS ----- */
+
+			operator			hash_iterator<const T, Value>() const
+				{return (hash_iterator<const T, Value>(_ctrl, _end, _slot));}
+
+			iterator&			operator=(const hash_iterator& rhs)
+			{
+				_ctrl = rhs._ctrl;
+				_end = rhs._end;
+				_slot = rhs._slot;
+				return (*this);
+			}
+
+			reference			operator*() const
+				{return (*_slot);}
+
+			pointer				operator->() const
+				{return (_slot);}
+
+			iterator&			operator++()
+			{
+				do
+				{
+					++_ctrl;
+					++_slot;
+				} while (_ctrl != _end && *_ctrl < 0);
+
+				return (*this);
+			}
+
+			iterator			operator++(int)
+			{
+				hash_iterator	tmp(*this);
+
+				++(*this);
+
+				return (tmp);
+			}
+
+
+			/* ----- MEMBER FUNCTION ----- */
+
+			const slot_pointer&	base() const
+				{return (_slot);}
+
+			control_pointer		control() const
+				{return (_ctrl);}
+	};
+
+
+	/* ----- NON-MEMBER OPERATOR OVERLOADS ----- */
+
+	template<class T1, class T2, class Value>
+	bool	operator==(const hash_iterator<T1, Value>& left, const hash_iterator<T2, Value>& right)
+		{return (left.base() == right.base());}
+
+	template<class T1, class T2, class Value>
+	bool	operator!=(const hash_iterator<T1, Value>& left, const hash_iterator<T2, Value>& right)
+		{return (!(left == right));}
+}
+
+#endif
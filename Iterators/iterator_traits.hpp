@@ -6,7 +6,7 @@
 /*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/15 10:56:33 by hcremers          #+#    #+#             */
-/*   Updated: 2022/12/19 15:17:44 by hcremers         ###   ########.fr       */
+/*   Updated: 2026/10/19 11:08:21 by hcremers         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,16 +14,17 @@
 # define ITERATOR_TRAITS_HPP
 
 # include <cstddef>	// ptrdiff_t
+# include <iterator>	// std::input_iterator_tag, std::random_access_iterator_tag
 
 # include "iterator.hpp"
 
 namespace ft
 {
-	struct	input_iterator_tag			{};
-	struct	output_iterator_tag			{};
-	struct	forward_iterator_tag		{};
-	struct	bidirectional_iterator_tag	{};
-	struct	random_access_iterator_tag	{};
+	struct	input_iterator_tag											{};
+	struct	output_iterator_tag											{};
+	struct	forward_iterator_tag		: public input_iterator_tag			{};
+	struct	bidirectional_iterator_tag	: public forward_iterator_tag		{};
+	struct	random_access_iterator_tag	: public bidirectional_iterator_tag	{};
 
 	template<class Iterator>
 	class iterator_traits
@@ -58,16 +59,122 @@ namespace ft
 			typedef random_access_iterator_tag				iterator_category;
 	};
 
+	/* ----- CATEGORY DISPATCH ----- */
+
+	/* --------------------------------------------------------------------------------
+	- Distance / advance helpers -
+		Overloads selected by the iterator_category of the iterator.
+		Random-access iterators use operator- and operator+=, every other category is stepped one element at a time.
+		Iterators that know a faster way (see tree_iterator) provide a more specialized overload, found by argument-dependent lookup.
+	-------------------------------------------------------------------------------- */
+	template<typename InputIterator>
+	typename iterator_traits<InputIterator>::difference_type		_distance(InputIterator first, InputIterator last, input_iterator_tag)
+	{
+		typename iterator_traits<InputIterator>::difference_type	n = 0;
+
+		for (; first != last; ++first)
+			n++;
+
+		return (n);
+	}
+
+	template<typename RandomAccessIterator>
+	typename iterator_traits<RandomAccessIterator>::difference_type	_distance(RandomAccessIterator first, RandomAccessIterator last, random_access_iterator_tag)
+		{return (last - first);}
+
+	template<typename InputIterator>
+	typename iterator_traits<InputIterator>::difference_type		_distance(InputIterator first, InputIterator last, std::input_iterator_tag)
+		{return (_distance(first, last, input_iterator_tag()));}
+
+	template<typename RandomAccessIterator>
+	typename iterator_traits<RandomAccessIterator>::difference_type	_distance(RandomAccessIterator first, RandomAccessIterator last, std::random_access_iterator_tag)
+		{return (last - first);}
+
+	template<typename InputIterator, typename Distance>
+	void															_advance(InputIterator& it, Distance n, input_iterator_tag)
+	{
+		for (; n > 0; n--)
+			++it;
+
+		return;
+	}
+
+	template<typename BidirectionalIterator, typename Distance>
+	void															_advance(BidirectionalIterator& it, Distance n, bidirectional_iterator_tag)
+	{
+		for (; n > 0; n--)
+			++it;
+		for (; n < 0; n++)
+			--it;
+
+		return;
+	}
+
+	template<typename RandomAccessIterator, typename Distance>
+	void															_advance(RandomAccessIterator& it, Distance n, random_access_iterator_tag)
+	{
+		it += n;
+
+		return;
+	}
+
+	template<typename InputIterator, typename Distance>
+	void															_advance(InputIterator& it, Distance n, std::input_iterator_tag)
+		{_advance(it, n, input_iterator_tag());}
+
+	template<typename BidirectionalIterator, typename Distance>
+	void															_advance(BidirectionalIterator& it, Distance n, std::bidirectional_iterator_tag)
+		{_advance(it, n, bidirectional_iterator_tag());}
+
+	template<typename RandomAccessIterator, typename Distance>
+	void															_advance(RandomAccessIterator& it, Distance n, std::random_access_iterator_tag)
+		{_advance(it, n, random_access_iterator_tag());}
+
+	/* --------------------------------------------------------------------------------
+	- Pass category -
+		Maps any iterator category, ft or std, to input_iterator_tag for single-pass iterators and to forward_iterator_tag for the others.
+		Containers dispatch on it to count a range before copying it only when the range can be walked twice.
+	-------------------------------------------------------------------------------- */
+	inline input_iterator_tag										_pass_category(input_iterator_tag)
+		{return (input_iterator_tag());}
+
+	inline forward_iterator_tag										_pass_category(forward_iterator_tag)
+		{return (forward_iterator_tag());}
+
+	inline input_iterator_tag										_pass_category(std::input_iterator_tag)
+		{return (input_iterator_tag());}
+
+	inline forward_iterator_tag										_pass_category(std::forward_iterator_tag)
+		{return (forward_iterator_tag());}
+
+
+	/* ----- NON-MEMBER FUNCTIONS ----- */
+
 	/* --------------------------------------------------------------------------------
 	- Return distance between iterators -
 		Calculates the number of elements between first and last.
-		The function uses operator- to calculate this.
+		If it is a random-access iterator, the function uses operator- to calculate this. Otherwise, the function uses the increase operator (operator++) repeatedly.
 
 	Source: https://cplusplus.com/reference/iterator/distance/
 	-------------------------------------------------------------------------------- */
 	template<typename InputIterator>
-	typename iterator_traits<InputIterator>::difference_type 		distance(InputIterator first, InputIterator last)
-		{return (last - first);}
+	typename iterator_traits<InputIterator>::difference_type		distance(InputIterator first, InputIterator last)
+		{return (_distance(first, last, typename iterator_traits<InputIterator>::iterator_category()));}
+
+	/* --------------------------------------------------------------------------------
+	- Advance iterator -
+		Advances the iterator it by n element positions.
+		If it is a random-access iterator, the function uses just once operator+ or operator-. Otherwise, the function uses repeatedly the increase or decrease operator (operator++ or operator--) until n elements have been advanced.
+
+	Source: https://cplusplus.com/reference/iterator/advance/
+	-------------------------------------------------------------------------------- */
+	template<typename InputIterator, typename Distance>
+	void															advance(InputIterator& it, Distance n)
+	{
+		_advance(it, n, typename iterator_traits<InputIterator>::iterator_category());
+
+		return;
+	}
 }
 
 #endif
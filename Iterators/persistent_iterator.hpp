@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   persistent_iterator.hpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:51:52 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 09:51:52 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PERSISTENT_ITERATOR_HPP
+# define PERSISTENT_ITERATOR_HPP
+
+# include <cstddef>		// ptrdiff_t, size_t
+
+# include "iterator_traits.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Persistent iterator -
+		Walks a version of a persistent_tree in sorted order. Its nodes have no parent pointer, so the iterator holds the root of the version and the rank of the element, and finds the element from the root using the subtree sizes: a step costs O(log n), the access itself nothing.
+		The past-the-end position is the rank equal to the size of the version.
+	-------------------------------------------------------------------------------- */
+	template<class Node, class T>
+	class persistent_iterator
+	{
+		public:
+			typedef T							value_type;
+			typedef T&							reference;
+			typedef T*							pointer;
+			typedef ptrdiff_t					difference_type;
+			typedef size_t						size_type;
+			typedef persistent_iterator<Node, T>	iterator;
+			typedef bidirectional_iterator_tag	iterator_category;
+
+		private:
+			const Node*	_root;
+			size_type	_rank;
+			const Node*	_node;
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTORS ----- */
+
+			persistent_iterator() : _root(NULL), _rank(0), _node(NULL)
+				{return;}
+
+			persistent_iterator(const persistent_iterator& src) : _root(src._root), _rank(src._rank), _node(src._node)
+				{return;}
+
+			persistent_iterator(const Node* root, size_type rank) : _root(root), _rank(rank), _node(_select(root, rank))
+				{return;}
+
+			~persistent_iterator()
+				{return;}
+
+
+			/* ----- OPERATOR OVERLOADS ----- */
+
+			iterator&			operator=(const persistent_iterator& rhs)
+			{
+				_root = rhs._root;
+				_rank = rhs._rank;
+				_node = rhs._node;
+				return (*this);
+			}
+
+			reference			operator*() const
+				{return (_node->value);}
+
+			pointer				operator->() const
+				{return (&_node->value);}
+
+			iterator&			operator++()
+			{
+				_node = _select(_root, ++_rank);
+				return (*this);
+			}
+
+			iterator			operator++(int)
+			{
+				persistent_iterator	tmp(*this);
+
+				++(*this);
+
+				return (tmp);
+			}
+
+			iterator&			operator--()
+			{
+				_node = _select(_root, --_rank);
+				return (*this);
+			}
+
+			iterator			operator--(int)
+			{
+				persistent_iterator	tmp(*this);
+
+				--(*this);
+
+				return (tmp);
+			}
+
+
+			/* ----- MEMBER FUNCTION ----- */
+
+			size_type			rank() const
+				{return (_rank);}
+
+		private:
+			/* --------------------------------------------------------------------------------
+			- Select -
+				Returns the node of rank i in the tree rooted at n, or NULL if there are not that many.
+			-------------------------------------------------------------------------------- */
+			static const Node*	_select(const Node* n, size_type i)
+			{
+				while (n)
+				{
+					size_type	left = (n->left ? n->left->count : 0);
+
+					if (i == left)
+						return (n);
+					if (i < left)
+						n = n->left;
+					else
+					{
+						i -= left + 1;
+						n = n->right;
+					}
+				}
+
+				return (NULL);
+			}
+	};
+
+
+	/* ----- NON-MEMBER OPERATOR OVERLOADS ----- */
+
+	template<class Node, class T1, class T2>
+	bool	operator==(const persistent_iterator<Node, T1>& left, const persistent_iterator<Node, T2>& right)
+		{return (left.rank() == right.rank());}
+
+	template<class Node, class T1, class T2>
+	bool	operator!=(const persistent_iterator<Node, T1>& left, const persistent_iterator<Node, T2>& right)
+		{return (!(left == right));}
+}
+
+#endif
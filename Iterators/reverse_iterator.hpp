@@ -6,7 +6,7 @@
 /*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/15 15:17:43 by hcremers          #+#    #+#             */
-/*   Updated: 2022/12/19 16:12:54 by hcremers         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:42:05 by hcremers         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -328,6 +328,17 @@ namespace ft
 	template<class Iterator>
 	typename reverse_iterator<Iterator>::difference_type	operator-(const reverse_iterator<Iterator>& lhs, const reverse_iterator<Iterator>& rhs)
 		{return (rhs.base() - lhs.base());}
+
+
+	/* ----- CATEGORY DISPATCH ----- */
+
+	/* --------------------------------------------------------------------------------
+	- Distance between bidirectional reverse iterators -
+		Forwards to the distance of the base iterators, so that iterators with a fast distance (see tree_iterator) keep it when reversed.
+	-------------------------------------------------------------------------------- */
+	template<class Iterator>
+	typename reverse_iterator<Iterator>::difference_type	_distance(reverse_iterator<Iterator> first, reverse_iterator<Iterator> last, bidirectional_iterator_tag)
+		{return (ft::distance(last.base(), first.base()));}
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   skiplist_iterator.hpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:58:18 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 09:58:18 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SKIPLIST_ITERATOR_HPP
+# define SKIPLIST_ITERATOR_HPP
+
+# include <cstddef>		// ptrdiff_t, size_t
+
+# include "iterator_traits.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Skiplist iterator -
+		Walks level 0 of a lock-free skiplist in key order, skipping the nodes deleted since; NULL is the past-the-end position.
+		Other threads may insert and erase while it walks: it sees the elements that were there all along and may or may not see the others, and stays valid as long as the epoch it was obtained in.
+	-------------------------------------------------------------------------------- */
+	template<class Node, class T>
+	class skiplist_iterator
+	{
+		public:
+			typedef T							value_type;
+			typedef T&							reference;
+			typedef T*							pointer;
+			typedef ptrdiff_t					difference_type;
+			typedef size_t						size_type;
+			typedef skiplist_iterator<Node, T>	iterator;
+			typedef forward_iterator_tag		iterator_category;
+
+		private:
+			Node*	_node;
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTORS ----- */
+
+			skiplist_iterator() : _node(NULL)
+				{return;}
+
+			skiplist_iterator(const skiplist_iterator& src) : _node(src._node)
+				{return;}
+
+			explicit skiplist_iterator(Node* node) : _node(node)
+				{return;}
+
+			~skiplist_iterator()
+				{return;}
+
+
+			/* ----- OPERATOR OVERLOADS ----- */
+
+			iterator&			operator=(const skiplist_iterator& rhs)
+			{
+				_node = rhs._node;
+				return (*this);
+			}
+
+			reference			operator*() const
+				{return (_node->value);}
+
+			pointer				operator->() const
+				{return (&_node->value);}
+
+			iterator&			operator++()
+			{
+				_node = _node->successor();
+				return (*this);
+			}
+
+			iterator			operator++(int)
+			{
+				skiplist_iterator	tmp(*this);
+
+				++(*this);
+
+				return (tmp);
+			}
+
+
+			/* ----- MEMBER FUNCTION ----- */
+
+			Node*				base() const
+				{return (_node);}
+	};
+
+
+	/* ----- NON-MEMBER OPERATOR OVERLOADS ----- */
+
+	template<class Node, class T1, class T2>
+	bool	operator==(const skiplist_iterator<Node, T1>& left, const skiplist_iterator<Node, T2>& right)
+		{return (left.base() == right.base());}
+
+	template<class Node, class T1, class T2>
+	bool	operator!=(const skiplist_iterator<Node, T1>& left, const skiplist_iterator<Node, T2>& right)
+		{return (!(left == right));}
+}
+
+#endif
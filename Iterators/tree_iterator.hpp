@@ -6,7 +6,7 @@
 /*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/23 17:37:55 by hcremers          #+#    #+#             */
-/*   Updated: 2022/12/19 15:51:53 by hcremers         ###   ########.fr       */
+/*   Updated: 2026/10/19 10:38:25 by hcremers         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -55,11 +55,11 @@ namespace ft
 
 			/* ----- OPERATOR OVERLOADS ----- */
 
-			operator			tree_iterator<const T, Compare, red_black_node<const T, Compare> >() const
+			operator			tree_iterator<const T, Compare, typename Node::node_const_type>() const
 			{
 				const iterator&	it = *this;
 
-				return (reinterpret_cast<const tree_iterator<const T, Compare, red_black_node<const T, Compare> >&>(it));
+				return (reinterpret_cast<const tree_iterator<const T, Compare, typename Node::node_const_type>&>(it));
 			}
 
 			operator			node_pointer() const
@@ -90,7 +90,7 @@ namespace ft
 
 				_content = _content->iterate();
 
-				return (*this);
+				return (tmp);
 			}
 
 			iterator&			operator--()
@@ -106,7 +106,7 @@ namespace ft
 
 				_content = _content->reverse_iterate();
 
-				return (*this);
+				return (tmp);
 			}
 
 
@@ -126,6 +126,34 @@ namespace ft
 	template<class T1, class T2, class Compare, class Node1, class Node2>
 	bool	operator!=(const tree_iterator<T1, Compare, Node1>& left, const tree_iterator<T2, Compare, Node2>& right)
 		{return (!(left == right));}
+
+
+	/* ----- CATEGORY DISPATCH ----- */
+
+	/* --------------------------------------------------------------------------------
+	- Distance between tree iterators -
+		Uses the subtree counts kept by the nodes: both ends are ranked in O(log n) instead of stepping through every element in between.
+		When last is the end of the tree its rank is the count of the root, read in O(1).
+	-------------------------------------------------------------------------------- */
+	template<class T, class Compare, class Node>
+	typename tree_iterator<T, Compare, Node>::difference_type	_distance(tree_iterator<T, Compare, Node> first, tree_iterator<T, Compare, Node> last, bidirectional_iterator_tag)
+	{
+		typedef typename tree_iterator<T, Compare, Node>::difference_type	difference_type;
+
+		return (static_cast<difference_type>(last.base()->rank()) - static_cast<difference_type>(first.base()->rank()));
+	}
+
+	/* --------------------------------------------------------------------------------
+	- Advance a tree iterator -
+		Jumps n positions in O(log n) through the subtree counts, instead of calling iterate() n times.
+	-------------------------------------------------------------------------------- */
+	template<class T, class Compare, class Node, typename Distance>
+	void														_advance(tree_iterator<T, Compare, Node>& it, Distance n, bidirectional_iterator_tag)
+	{
+		it = tree_iterator<T, Compare, Node>(it.base()->advance(n));
+
+		return;
+	}
 }
 
 #endif
\ No newline at end of file
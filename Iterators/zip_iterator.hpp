@@ -0,0 +1,282 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   zip_iterator.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:17:25 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 09:17:25 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ZIP_ITERATOR_HPP
+# define ZIP_ITERATOR_HPP
+
+# include <cstddef>	// ptrdiff_t, size_t
+
+# include "iterator_traits.hpp"
+# include "../Others/pair.hpp"
+
+namespace ft
+{
+	template<class First, class Second>
+	class zip_pointer;
+
+	/* --------------------------------------------------------------------------------
+	- Zip reference -
+		Stands for a pair whose first and second members live in two different arrays: first and second refer to the elements themselves, so assigning to second writes through to its array.
+		Converts to any pair constructible from its members, and compares like a pair.
+	-------------------------------------------------------------------------------- */
+	template<class First, class Second>
+	class zip_reference
+	{
+		public:
+			typedef First	first_type;
+			typedef Second	second_type;
+
+			First&			first;
+			Second&			second;
+
+			zip_reference(First& a, Second& b) : first(a), second(b)
+				{return;}
+
+			zip_reference(const zip_reference& src) : first(src.first), second(src.second)
+				{return;}
+
+			~zip_reference()
+				{return;}
+
+			template<class U, class V>
+			operator					pair<U, V>() const
+				{return (pair<U, V>(first, second));}
+
+			zip_pointer<First, Second>	operator&() const
+				{return (zip_pointer<First, Second>(*this));}
+
+		private:
+			zip_reference&				operator=(const zip_reference&);
+	};
+
+	/* --------------------------------------------------------------------------------
+	- Zip pointer -
+		What taking the address of a zip reference returns, so that it->first and it->second work on iterators whose operator-> is &operator*(), such as reverse_iterator.
+		It holds the reference itself, and operator-> takes its real address the way std::addressof does, since operator& is overloaded.
+	-------------------------------------------------------------------------------- */
+	template<class First, class Second>
+	class zip_pointer
+	{
+		private:
+			zip_reference<First, Second>	_ref;
+
+		public:
+			explicit zip_pointer(const zip_reference<First, Second>& ref) : _ref(ref)
+				{return;}
+
+			zip_pointer(const zip_pointer& src) : _ref(src._ref)
+				{return;}
+
+			~zip_pointer()
+				{return;}
+
+			const zip_reference<First, Second>*	operator->() const
+				{return (reinterpret_cast<const zip_reference<First, Second>*>(&reinterpret_cast<const char&>(_ref)));}
+
+		private:
+			zip_pointer&						operator=(const zip_pointer&);
+	};
+
+
+	/* ----- NON-MEMBER OPERATOR OVERLOADS ----- */
+
+	template<class T1, class T2, class U1, class U2>
+	bool	operator==(const zip_reference<T1, T2>& lhs, const zip_reference<U1, U2>& rhs)
+		{return (lhs.first == rhs.first && lhs.second == rhs.second);}
+
+	template<class T1, class T2, class U1, class U2>
+	bool	operator!=(const zip_reference<T1, T2>& lhs, const zip_reference<U1, U2>& rhs)
+		{return (!(lhs == rhs));}
+
+	template<class T1, class T2, class U1, class U2>
+	bool	operator<(const zip_reference<T1, T2>& lhs, const zip_reference<U1, U2>& rhs)
+		{return (lhs.first < rhs.first || (!(rhs.first < lhs.first) && lhs.second < rhs.second));}
+
+	template<class T1, class T2, class U1, class U2>
+	bool	operator<=(const zip_reference<T1, T2>& lhs, const zip_reference<U1, U2>& rhs)
+		{return (!(rhs < lhs));}
+
+	template<class T1, class T2, class U1, class U2>
+	bool	operator>(const zip_reference<T1, T2>& lhs, const zip_reference<U1, U2>& rhs)
+		{return (rhs < lhs);}
+
+	template<class T1, class T2, class U1, class U2>
+	bool	operator>=(const zip_reference<T1, T2>& lhs, const zip_reference<U1, U2>& rhs)
+		{return (!(lhs < rhs));}
+
+
+	/* --------------------------------------------------------------------------------
+	- Zip iterator -
+		Walks two arrays in lockstep: the element at position i is the pair of the i-th elements of both arrays, returned as a zip_reference.
+		Random access, like the pointers it holds; only the first pointer is compared, the second always moves along with it.
+	-------------------------------------------------------------------------------- */
+	template<class First, class Second>
+	class zip_iterator
+	{
+		public:
+			typedef pair<First, Second>				value_type;
+			typedef zip_reference<First, Second>	reference;
+			typedef zip_pointer<First, Second>		pointer;
+			typedef ptrdiff_t						difference_type;
+			typedef size_t							size_type;
+			typedef random_access_iterator_tag		iterator_category;
+
+		private:
+			First*			_first;
+			Second*			_second;
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTOR ----- */
+
+			zip_iterator() : _first(NULL), _second(NULL)
+				{return;}
+
+			zip_iterator(const zip_iterator& src) : _first(src._first), _second(src._second)
+				{return;}
+
+			zip_iterator(First* first, Second* second) : _first(first), _second(second)
+				{return;}
+
+			~zip_iterator()
+				{return;}
+
+
+			/* ----- OPERATOR OVERLOADS ----- */
+
+			operator		zip_iterator<const First, const Second>() const
+				{return (zip_iterator<const First, const Second>(_first, _second));}
+
+			zip_iterator&	operator=(const zip_iterator& rhs)
+			{
+				_first = rhs._first;
+				_second = rhs._second;
+				return (*this);
+			}
+
+			reference		operator*() const
+				{return (reference(*_first, *_second));}
+
+			pointer			operator->() const
+				{return (pointer(operator*()));}
+
+			zip_iterator&	operator++()
+			{
+				++_first;
+				++_second;
+
+				return (*this);
+			}
+
+			zip_iterator	operator++(int)
+			{
+				zip_iterator	tmp(*this);
+
+				++_first;
+				++_second;
+
+				return (tmp);
+			}
+
+			zip_iterator&	operator--()
+			{
+				--_first;
+				--_second;
+
+				return (*this);
+			}
+
+			zip_iterator	operator--(int)
+			{
+				zip_iterator	tmp(*this);
+
+				--_first;
+				--_second;
+
+				return (tmp);
+			}
+
+			zip_iterator	operator+(difference_type rhs) const
+				{return (zip_iterator(_first + rhs, _second + rhs));}
+
+			zip_iterator	operator-(difference_type rhs) const
+				{return (zip_iterator(_first - rhs, _second - rhs));}
+
+			zip_iterator&	operator+=(difference_type rhs)
+			{
+				_first += rhs;
+				_second += rhs;
+
+				return (*this);
+			}
+
+			zip_iterator&	operator-=(difference_type rhs)
+			{
+				_first -= rhs;
+				_second -= rhs;
+
+				return (*this);
+			}
+
+			reference		operator[](difference_type n) const
+				{return (reference(_first[n], _second[n]));}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			First*			base() const
+				{return (_first);}
+
+			Second*			second_base() const
+				{return (_second);}
+	};
+
+
+	/* ----- NON-MEMBER OPERATOR OVERLOADS ----- */
+
+	template<class T1, class T2, class U1, class U2>
+	bool			operator==(const zip_iterator<T1, T2>& lhs, const zip_iterator<U1, U2>& rhs)
+		{return (lhs.base() == rhs.base());}
+
+	template<class T1, class T2, class U1, class U2>
+	bool			operator!=(const zip_iterator<T1, T2>& lhs, const zip_iterator<U1, U2>& rhs)
+		{return (lhs.base() != rhs.base());}
+
+	template<class T1, class T2, class U1, class U2>
+	bool			operator<(const zip_iterator<T1, T2>& lhs, const zip_iterator<U1, U2>& rhs)
+		{return (lhs.base() < rhs.base());}
+
+	template<class T1, class T2, class U1, class U2>
+	bool			operator>(const zip_iterator<T1, T2>& lhs, const zip_iterator<U1, U2>& rhs)
+		{return (lhs.base() > rhs.base());}
+
+	template<class T1, class T2, class U1, class U2>
+	bool			operator<=(const zip_iterator<T1, T2>& lhs, const zip_iterator<U1, U2>& rhs)
+		{return (lhs.base() <= rhs.base());}
+
+	template<class T1, class T2, class U1, class U2>
+	bool			operator>=(const zip_iterator<T1, T2>& lhs, const zip_iterator<U1, U2>& rhs)
+		{return (lhs.base() >= rhs.base());}
+
+	template<class T1, class T2>
+	zip_iterator<T1, T2>	operator+(typename zip_iterator<T1, T2>::difference_type n, const zip_iterator<T1, T2>& it)
+		{return (it + n);}
+
+	template<class T1, class T2, class U1, class U2>
+	ptrdiff_t		operator-(const zip_iterator<T1, T2>& lhs, const zip_iterator<U1, U2>& rhs)
+		{return (lhs.base() - rhs.base());}
+}
+
+#endif
+
+/* --------------------------------------------------------------------------------
+Source: https://en.cppreference.com/w/cpp/container/flat_map
+-------------------------------------------------------------------------------- */
@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   aggregate.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:42:57 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 08:42:57 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef AGGREGATE_HPP
+# define AGGREGATE_HPP
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Aggregate policies -
+		An aggregate policy turns a red_black_tree into an augmented tree: every node stores the aggregate of its own subtree, recomputed by the tree on insertion, erasure and rotations, so that the aggregate of any range can be answered in O(log n).
+		A policy is a monoid over the stored values and provides:
+			- result_type								the type of the aggregate
+			- result_type identity() const				the neutral element (aggregate of an empty range)
+			- result_type operator()(const T&) const	the aggregate of a single value
+			- result_type combine(a, b) const			the aggregate of two adjacent ranges, a coming before b (must be associative)
+	-------------------------------------------------------------------------------- */
+
+	struct	empty_aggregate	{};
+
+	/* --------------------------------------------------------------------------------
+	- No aggregate -
+		Default policy: nodes carry an empty aggregate, which fits in the padding after the node colour.
+	-------------------------------------------------------------------------------- */
+	template<class T>
+	struct no_aggregate
+	{
+		typedef empty_aggregate	result_type;
+
+		result_type	identity() const
+			{return (result_type());}
+
+		result_type	operator()(const T&) const
+			{return (result_type());}
+
+		result_type	combine(const result_type&, const result_type&) const
+			{return (result_type());}
+	};
+}
+
+#endif
@@ -6,13 +6,17 @@
 /*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/17 11:51:15 by hcremers          #+#    #+#             */
-/*   Updated: 2022/12/19 11:08:57 by hcremers         ###   ########.fr       */
+/*   Updated: 2026/10/19 10:14:40 by hcremers         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef ALGORITHM_HPP
 # define ALGORITHM_HPP
 
+# include <memory>	// std::allocator
+
+# include "../Iterators/iterator_traits.hpp"
+
 namespace ft
 {
 	/* ------------------------------------------------------------------------
@@ -62,6 +66,423 @@ namespace ft
 
 		return (first2 != last2);
 	}
+
+	/* ------------------------------------------------------------------------
+	- Default ordering -
+		Compares with operator<, for the overloads of the sorted range algorithms that take no comparison object.
+	------------------------------------------------------------------------ */
+	struct	_less
+	{
+		template<class T1, class T2>
+		bool	operator()(const T1& a, const T2& b) const
+			{return (a < b);}
+	};
+
+	/* ------------------------------------------------------------------------
+	- Union of two sorted ranges -
+		Constructs a sorted range beginning in the location pointed by result with the set union of the two sorted ranges [first1, last1] and [first2, last2].
+		The union is formed by the elements that are present in either one of the sets, or in both. Elements from the second range that have an equivalent element in the first range are not copied to the resulting range.
+		Both ranges are walked once, in linear time.
+
+	Source: https://cplusplus.com/reference/algorithm/set_union/
+	------------------------------------------------------------------------ */
+	template<class InputIterator1, class InputIterator2, class OutputIterator, class Compare>
+	OutputIterator	set_union(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		while (first1 != last1 && first2 != last2)
+		{
+			if (comp(*first1, *first2))
+				*result = *first1++;
+			else if (comp(*first2, *first1))
+				*result = *first2++;
+			else
+			{
+				*result = *first1++;
+				++first2;
+			}
+			++result;
+		}
+		for (; first1 != last1; ++first1, ++result)
+			*result = *first1;
+		for (; first2 != last2; ++first2, ++result)
+			*result = *first2;
+
+		return (result);
+	}
+
+	template<class InputIterator1, class InputIterator2, class OutputIterator>
+	OutputIterator	set_union(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, OutputIterator result)
+		{return (ft::set_union(first1, last1, first2, last2, result, _less()));}
+
+	/* ------------------------------------------------------------------------
+	- Intersection of two sorted ranges -
+		Constructs a sorted range beginning in the location pointed by result with the set intersection of the two sorted ranges [first1, last1] and [first2, last2].
+		The intersection is formed only by the elements that are present in both sets. The elements copied by the function come always from the first range, in the same order.
+
+	Source: https://cplusplus.com/reference/algorithm/set_intersection/
+	------------------------------------------------------------------------ */
+	template<class InputIterator1, class InputIterator2, class OutputIterator, class Compare>
+	OutputIterator	set_intersection(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		while (first1 != last1 && first2 != last2)
+		{
+			if (comp(*first1, *first2))
+				++first1;
+			else if (comp(*first2, *first1))
+				++first2;
+			else
+			{
+				*result = *first1;
+				++result;
+				++first1;
+				++first2;
+			}
+		}
+
+		return (result);
+	}
+
+	template<class InputIterator1, class InputIterator2, class OutputIterator>
+	OutputIterator	set_intersection(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, OutputIterator result)
+		{return (ft::set_intersection(first1, last1, first2, last2, result, _less()));}
+
+	/* ------------------------------------------------------------------------
+	- Difference of two sorted ranges -
+		Constructs a sorted range beginning in the location pointed by result with the set difference of the sorted range [first1, last1] with respect to the sorted range [first2, last2].
+		The difference of two sets is formed by the elements that are present in the first set, but not in the second one. The elements copied by the function come always from the first range, in the same order.
+
+	Source: https://cplusplus.com/reference/algorithm/set_difference/
+	------------------------------------------------------------------------ */
+	template<class InputIterator1, class InputIterator2, class OutputIterator, class Compare>
+	OutputIterator	set_difference(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		while (first1 != last1 && first2 != last2)
+		{
+			if (comp(*first1, *first2))
+			{
+				*result = *first1;
+				++result;
+				++first1;
+			}
+			else if (comp(*first2, *first1))
+				++first2;
+			else
+			{
+				++first1;
+				++first2;
+			}
+		}
+		for (; first1 != last1; ++first1, ++result)
+			*result = *first1;
+
+		return (result);
+	}
+
+	template<class InputIterator1, class InputIterator2, class OutputIterator>
+	OutputIterator	set_difference(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, OutputIterator result)
+		{return (ft::set_difference(first1, last1, first2, last2, result, _less()));}
+
+	/* ------------------------------------------------------------------------
+	- Insertion sort -
+		Sorts a short range in place, moving each element left past the elements that compare greater; equivalent elements keep their order.
+	------------------------------------------------------------------------ */
+	template<class RandomAccessIterator, class Compare>
+	void			_insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::value_type	value_type;
+
+		if (first == last)
+			return;
+
+		for (RandomAccessIterator i = first + 1; i != last; ++i)
+		{
+			value_type				tmp = *i;
+			RandomAccessIterator	j = i;
+
+			for (; j != first && comp(tmp, *(j - 1)); --j)
+				*j = *(j - 1);
+			*j = tmp;
+		}
+
+		return;
+	}
+
+	/* ------------------------------------------------------------------------
+	- Merge sort -
+		Sorts both halves, then merges them back in place from a copy of the first half held in buffer.
+		Halves that are already in order are not merged, so a sorted or nearly sorted range costs little more than one pass.
+	------------------------------------------------------------------------ */
+	template<class RandomAccessIterator, class Compare, class Alloc>
+	void			_merge_sort(RandomAccessIterator first, RandomAccessIterator last, typename Alloc::pointer buffer, Compare comp, Alloc& alloc)
+	{
+		typedef typename Alloc::pointer	pointer;
+
+		if (last - first <= 16)
+		{
+			ft::_insertion_sort(first, last, comp);
+			return;
+		}
+
+		RandomAccessIterator	mid = first + (last - first) / 2;
+
+		ft::_merge_sort(first, mid, buffer, comp, alloc);
+		ft::_merge_sort(mid, last, buffer, comp, alloc);
+		if (!comp(*mid, *(mid - 1)))
+			return;
+
+		pointer	end = buffer;
+
+		for (RandomAccessIterator it = first; it != mid; ++it, ++end)
+			alloc.construct(end, *it);
+
+		pointer					left = buffer;
+		RandomAccessIterator	right = mid;
+		RandomAccessIterator	out = first;
+
+		while (left != end && right != last)
+		{
+			if (comp(*right, *left))
+				*out++ = *right++;
+			else
+				*out++ = *left++;
+		}
+		while (left != end)
+			*out++ = *left++;
+
+		for (pointer p = buffer; p != end; ++p)
+			alloc.destroy(p);
+
+		return;
+	}
+
+	/* ------------------------------------------------------------------------
+	- Sort elements preserving order of equivalents -
+		Sorts the elements in the range [first, last) into ascending order, like sort, but stable_sort preserves the relative order of the elements with equivalent values.
+		Merge sort in O(n log n) comparisons, with a buffer of half the range and insertion sort below 16 elements.
+
+	Source: https://cplusplus.com/reference/algorithm/stable_sort/
+	------------------------------------------------------------------------ */
+	template<class RandomAccessIterator, class Compare>
+	void			stable_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::value_type	value_type;
+
+		std::allocator<value_type>	alloc;
+		size_t						half = (last - first) / 2 + 1;
+		value_type*					buffer = alloc.allocate(half);
+
+		ft::_merge_sort(first, last, buffer, comp, alloc);
+		alloc.deallocate(buffer, half);
+
+		return;
+	}
+
+	template<class RandomAccessIterator>
+	void			stable_sort(RandomAccessIterator first, RandomAccessIterator last)
+		{ft::stable_sort(first, last, _less());}
+
+	/* ------------------------------------------------------------------------
+	- Sift up -
+		Moves the hole at index hole of the D-ary heap starting at first up past the parents that compare less than val, then puts val in it.
+	------------------------------------------------------------------------ */
+	template<size_t D, class RandomAccessIterator, class Distance, class T, class Compare>
+	void			_sift_up(RandomAccessIterator first, Distance hole, const T& val, Compare comp)
+	{
+		while (hole > 0)
+		{
+			Distance	parent = (hole - 1) / D;
+
+			if (!comp(first[parent], val))
+				break;
+			first[hole] = first[parent];
+			hole = parent;
+		}
+		first[hole] = val;
+
+		return;
+	}
+
+	/* ------------------------------------------------------------------------
+	- Sift down -
+		Moves the hole at index hole of the D-ary heap of len elements starting at first down past the greatest of its children, as long as it compares greater than val, then puts val in it.
+		The D children of a node are contiguous, so each level costs one cache line for small elements instead of D.
+	------------------------------------------------------------------------ */
+	template<size_t D, class RandomAccessIterator, class Distance, class T, class Compare>
+	void			_sift_down(RandomAccessIterator first, Distance len, Distance hole, const T& val, Compare comp)
+	{
+		Distance	child;
+
+		while ((child = hole * D + 1) < len)
+		{
+			Distance	end = (len - child < static_cast<Distance>(D) ? len : child + D);
+			Distance	best = child;
+
+			for (++child; child < end; ++child)
+			{
+				if (comp(first[best], first[child]))
+					best = child;
+			}
+			if (!comp(val, first[best]))
+				break;
+			first[hole] = first[best];
+			hole = best;
+		}
+		first[hole] = val;
+
+		return;
+	}
+
+	/* ------------------------------------------------------------------------
+	- Sift to leaf -
+		Moves the hole at the root of the D-ary heap of len elements starting at first down to a leaf, moving up the greatest child at each level, and returns its index.
+	------------------------------------------------------------------------ */
+	template<size_t D, class RandomAccessIterator, class Distance, class Compare>
+	Distance		_sift_to_leaf(RandomAccessIterator first, Distance len, Compare comp)
+	{
+		Distance	hole = 0;
+		Distance	child;
+
+		while ((child = hole * D + 1) < len)
+		{
+			Distance	end = (len - child < static_cast<Distance>(D) ? len : child + D);
+			Distance	best = child;
+
+			for (++child; child < end; ++child)
+			{
+				if (comp(first[best], first[child]))
+					best = child;
+			}
+			first[hole] = first[best];
+			hole = best;
+		}
+
+		return (hole);
+	}
+
+	/* ------------------------------------------------------------------------
+	- Push element into D-ary heap range -
+		Like push_heap, for a heap in which each node has D children instead of 2: a push compares with fewer ancestors, log D (n) of them, and a pop with more children per level, but over fewer levels that are each one contiguous block.
+		D is given explicitly: ft::dary_push_heap<4>(first, last).
+	------------------------------------------------------------------------ */
+	template<size_t D, class RandomAccessIterator, class Compare>
+	void			dary_push_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::value_type		value_type;
+		typedef typename iterator_traits<RandomAccessIterator>::difference_type	difference_type;
+
+		if (last - first < 2)
+			return;
+
+		value_type	val = *(last - 1);
+
+		ft::_sift_up<D>(first, static_cast<difference_type>(last - first - 1), val, comp);
+
+		return;
+	}
+
+	template<size_t D, class RandomAccessIterator>
+	void			dary_push_heap(RandomAccessIterator first, RandomAccessIterator last)
+		{ft::dary_push_heap<D>(first, last, _less());}
+
+	/* ------------------------------------------------------------------------
+	- Pop element from D-ary heap range -
+		Like pop_heap, for a heap in which each node has D children.
+		The last element, which takes the place of the top, is usually among the smallest: rather than comparing it with the greatest child at every level on the way down, the hole goes all the way down to a leaf, then the element is sifted up from there, which rarely takes more than a level or two.
+	------------------------------------------------------------------------ */
+	template<size_t D, class RandomAccessIterator, class Compare>
+	void			dary_pop_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::value_type		value_type;
+		typedef typename iterator_traits<RandomAccessIterator>::difference_type	difference_type;
+
+		if (last - first < 2)
+			return;
+
+		value_type	val = *(last - 1);
+
+		*(last - 1) = *first;
+		ft::_sift_up<D>(first, ft::_sift_to_leaf<D>(first, static_cast<difference_type>(last - first - 1), comp), val, comp);
+
+		return;
+	}
+
+	template<size_t D, class RandomAccessIterator>
+	void			dary_pop_heap(RandomAccessIterator first, RandomAccessIterator last)
+		{ft::dary_pop_heap<D>(first, last, _less());}
+
+	/* ------------------------------------------------------------------------
+	- Make D-ary heap from range -
+		Like make_heap, for a heap in which each node has D children: sifts down every node that has children, from the last one back to the root, in O(n).
+	------------------------------------------------------------------------ */
+	template<size_t D, class RandomAccessIterator, class Compare>
+	void			dary_make_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::value_type		value_type;
+		typedef typename iterator_traits<RandomAccessIterator>::difference_type	difference_type;
+
+		difference_type	len = last - first;
+
+		if (len < 2)
+			return;
+
+		for (difference_type i = (len - 2) / D + 1; i--; )
+		{
+			value_type	val = first[i];
+
+			ft::_sift_down<D>(first, len, i, val, comp);
+		}
+
+		return;
+	}
+
+	template<size_t D, class RandomAccessIterator>
+	void			dary_make_heap(RandomAccessIterator first, RandomAccessIterator last)
+		{ft::dary_make_heap<D>(first, last, _less());}
+
+	/* ------------------------------------------------------------------------
+	- Push element into heap range -
+		Given a heap in the range [first, last-1), this function extends the range considered a heap to [first, last) by placing the value in (last-1) into its corresponding location within it.
+		A range can be organized into a heap by calling make_heap. After that, its heap properties are preserved if elements are added and removed from it using push_heap and pop_heap, respectively.
+
+	Source: https://cplusplus.com/reference/algorithm/push_heap/
+	------------------------------------------------------------------------ */
+	template<class RandomAccessIterator, class Compare>
+	void			push_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+		{ft::dary_push_heap<2>(first, last, comp);}
+
+	template<class RandomAccessIterator>
+	void			push_heap(RandomAccessIterator first, RandomAccessIterator last)
+		{ft::dary_push_heap<2>(first, last, _less());}
+
+	/* ------------------------------------------------------------------------
+	- Pop element from heap range -
+		Rearranges the elements in the heap range [first, last) in such a way that the part considered a heap is shortened by one: The element with the highest value is moved to (last-1).
+		While the element with the highest value is moved from first to (last-1) (which now is out of the heap), the other elements are reorganized in such a way that the range [first, last-1) preserves the properties of a heap.
+
+	Source: https://cplusplus.com/reference/algorithm/pop_heap/
+	------------------------------------------------------------------------ */
+	template<class RandomAccessIterator, class Compare>
+	void			pop_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+		{ft::dary_pop_heap<2>(first, last, comp);}
+
+	template<class RandomAccessIterator>
+	void			pop_heap(RandomAccessIterator first, RandomAccessIterator last)
+		{ft::dary_pop_heap<2>(first, last, _less());}
+
+	/* ------------------------------------------------------------------------
+	- Make heap from range -
+		Rearranges the elements in the range [first, last) in such a way that they form a heap.
+		The element with the highest value is always pointed by first. The order of the other elements depends on the particular implementation, but it is consistent throughout all heap-related functions of this header.
+
+	Source: https://cplusplus.com/reference/algorithm/make_heap/
+	------------------------------------------------------------------------ */
+	template<class RandomAccessIterator, class Compare>
+	void			make_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+		{ft::dary_make_heap<2>(first, last, comp);}
+
+	template<class RandomAccessIterator>
+	void			make_heap(RandomAccessIterator first, RandomAccessIterator last)
+		{ft::dary_make_heap<2>(first, last, _less());}
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,232 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_node.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:10:05 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 09:14:24 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BTREE_NODE_HPP
+# define BTREE_NODE_HPP
+
+# include <cstddef>	// size_t
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- B-tree node size -
+		Number of key slots of a btree_map node: as many keys as fit in 256 bytes (four cache lines), kept even and between 8 and 64.
+	-------------------------------------------------------------------------------- */
+	template<class Key>
+	struct btree_slots
+	{
+		enum	{value = (256 / sizeof(Key) < 8 ? 8 : (256 / sizeof(Key) > 64 ? 64 : (256 / sizeof(Key)) & ~1))};
+	};
+
+	template<class Key, class Value, size_t Slots>
+	class btree_internal;
+
+	/* --------------------------------------------------------------------------------
+	- B-tree node -
+		Common part of the leaves and the internal nodes of a btree_map: the keys are stored contiguously, so that a node is searched with a linear scan over a few cache lines instead of one cache miss per level of a binary tree.
+		A node has room for Slots keys but holds at most Slots - 1 of them between two operations: it is split as soon as it is full.
+	-------------------------------------------------------------------------------- */
+	template<class Key, class Value, size_t Slots>
+	class btree_node
+	{
+		public:
+			typedef Key										key_type;
+			typedef Value									value_type;
+			typedef size_t									size_type;
+			typedef btree_internal<Key, Value, Slots>*		internal_pointer;
+
+		private:
+			bool				_leaf;
+			size_type			_count;
+			internal_pointer	_parent;
+			key_type			_keys[Slots];
+
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTOR ----- */
+
+			explicit btree_node(bool leaf = true) : _leaf(leaf), _count(0), _parent(NULL), _keys()
+				{return;}
+
+			~btree_node()
+				{return;}
+
+
+			/* ----- ACCESSORS ----- */
+
+			bool				is_leaf() const
+				{return (_leaf);}
+
+			size_type			get_count() const
+				{return (_count);}
+
+			internal_pointer	get_parent() const
+				{return (_parent);}
+
+			key_type&			get_key(size_type i)
+				{return (_keys[i]);}
+
+			const key_type&		get_key(size_type i) const
+				{return (_keys[i]);}
+
+			void				set_count(size_type n)
+			{
+				_count = n;
+				return;
+			}
+
+			void				set_parent(internal_pointer node)
+			{
+				_parent = node;
+				return;
+			}
+
+
+			/* ----- UTILS ----- */
+
+			/* --------------------------------------------------------------------------------
+			- Position of a key -
+				lower_index counts the keys less than k and upper_index the keys not greater than k, which are the positions of lower_bound and upper_bound within the node.
+				The keys are scanned in order: on a node of a few cache lines, a linear scan that the prefetcher can follow beats a binary search, whose branches are unpredictable, and also an unconditional count of every key.
+			-------------------------------------------------------------------------------- */
+			template<class Compare>
+			size_type			lower_index(const key_type& k, const Compare& comp) const
+			{
+				size_type	n = 0;
+
+				while (n < _count && comp(_keys[n], k))
+					n++;
+
+				return (n);
+			}
+
+			template<class Compare>
+			size_type			upper_index(const key_type& k, const Compare& comp) const
+			{
+				size_type	n = 0;
+
+				while (n < _count && !comp(k, _keys[n]))
+					n++;
+
+				return (n);
+			}
+	};
+
+	/* --------------------------------------------------------------------------------
+	- B-tree leaf -
+		Holds the elements themselves, in an array of Slots values allocated by the map next to the keys, and is linked to the previous and next leaves so that iterating is a walk along the leaves.
+	-------------------------------------------------------------------------------- */
+	template<class Key, class Value, size_t Slots>
+	class btree_leaf : public btree_node<Key, Value, Slots>
+	{
+		public:
+			typedef Value							value_type;
+			typedef btree_leaf<Key, Value, Slots>*	pointer;
+
+		private:
+			value_type*	_values;
+			pointer		_prev;
+			pointer		_next;
+
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTOR ----- */
+
+			explicit btree_leaf(value_type* values = NULL) : btree_node<Key, Value, Slots>(true), _values(values), _prev(NULL), _next(NULL)
+				{return;}
+
+			~btree_leaf()
+				{return;}
+
+
+			/* ----- ACCESSORS ----- */
+
+			value_type*		get_values() const
+				{return (_values);}
+
+			value_type&		get_value(size_t i) const
+				{return (_values[i]);}
+
+			pointer			get_prev() const
+				{return (_prev);}
+
+			pointer			get_next() const
+				{return (_next);}
+
+			void			set_prev(pointer node)
+			{
+				_prev = node;
+				return;
+			}
+
+			void			set_next(pointer node)
+			{
+				_next = node;
+				return;
+			}
+	};
+
+	/* --------------------------------------------------------------------------------
+	- B-tree internal node -
+		Holds count separator keys and count + 1 children: every key of child i is less than key i, which is not greater than any key of child i + 1.
+		A separator may outlive the element it was copied from, which keeps that order.
+	-------------------------------------------------------------------------------- */
+	template<class Key, class Value, size_t Slots>
+	class btree_internal : public btree_node<Key, Value, Slots>
+	{
+		public:
+			typedef btree_node<Key, Value, Slots>*	node_pointer;
+			typedef size_t							size_type;
+
+		private:
+			node_pointer	_children[Slots + 1];
+
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTOR ----- */
+
+			btree_internal() : btree_node<Key, Value, Slots>(false), _children()
+				{return;}
+
+			~btree_internal()
+				{return;}
+
+
+			/* ----- ACCESSORS ----- */
+
+			node_pointer	get_child(size_type i) const
+				{return (_children[i]);}
+
+			void			set_child(size_type i, node_pointer node)
+			{
+				_children[i] = node;
+				node->set_parent(this);
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Index of a child -
+				Linear scan of the children, which are at most Slots + 1.
+			-------------------------------------------------------------------------------- */
+			size_type		index_of(node_pointer node) const
+			{
+				size_type	i = 0;
+
+				while (_children[i] != node)
+					i++;
+
+				return (i);
+			}
+	};
+}
+
+#endif
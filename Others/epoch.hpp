@@ -0,0 +1,238 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   epoch.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:39:32 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 10:03:29 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef EPOCH_HPP
+# define EPOCH_HPP
+
+# include <cstddef>		// size_t
+
+# include "hash.hpp"
+# include "prefetch.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Epoch domain -
+		Epoch-based reclamation for structures whose readers take no lock: a writer that unlinks a node cannot free it at once, since a reader may still be walking it, so it retires the node with the current epoch and frees it once every reader has moved past that epoch.
+		A reader announces the epoch it starts in by claiming one of the reader slots (enter), then reads the structure, then clears its slot (leave). A writer publishes its change, then tags the nodes it unlinked with advance(), which returns the epoch they were retired in and starts a new one. A node retired in epoch e can be freed once safe() is greater than e: every reader still active started after the change was published and cannot reach it.
+		The slots are padded to a cache line each so that readers on different cores do not contend; a reader starts looking for a free slot at a hash of its stack address, so that threads usually get a slot of their own at the first try.
+		C++98 has no atomics: the counters are accessed with the __atomic builtins of GCC and Clang, which follow the C++11 memory model, all sequentially consistent but the release of a slot.
+	-------------------------------------------------------------------------------- */
+	class epoch_domain
+	{
+		public:
+			typedef	unsigned long	epoch_type;
+			typedef	size_t			size_type;
+
+			enum					{slots = 128};
+
+		private:
+			struct	_slot
+			{
+				epoch_type			epoch;
+				char				pad[FT_CACHE_LINE - sizeof(epoch_type)];
+			};
+
+			epoch_type				_epoch;
+			char					_pad[FT_CACHE_LINE - sizeof(epoch_type)];
+			_slot					_slots[slots];
+
+			epoch_domain(const epoch_domain&);
+			epoch_domain&			operator=(const epoch_domain&);
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTORS ----- */
+
+			epoch_domain() : _epoch(1)
+			{
+				for (size_type i = 0; i < slots; i++)
+					_slots[i].epoch = 0;
+
+				return;
+			}
+
+			~epoch_domain()
+				{return;}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			/* --------------------------------------------------------------------------------
+			- Enter -
+				Claims a free slot with the current epoch and returns its index, to pass to leave. The compare-and-swap is sequentially consistent: the structure is read only after the slot is visible to writers.
+				Spins if all the slots are taken, which takes more than slots readers at the same time.
+			-------------------------------------------------------------------------------- */
+			size_type				enter()
+			{
+				char		local = 0;
+				size_type	i = _hint(&local);
+				epoch_type	expected = 0;
+
+				while (!__atomic_compare_exchange_n(&_slots[i].epoch, &expected, __atomic_load_n(&_epoch, __ATOMIC_SEQ_CST), false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+				{
+					expected = 0;
+					i = (i + 1) % slots;
+				}
+
+				return (i);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Leave -
+				Releases slot i: every read of the structure completes before the slot is cleared.
+			-------------------------------------------------------------------------------- */
+			void					leave(size_type i)
+			{
+				__atomic_store_n(&_slots[i].epoch, 0, __ATOMIC_RELEASE);
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Current epoch -
+				A node unlinked before the call can be tagged with it as well: the readers that may still hold the node started in it or before. Cheaper than advance for structures that retire often, which only need to advance before collecting.
+			-------------------------------------------------------------------------------- */
+			epoch_type				current() const
+				{return (__atomic_load_n(&_epoch, __ATOMIC_SEQ_CST));}
+
+			/* --------------------------------------------------------------------------------
+			- Advance -
+				Starts a new epoch and returns the previous one, to tag the nodes unlinked by a change published before the call.
+			-------------------------------------------------------------------------------- */
+			epoch_type				advance()
+				{return (__atomic_fetch_add(&_epoch, 1, __ATOMIC_SEQ_CST));}
+
+			/* --------------------------------------------------------------------------------
+			- Safe epoch -
+				Returns the oldest epoch an active reader started in, or the current epoch if there is no reader: the nodes retired in an earlier epoch can be freed.
+			-------------------------------------------------------------------------------- */
+			epoch_type				safe() const
+			{
+				epoch_type	min = __atomic_load_n(&_epoch, __ATOMIC_SEQ_CST);
+
+				for (size_type i = 0; i < slots; i++)
+				{
+					epoch_type	e = __atomic_load_n(&_slots[i].epoch, __ATOMIC_SEQ_CST);
+
+					if (e && e < min)
+						min = e;
+				}
+
+				return (min);
+			}
+
+		private:
+			static size_type		_hint(const void* p)
+				{return (hash_mix(reinterpret_cast<size_type>(p) >> 4) % slots);}
+	};
+
+	/* --------------------------------------------------------------------------------
+	- Retired list -
+		Lock-free list of the nodes retired by any thread of a structure using an epoch_domain, chained by their own retired_next member and tagged with their epoch member.
+		push tells, every period nodes, that it is time to collect the nodes that can be freed; collect detaches them from the list and returns them, chained, for the caller to free, so that the list needs no knowledge of their allocator.
+	-------------------------------------------------------------------------------- */
+	template<class Node>
+	class retired_list
+	{
+		public:
+			typedef	epoch_domain::epoch_type	epoch_type;
+			typedef	size_t						size_type;
+
+			enum								{period = 64};
+
+		private:
+			Node*		_head;
+			size_type	_count;
+
+			retired_list(const retired_list&);
+			retired_list&		operator=(const retired_list&);
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTORS ----- */
+
+			retired_list() : _head(NULL), _count(0)
+				{return;}
+
+			~retired_list()
+				{return;}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			/* --------------------------------------------------------------------------------
+			- Push -
+				Adds n, retired in the given epoch, and returns whether it is time to collect.
+			-------------------------------------------------------------------------------- */
+			bool				push(Node* n, epoch_type epoch)
+			{
+				n->epoch = epoch;
+				_push(n, n);
+
+				return (!(__atomic_add_fetch(&_count, 1, __ATOMIC_RELAXED) % period));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Collect -
+				Takes the whole list, pushes back the nodes retired in safe or later, and returns the others.
+			-------------------------------------------------------------------------------- */
+			Node*				collect(epoch_type safe)
+			{
+				Node*	n = __atomic_exchange_n(&_head, NULL, __ATOMIC_ACQUIRE);
+				Node*	freed = NULL;
+				Node*	kept = NULL;
+				Node*	last = NULL;
+
+				while (n)
+				{
+					Node*	next = n->retired_next;
+
+					if (n->epoch < safe)
+					{
+						n->retired_next = freed;
+						freed = n;
+					}
+					else
+					{
+						n->retired_next = kept;
+						kept = n;
+						if (!last)
+							last = n;
+					}
+					n = next;
+				}
+				if (kept)
+					_push(kept, last);
+
+				return (freed);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Release all -
+				Takes and returns the whole list, when no thread uses the structure anymore.
+			-------------------------------------------------------------------------------- */
+			Node*				release_all()
+				{return (__atomic_exchange_n(&_head, NULL, __ATOMIC_ACQUIRE));}
+
+		private:
+			void				_push(Node* first, Node* last)
+			{
+				Node*	head = __atomic_load_n(&_head, __ATOMIC_RELAXED);
+
+				do
+					last->retired_next = head;
+				while (!__atomic_compare_exchange_n(&_head, &head, first, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+				return;
+			}
+	};
+}
+
+#endif
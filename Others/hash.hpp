@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:21:04 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 09:56:40 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HASH_HPP
+# define HASH_HPP
+
+# include <cstddef>	// size_t
+# include <string>	// std::string
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Default hash function object class -
+		Unary function object class that defines the default hash function used by the unordered containers.
+		Integral types and pointers hash to their own value; the hash tables mix the result before using it, so these need not be well distributed.
+		Strings are hashed with FNV-1a, one byte at a time.
+
+	Source: https://cplusplus.com/reference/functional/hash/
+	-------------------------------------------------------------------------------- */
+	template<class T>
+	struct hash;
+
+	template<class T>
+	struct hash<T*>
+	{
+		size_t	operator()(T* p) const
+			{return (reinterpret_cast<size_t>(p));}
+	};
+
+	template<>
+	struct hash<bool>
+	{
+		size_t	operator()(bool x) const
+			{return (static_cast<size_t>(x));}
+	};
+
+	template<>
+	struct hash<char>
+	{
+		size_t	operator()(char x) const
+			{return (static_cast<size_t>(x));}
+	};
+
+	template<>
+	struct hash<wchar_t>
+	{
+		size_t	operator()(wchar_t x) const
+			{return (static_cast<size_t>(x));}
+	};
+
+	template<>
+	struct hash<signed char>
+	{
+		size_t	operator()(signed char x) const
+			{return (static_cast<size_t>(x));}
+	};
+
+	template<>
+	struct hash<short int>
+	{
+		size_t	operator()(short int x) const
+			{return (static_cast<size_t>(x));}
+	};
+
+	template<>
+	struct hash<int>
+	{
+		size_t	operator()(int x) const
+			{return (static_cast<size_t>(x));}
+	};
+
+	template<>
+	struct hash<long int>
+	{
+		size_t	operator()(long int x) const
+			{return (static_cast<size_t>(x));}
+	};
+
+	template<>
+	struct hash<long long int>
+	{
+		size_t	operator()(long long int x) const
+			{return (static_cast<size_t>(x));}
+	};
+
+	template<>
+	struct hash<unsigned char>
+	{
+		size_t	operator()(unsigned char x) const
+			{return (static_cast<size_t>(x));}
+	};
+
+	template<>
+	struct hash<unsigned short int>
+	{
+		size_t	operator()(unsigned short int x) const
+			{return (static_cast<size_t>(x));}
+	};
+
+	template<>
+	struct hash<unsigned int>
+	{
+		size_t	operator()(unsigned int x) const
+			{return (static_cast<size_t>(x));}
+	};
+
+	template<>
+	struct hash<unsigned long int>
+	{
+		size_t	operator()(unsigned long int x) const
+			{return (static_cast<size_t>(x));}
+	};
+
+	template<>
+	struct hash<unsigned long long int>
+	{
+		size_t	operator()(unsigned long long int x) const
+			{return (static_cast<size_t>(x));}
+	};
+
+	template<>
+	struct hash<std::string>
+	{
+		size_t	operator()(const std::string& s) const
+		{
+			size_t	h = 2166136261u;
+
+			for (std::string::size_type i = 0; i < s.size(); i++)
+			{
+				h ^= static_cast<unsigned char>(s[i]);
+				h *= 16777619u;
+			}
+
+			return (h);
+		}
+	};
+
+	/* --------------------------------------------------------------------------------
+	- Mix hash -
+		Multiplies by the golden ratio (truncated to 32 bits where size_t is), then folds the high half into the low one, so that every bit of the result depends on every bit of h: the low bits of the identity hash of integers or of an aligned address are then as good as any.
+	-------------------------------------------------------------------------------- */
+	inline size_t	hash_mix(size_t h)
+	{
+		h *= (static_cast<size_t>(0x9E3779B9UL) << 16 << 16) | 0x7F4A7C15UL;
+
+		return (h ^ (h >> (sizeof(size_t) * 4)));
+	}
+}
+
+#endif
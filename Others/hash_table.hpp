@@ -0,0 +1,484 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash_table.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:22:04 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 09:56:40 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HASH_TABLE_HPP
+# define HASH_TABLE_HPP
+
+# include <cstddef>		// size_t
+# include <cstring>		// memset, memcpy
+# include <memory>		// std::allocator
+
+# ifdef __SSE2__
+#  include <emmintrin.h>	// _mm_loadu_si128, _mm_cmpeq_epi8, _mm_movemask_epi8
+# endif
+
+# include "hash.hpp"
+# include "pair.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Hash group -
+		Compares the 16 control bytes starting at some slot with one value at once, and returns a mask with bit i set when byte i matches.
+		With SSE2 (any x86-64 compiler), that is one load, one compare and one movemask; elsewhere, a loop over the 16 bytes that the compiler is free to vectorize.
+	-------------------------------------------------------------------------------- */
+	struct	hash_group
+	{
+		enum	{width = 16};
+
+		static unsigned	match(const signed char* ctrl, signed char h2)
+		{
+# ifdef __SSE2__
+			__m128i	group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+
+			return (static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(h2)))));
+# else
+			unsigned	mask = 0;
+
+			for (int i = 0; i < width; i++)
+				mask |= static_cast<unsigned>(ctrl[i] == h2) << i;
+
+			return (mask);
+# endif
+		}
+
+		static unsigned	match_empty(const signed char* ctrl)
+		{
+# ifdef __SSE2__
+			return (static_cast<unsigned>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))));
+# else
+			unsigned	mask = 0;
+
+			for (int i = 0; i < width; i++)
+				mask |= static_cast<unsigned>(ctrl[i] < 0) << i;
+
+			return (mask);
+# endif
+		}
+
+		static unsigned	lowest(unsigned mask)
+		{
+# ifdef __GNUC__
+			return (__builtin_ctz(mask));
+# else
+			unsigned	i = 0;
+
+			for (; !(mask & 1); mask >>= 1)
+				i++;
+
+			return (i);
+# endif
+		}
+	};
+
+	/* --------------------------------------------------------------------------------
+	- Key extractors -
+		How a hash table gets the key of its elements: the first member of the pairs of an unordered_map, the element itself in an unordered_set.
+	-------------------------------------------------------------------------------- */
+	template<class Pair>
+	struct	select_first
+	{
+		const typename Pair::first_type&	operator()(const Pair& p) const
+			{return (p.first);}
+	};
+
+	template<class T>
+	struct	identity
+	{
+		const T&	operator()(const T& x) const
+			{return (x);}
+	};
+
+	/* --------------------------------------------------------------------------------
+	- Hash table -
+		Open addressing over one array of slots, with one control byte per slot: -128 for an empty slot, or the 7 low bits of the hash of the element it holds.
+		An element goes in the first empty slot at or after its home slot (linear probing), and a lookup compares its 7 bits with the 16 control bytes from the home slot on with hash_group, only comparing keys on a match; one empty byte in a group ends an unsuccessful search.
+		The first 15 control bytes are mirrored after the last one, so that a group starting near the end of the array reads past it without wrapping.
+		Erasing shifts the following elements of the run back into the hole, as long as that does not move them before their home slot, so there are no tombstones: a table never slows down from erasing.
+		The capacity is a power of two, of at least 16 slots, and doubles when the size would exceed max_load_factor times the capacity.
+	-------------------------------------------------------------------------------- */
+	template<class Value, class Key, class KeyOfValue, class Hash, class Pred, class Alloc = std::allocator<Value> >
+	class hash_table
+	{
+		public:
+			typedef				Value											value_type;
+			typedef				Key												key_type;
+			typedef				Hash											hasher;
+			typedef				Pred											key_equal;
+			typedef				Alloc											allocator_type;
+			typedef typename	Alloc::template rebind<signed char>::other		control_allocator;
+			typedef				signed char										control_type;
+			typedef				size_t											size_type;
+
+		private:
+			enum															{_min_capacity = 16, _empty = -128};
+
+			control_type*		_ctrl;
+			value_type*			_slots;
+			size_type			_capacity;
+			size_type			_size;
+			size_type			_limit;
+			float				_max_load;
+			hasher				_hash;
+			key_equal			_eq;
+			KeyOfValue			_key_of;
+			allocator_type		_alloc;
+			control_allocator	_ctrl_alloc;
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTORS ----- */
+
+			explicit hash_table(const hasher& hf = hasher(), const key_equal& eq = key_equal(), const allocator_type& alloc = allocator_type()) : _ctrl(NULL), _slots(NULL), _capacity(0), _size(0), _limit(0), _max_load(0.875f), _hash(hf), _eq(eq), _key_of(), _alloc(alloc), _ctrl_alloc()
+				{return;}
+
+			hash_table(const hash_table& src) : _ctrl(NULL), _slots(NULL), _capacity(0), _size(0), _limit(0), _max_load(src._max_load), _hash(src._hash), _eq(src._eq), _key_of(), _alloc(src._alloc), _ctrl_alloc()
+			{
+				_copy(src);
+				return;
+			}
+
+			~hash_table()
+			{
+				_free();
+				return;
+			}
+
+
+			/* ----- OPERATOR OVERLOADS ----- */
+
+			hash_table&				operator=(const hash_table& right)
+			{
+				if (this == &right)
+					return (*this);
+
+				_free();
+				_max_load = right._max_load;
+				_hash = right._hash;
+				_eq = right._eq;
+				_copy(right);
+
+				return (*this);
+			}
+
+
+			/* ----- GETTERS AND SETTERS ----- */
+
+			const control_type*		get_ctrl() const
+				{return (_ctrl);}
+
+			value_type*				get_slots() const
+				{return (_slots);}
+
+			size_type				get_capacity() const
+				{return (_capacity);}
+
+			size_type				size() const
+				{return (_size);}
+
+			const hasher&			get_hash() const
+				{return (_hash);}
+
+			const key_equal&		get_eq() const
+				{return (_eq);}
+
+			allocator_type			get_alloc() const
+				{return (_alloc);}
+
+			float					get_max_load() const
+				{return (_max_load);}
+
+			/* --------------------------------------------------------------------------------
+			- Set maximum load factor -
+				Kept within [0.25, 0.9375], so that a full table always keeps an empty slot to end the searches, and rehashes at once if the table is now over its limit.
+			-------------------------------------------------------------------------------- */
+			void					set_max_load(float ml)
+			{
+				_max_load = (ml < 0.25f ? 0.25f : (ml > 0.9375f ? 0.9375f : ml));
+				_limit = _limit_of(_capacity);
+				if (_capacity && _size > _limit)
+					rehash(0);
+
+				return;
+			}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			/* --------------------------------------------------------------------------------
+			- First full slot -
+				Returns the index of the first slot holding an element, or the capacity if there is none.
+			-------------------------------------------------------------------------------- */
+			size_type				first() const
+			{
+				size_type	i = 0;
+
+				while (i < _capacity && _ctrl[i] < 0)
+					i++;
+
+				return (i);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Find slot of key -
+				Returns the index of the slot holding k, or the capacity if there is none.
+			-------------------------------------------------------------------------------- */
+			size_type				find(const key_type& k) const
+			{
+				if (!_size)
+					return (_capacity);
+
+				size_type		h = hash_mix(_hash(k));
+				control_type	h2 = static_cast<control_type>(h & 0x7F);
+				size_type		mask = _capacity - 1;
+
+				for (size_type pos = (h >> 7) & mask; true; pos = (pos + hash_group::width) & mask)
+				{
+					for (unsigned match = hash_group::match(_ctrl + pos, h2); match; match &= match - 1)
+					{
+						size_type	i = (pos + hash_group::lowest(match)) & mask;
+
+						if (_eq(_key_of(_slots[i]), k))
+							return (i);
+					}
+					if (hash_group::match_empty(_ctrl + pos))
+						return (_capacity);
+				}
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert unique element -
+				Inserts val unless an element with an equivalent key is in the table, growing the table first if it is at its limit.
+
+			Returns a pair with the index of the element with that key, and whether val was inserted.
+			-------------------------------------------------------------------------------- */
+			pair<size_type, bool>	insert_unique(const value_type& val)
+			{
+				size_type	i = find(_key_of(val));
+
+				if (i != _capacity)
+					return (pair<size_type, bool>(i, false));
+
+				if (_size >= _limit)
+					rehash(_capacity * 2);
+				i = _empty_slot(hash_mix(_hash(_key_of(val))));
+				_alloc.construct(_slots + i, val);
+				_size++;
+
+				return (pair<size_type, bool>(i, true));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase slot -
+				Destroys the element at slot i, then walks the rest of its run: every element whose home slot is not between the hole and itself is moved into the hole, which moves to where that element was.
+				The run ends at the first empty slot, which is usually within the same group.
+			-------------------------------------------------------------------------------- */
+			void					erase(size_type i)
+			{
+				size_type	mask = _capacity - 1;
+
+				_alloc.destroy(_slots + i);
+				for (size_type j = (i + 1) & mask; _ctrl[j] != _empty; j = (j + 1) & mask)
+				{
+					size_type	home = (hash_mix(_hash(_key_of(_slots[j]))) >> 7) & mask;
+
+					if (((j - home) & mask) >= ((j - i) & mask))
+					{
+						_alloc.construct(_slots + i, _slots[j]);
+						_alloc.destroy(_slots + j);
+						_set_ctrl(i, _ctrl[j]);
+						i = j;
+					}
+				}
+				_set_ctrl(i, _empty);
+				_size--;
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Clear -
+				Destroys every element and marks every slot empty; the capacity is kept.
+			-------------------------------------------------------------------------------- */
+			void					clear()
+			{
+				for (size_type i = 0; i < _capacity && _size; i++)
+				{
+					if (_ctrl[i] >= 0)
+					{
+						_alloc.destroy(_slots + i);
+						_size--;
+					}
+				}
+				if (_capacity)
+					memset(_ctrl, _empty, _capacity + hash_group::width - 1);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Rehash -
+				Moves every element to a new array of at least n slots, and enough of them for the current size under the maximum load factor.
+			-------------------------------------------------------------------------------- */
+			void					rehash(size_type n)
+			{
+				size_type	capacity = _min_capacity;
+
+				while (capacity < n || _limit_of(capacity) < _size + 1)
+					capacity *= 2;
+				if (capacity == _capacity)
+					return;
+
+				control_type*	old_ctrl = _ctrl;
+				value_type*		old_slots = _slots;
+				size_type		old_capacity = _capacity;
+
+				_allocate(capacity);
+				for (size_type i = 0; i < old_capacity; i++)
+				{
+					if (old_ctrl[i] < 0)
+						continue;
+
+					size_type	j = _empty_slot(hash_mix(_hash(_key_of(old_slots[i]))));
+
+					_alloc.construct(_slots + j, old_slots[i]);
+					_alloc.destroy(old_slots + i);
+				}
+				if (old_capacity)
+				{
+					_ctrl_alloc.deallocate(old_ctrl, old_capacity + hash_group::width - 1);
+					_alloc.deallocate(old_slots, old_capacity);
+				}
+
+				return;
+			}
+
+			void					swap(hash_table& x)
+			{
+				control_type*	tmp_ctrl = _ctrl;
+				value_type*		tmp_slots = _slots;
+				size_type		tmp_capacity = _capacity;
+				size_type		tmp_size = _size;
+				size_type		tmp_limit = _limit;
+				float			tmp_max_load = _max_load;
+				hasher			tmp_hash = _hash;
+				key_equal		tmp_eq = _eq;
+
+				_ctrl = x._ctrl;
+				_slots = x._slots;
+				_capacity = x._capacity;
+				_size = x._size;
+				_limit = x._limit;
+				_max_load = x._max_load;
+				_hash = x._hash;
+				_eq = x._eq;
+				x._ctrl = tmp_ctrl;
+				x._slots = tmp_slots;
+				x._capacity = tmp_capacity;
+				x._size = tmp_size;
+				x._limit = tmp_limit;
+				x._max_load = tmp_max_load;
+				x._hash = tmp_hash;
+				x._eq = tmp_eq;
+
+				return;
+			}
+
+		private:
+			size_type				_limit_of(size_type capacity) const
+			{
+				size_type	limit = static_cast<size_type>(capacity * _max_load);
+
+				return (limit < capacity || !capacity ? limit : capacity - 1);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Set control byte -
+				Also writes the mirrored byte of the first 15 slots.
+			-------------------------------------------------------------------------------- */
+			void					_set_ctrl(size_type i, control_type c)
+			{
+				_ctrl[i] = c;
+				if (i < hash_group::width - 1)
+					_ctrl[_capacity + i] = c;
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Take empty slot -
+				Finds the first empty slot at or after the home slot of hash h and sets its control byte.
+			-------------------------------------------------------------------------------- */
+			size_type				_empty_slot(size_type h)
+			{
+				size_type	mask = _capacity - 1;
+				size_type	pos = (h >> 7) & mask;
+				unsigned	empty;
+
+				while (!(empty = hash_group::match_empty(_ctrl + pos)))
+					pos = (pos + hash_group::width) & mask;
+				pos = (pos + hash_group::lowest(empty)) & mask;
+				_set_ctrl(pos, static_cast<control_type>(h & 0x7F));
+
+				return (pos);
+			}
+
+			void					_allocate(size_type capacity)
+			{
+				_ctrl = _ctrl_alloc.allocate(capacity + hash_group::width - 1);
+				_slots = _alloc.allocate(capacity);
+				_capacity = capacity;
+				_limit = _limit_of(capacity);
+				memset(_ctrl, _empty, capacity + hash_group::width - 1);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Copy table -
+				Copies the control bytes as they are and every element into the same slot, without hashing anything.
+			-------------------------------------------------------------------------------- */
+			void					_copy(const hash_table& src)
+			{
+				if (!src._capacity)
+					return;
+
+				_allocate(src._capacity);
+				memcpy(_ctrl, src._ctrl, _capacity + hash_group::width - 1);
+				for (size_type i = 0; i < _capacity; i++)
+				{
+					if (_ctrl[i] >= 0)
+						_alloc.construct(_slots + i, src._slots[i]);
+				}
+				_size = src._size;
+
+				return;
+			}
+
+			void					_free()
+			{
+				if (!_capacity)
+					return;
+
+				clear();
+				_ctrl_alloc.deallocate(_ctrl, _capacity + hash_group::width - 1);
+				_alloc.deallocate(_slots, _capacity);
+				_ctrl = NULL;
+				_slots = NULL;
+				_capacity = 0;
+				_limit = 0;
+
+				return;
+			}
+	};
+}
+
+#endif
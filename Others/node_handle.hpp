@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   node_handle.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:59:40 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 09:00:55 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef NODE_HANDLE_HPP
+# define NODE_HANDLE_HPP
+
+# include <cstddef>	// NULL
+
+namespace ft
+{
+	template<class Key, class T, class Compare, class Alloc, class Aggregate>
+	class map;
+
+	/* --------------------------------------------------------------------------------
+	- Node handle -
+		Owns a node extracted from a map, with its element, until it is inserted into a compatible map (or destroyed with the handle).
+		Moving an entry between maps, or changing its key, then relinks the same node instead of deallocating it and allocating a new one.
+		C++98 has no move semantics, so ownership is transferred on copy and assignment, like std::auto_ptr: the source handle is left empty.
+
+	Source: https://en.cppreference.com/w/cpp/container/node_handle
+	-------------------------------------------------------------------------------- */
+	template<class Key, class T, class Node, class NodeAlloc>
+	class node_handle
+	{
+		template<class, class, class, class, class>
+		friend class map;
+
+		public:
+			typedef				Key					key_type;
+			typedef				T					mapped_type;
+			typedef typename	Node::value_type	value_type;
+			typedef				NodeAlloc			allocator_type;
+
+		private:
+			mutable Node*	_node;
+			allocator_type	_alloc;
+
+			node_handle(Node* node, const allocator_type& alloc) : _node(node), _alloc(alloc)
+				{return;}
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTOR ----- */
+
+			node_handle() : _node(NULL), _alloc()
+				{return;}
+
+			node_handle(const node_handle& src) : _node(src._node), _alloc(src._alloc)
+			{
+				src._node = NULL;
+				return;
+			}
+
+			~node_handle()
+			{
+				_destroy();
+				return;
+			}
+
+
+			/* ----- OPERATOR OVERLOADS ----- */
+
+			node_handle&	operator=(const node_handle& rhs)
+			{
+				if (this != &rhs)
+				{
+					_destroy();
+					_node = rhs._node;
+					_alloc = rhs._alloc;
+					rhs._node = NULL;
+				}
+
+				return (*this);
+			}
+
+
+			/* ----- ACCESSORS ----- */
+
+			bool			empty() const
+				{return (!_node);}
+
+			allocator_type	get_allocator() const
+				{return (_alloc);}
+
+			/* --------------------------------------------------------------------------------
+			- Key of the owned element -
+				Returns a modifiable reference to the key: while the node belongs to no map, the key can be changed before the node is inserted again.
+			-------------------------------------------------------------------------------- */
+			key_type&		key() const
+				{return (const_cast<key_type&>(_node->get_value().first));}
+
+			mapped_type&	mapped() const
+				{return (_node->get_value().second);}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			void			swap(node_handle& x)
+			{
+				Node*	tmp = _node;
+
+				_node = x._node;
+				x._node = tmp;
+
+				return;
+			}
+
+		private:
+			Node*			_release() const
+			{
+				Node*	node = _node;
+
+				_node = NULL;
+
+				return (node);
+			}
+
+			void			_destroy()
+			{
+				if (!_node)
+					return;
+				_alloc.destroy(_node);
+				_alloc.deallocate(_node, 1);
+				_node = NULL;
+
+				return;
+			}
+	};
+}
+
+#endif
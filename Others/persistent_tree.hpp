@@ -0,0 +1,497 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   persistent_tree.hpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:38:15 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 09:38:15 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PERSISTENT_TREE_HPP
+# define PERSISTENT_TREE_HPP
+
+# include <cstddef>		// size_t
+# include <functional>	// std::less
+# include <memory>		// std::allocator
+
+# include "pair.hpp"
+# include "../Containers/vector.hpp"
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Persistent node -
+		Node of a persistent_tree: no parent pointer and no threads, so that a subtree can be shared by several versions of the tree. Once published, a node is never modified again, but for its reference count.
+		count is the size of its subtree; refs is the number of parents and versions pointing to it, for the owners that reclaim nodes by reference counting.
+	-------------------------------------------------------------------------------- */
+	template<class T>
+	struct	persistent_node
+	{
+		T					value;
+		persistent_node*	left;
+		persistent_node*	right;
+		size_t				count;
+		size_t				refs;
+		int					height;
+		unsigned long		version;
+
+		persistent_node(const T& val, persistent_node* l, persistent_node* r, unsigned long v) : value(val), left(l), right(r), count(1), refs(0), height(1), version(v)
+			{return;}
+	};
+
+	/* --------------------------------------------------------------------------------
+	- Persistent tree -
+		AVL tree updated by path copying: an insertion or an erasure copies the nodes from the root down to the change and returns a new root, and every subtree off that path is shared with the previous version, which stays valid and unchanged.
+		The owner reclaims the nodes in one of two ways. The nodes replaced by a copy are not freed but added to the list of retired nodes, for an owner that frees them once no reader of an older version can reach them. Or, for an owner that keeps versions around, share_created counts the new references a write made and release frees the nodes of a version no other version shares.
+		Nodes created by the current write (begin_write) are modified in place, so a rebalancing rotation only copies the nodes it did not create itself. The versions are numbered across all the trees of the same type, since trees built from one another share nodes.
+		The red-black tree cannot be used here: its nodes point to their parent and to their neighbours in order, so sharing any of them would mean copying the whole tree.
+	-------------------------------------------------------------------------------- */
+	template<class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<pair<const Key, T> > >
+	class persistent_tree
+	{
+		public:
+			typedef				pair<const Key, T>								value_type;
+			typedef				persistent_node<value_type>						node_type;
+			typedef typename	Alloc::template rebind<node_type>::other		allocator_type;
+			typedef				size_t											size_type;
+
+		private:
+			static unsigned long	_last_version;
+
+			Compare				_comp;
+			allocator_type		_alloc;
+			unsigned long		_version;
+			vector<node_type*>	_retired;
+			vector<node_type*>	_created;
+
+		public:
+			/* ----- CONSTRUCTORS AND DESTRUCTORS ----- */
+
+			explicit persistent_tree(const Compare& comp = Compare()) : _comp(comp), _alloc(), _version(0), _retired(), _created()
+				{return;}
+
+			~persistent_tree()
+				{return;}
+
+
+			/* ----- GETTERS ----- */
+
+			vector<node_type*>&		retired()
+				{return (_retired);}
+
+			static size_type		size(const node_type* n)
+				{return (n ? n->count : 0);}
+
+
+			/* ----- MEMBER FUNCTIONS ----- */
+
+			/* --------------------------------------------------------------------------------
+			- Begin write -
+				Starts a new version: the nodes created from now on belong to it and may be modified until it is published.
+			-------------------------------------------------------------------------------- */
+			void					begin_write()
+			{
+				_version = __atomic_add_fetch(&_last_version, 1, __ATOMIC_RELAXED);
+				_created.clear();
+				_retired.clear();
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Abort write -
+				Undoes a write that threw: frees the nodes it created and forgets the nodes it retired, which are still part of the published version.
+			-------------------------------------------------------------------------------- */
+			void					abort_write()
+			{
+				for (size_type i = 0; i < _created.size(); i++)
+				{
+					if (_created[i])
+						free_node(_created[i]);
+				}
+				_created.clear();
+				_retired.clear();
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Find -
+				Plain descent, one comparison per level plus one at the end.
+			-------------------------------------------------------------------------------- */
+			const node_type*		find(const node_type* n, const Key& k) const
+			{
+				const node_type*	candidate = NULL;
+
+				while (n)
+				{
+					if (_comp(n->value.first, k))
+						n = n->right;
+					else
+					{
+						candidate = n;
+						n = n->left;
+					}
+				}
+				if (candidate && !_comp(k, candidate->value.first))
+					return (candidate);
+
+				return (NULL);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Rank of lower bound -
+				Returns the number of elements of the tree rooted at n whose key is less than k, which is the index of the lower bound in sorted order.
+			-------------------------------------------------------------------------------- */
+			size_type				lower_rank(const node_type* n, const Key& k) const
+			{
+				size_type	rank = 0;
+
+				while (n)
+				{
+					if (_comp(n->value.first, k))
+					{
+						rank += size(n->left) + 1;
+						n = n->right;
+					}
+					else
+						n = n->left;
+				}
+
+				return (rank);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Rank of upper bound -
+				Returns the number of elements of the tree rooted at n whose key is not greater than k.
+			-------------------------------------------------------------------------------- */
+			size_type				upper_rank(const node_type* n, const Key& k) const
+			{
+				size_type	rank = 0;
+
+				while (n)
+				{
+					if (!_comp(k, n->value.first))
+					{
+						rank += size(n->left) + 1;
+						n = n->right;
+					}
+					else
+						n = n->left;
+				}
+
+				return (rank);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insert -
+				Returns the root of a version of n holding val. An element with an equivalent key is kept, or replaced if replace is true; inserted tells whether the size changed.
+			-------------------------------------------------------------------------------- */
+			node_type*				insert(node_type* n, const value_type& val, bool replace, bool& inserted)
+			{
+				if (!n)
+				{
+					inserted = true;
+					return (_new_node(val, NULL, NULL));
+				}
+
+				if (_comp(val.first, n->value.first))
+				{
+					node_type*	left = insert(n->left, val, replace, inserted);
+
+					if (left == n->left)
+						return (n);
+					n = _own(n);
+					n->left = left;
+				}
+				else if (_comp(n->value.first, val.first))
+				{
+					node_type*	right = insert(n->right, val, replace, inserted);
+
+					if (right == n->right)
+						return (n);
+					n = _own(n);
+					n->right = right;
+				}
+				else
+				{
+					if (!replace)
+						return (n);
+
+					node_type*	copy = _new_node(val, n->left, n->right);
+
+					copy->count = n->count;
+					copy->height = n->height;
+					_retire(n);
+
+					return (copy);
+				}
+
+				return (_balance(n));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase -
+				Returns the root of a version of n without k; erased tells whether there was an element to erase.
+				A node with two children is replaced by a copy of the smallest node of its right subtree.
+			-------------------------------------------------------------------------------- */
+			node_type*				erase(node_type* n, const Key& k, bool& erased)
+			{
+				if (!n)
+					return (NULL);
+
+				if (_comp(k, n->value.first))
+				{
+					node_type*	left = erase(n->left, k, erased);
+
+					if (left == n->left)
+						return (n);
+					n = _own(n);
+					n->left = left;
+				}
+				else if (_comp(n->value.first, k))
+				{
+					node_type*	right = erase(n->right, k, erased);
+
+					if (right == n->right)
+						return (n);
+					n = _own(n);
+					n->right = right;
+				}
+				else
+				{
+					erased = true;
+					_retire(n);
+					if (!n->left || !n->right)
+						return (n->left ? n->left : n->right);
+
+					node_type*	min = NULL;
+					node_type*	right = _erase_min(n->right, min);
+
+					n = _new_node(min->value, n->left, right);
+				}
+
+				return (_balance(n));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Retire all -
+				Adds every node of the tree rooted at n to the retired nodes, for a clear.
+			-------------------------------------------------------------------------------- */
+			void					retire_all(node_type* n)
+			{
+				if (!n)
+					return;
+
+				retire_all(n->left);
+				retire_all(n->right);
+				_retire(n);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Free node -
+				Destroys and deallocates one node, and not its children, which may still be shared.
+			-------------------------------------------------------------------------------- */
+			void					free_node(node_type* n)
+			{
+				_alloc.destroy(n);
+				_alloc.deallocate(n, 1);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Destroy -
+				Frees every node of the tree rooted at n, which must not share any node with a tree still in use.
+			-------------------------------------------------------------------------------- */
+			void					destroy(node_type* n)
+			{
+				if (!n)
+					return;
+
+				destroy(n->left);
+				destroy(n->right);
+				free_node(n);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Share created nodes -
+				Ends a write for an owner counting references: every node the write created holds a reference to each of its children, which may be new or shared with older versions.
+			-------------------------------------------------------------------------------- */
+			void					share_created()
+			{
+				for (size_type i = 0; i < _created.size(); i++)
+				{
+					acquire(_created[i]->left);
+					acquire(_created[i]->right);
+				}
+				_created.clear();
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Acquire and release -
+				Add and drop a reference to n. Dropping the last one frees n and drops its references to its children in turn, so releasing the root of a version frees every node no other version shares.
+				The counts are atomic, so that versions sharing nodes may be used and dropped by different threads.
+			-------------------------------------------------------------------------------- */
+			static void				acquire(node_type* n)
+			{
+				if (n)
+					__atomic_add_fetch(&n->refs, 1, __ATOMIC_RELAXED);
+
+				return;
+			}
+
+			void					release(node_type* n)
+			{
+				while (n && !__atomic_sub_fetch(&n->refs, 1, __ATOMIC_ACQ_REL))
+				{
+					node_type*	right = n->right;
+
+					release(n->left);
+					free_node(n);
+					n = right;
+				}
+
+				return;
+			}
+
+		private:
+			node_type*				_new_node(const value_type& val, node_type* left, node_type* right)
+			{
+				_created.push_back(NULL);
+
+				node_type*	n = _alloc.allocate(1);
+
+				try
+				{
+					_alloc.construct(n, node_type(val, left, right, _version));
+				}
+				catch (...)
+				{
+					_alloc.deallocate(n, 1);
+					throw;
+				}
+				_created.back() = n;
+
+				return (n);
+			}
+
+			void					_retire(node_type* n)
+			{
+				_retired.push_back(n);
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Own node -
+				Returns n if it was created by the current write, or else a copy of it, retiring n.
+			-------------------------------------------------------------------------------- */
+			node_type*				_own(node_type* n)
+			{
+				if (n->version == _version)
+					return (n);
+
+				node_type*	copy = _new_node(n->value, n->left, n->right);
+
+				copy->count = n->count;
+				copy->height = n->height;
+				_retire(n);
+
+				return (copy);
+			}
+
+			static int				_height(const node_type* n)
+				{return (n ? n->height : 0);}
+
+			static void				_update(node_type* n)
+			{
+				int	left = _height(n->left);
+				int	right = _height(n->right);
+
+				n->height = 1 + (left > right ? left : right);
+				n->count = 1 + size(n->left) + size(n->right);
+
+				return;
+			}
+
+			node_type*				_rotate_left(node_type* n)
+			{
+				node_type*	right = _own(n->right);
+
+				n->right = right->left;
+				_update(n);
+				right->left = n;
+				_update(right);
+
+				return (right);
+			}
+
+			node_type*				_rotate_right(node_type* n)
+			{
+				node_type*	left = _own(n->left);
+
+				n->left = left->right;
+				_update(n);
+				left->right = n;
+				_update(left);
+
+				return (left);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Balance -
+				Restores the AVL invariant at n, a node of the current write whose subtrees differ in height by at most two, with a single or a double rotation.
+			-------------------------------------------------------------------------------- */
+			node_type*				_balance(node_type* n)
+			{
+				int	diff = _height(n->left) - _height(n->right);
+
+				if (diff > 1)
+				{
+					if (_height(n->left->left) < _height(n->left->right))
+						n->left = _rotate_left(_own(n->left));
+					return (_rotate_right(n));
+				}
+				if (diff < -1)
+				{
+					if (_height(n->right->right) < _height(n->right->left))
+						n->right = _rotate_right(_own(n->right));
+					return (_rotate_left(n));
+				}
+				_update(n);
+
+				return (n);
+			}
+
+			node_type*				_erase_min(node_type* n, node_type*& min)
+			{
+				if (!n->left)
+				{
+					min = n;
+					_retire(n);
+					return (n->right);
+				}
+
+				node_type*	left = _erase_min(n->left, min);
+
+				n = _own(n);
+				n->left = left;
+
+				return (_balance(n));
+			}
+	};
+
+	template<class Key, class T, class Compare, class Alloc>
+	unsigned long	persistent_tree<Key, T, Compare, Alloc>::_last_version = 0;
+}
+
+#endif
@@ -0,0 +1,33 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   prefetch.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:25:42 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 09:25:42 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PREFETCH_HPP
+# define PREFETCH_HPP
+
+/* --------------------------------------------------------------------------------
+- Prefetch -
+	Asks the processor to start loading the cache line holding addr for reading, without waiting for it and without faulting if addr is not mapped.
+	Only a hint: expands to nothing on compilers without __builtin_prefetch.
+-------------------------------------------------------------------------------- */
+# ifdef __GNUC__
+#  define FT_PREFETCH(addr)	__builtin_prefetch(addr)
+# else
+#  define FT_PREFETCH(addr)	((void)(addr))
+# endif
+
+/* --------------------------------------------------------------------------------
+- Cache line size -
+	In bytes, as on every current x86-64 and most ARM processors.
+-------------------------------------------------------------------------------- */
+# define FT_CACHE_LINE		64
+
+#endif
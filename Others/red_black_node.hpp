@@ -6,60 +6,66 @@
 /*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/07/13 13:56:12 by ldelmas           #+#    #+#             */
-/*   Updated: 2022/12/19 15:24:22 by hcremers         ###   ########.fr       */
+/*   Updated: 2026/10/19 11:14:50 by hcremers         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef RED_BLACK_NODE_HPP
 # define RED_BLACK_NODE_HPP
 
-# include <cstddef>	// size_t
+# include <cstddef>	// size_t, ptrdiff_t
 # include <memory>	// std::allocator
 
+# include "aggregate.hpp"
+
 # define RED	true
 # define BLACK	false
 
 namespace ft
 {
-	template<class T, class Compare>
+	template<class T, class Compare, class Aggregate = no_aggregate<T> >
 	class red_black_node
 	{
 		public:
-			typedef T												value_type;
-			typedef ft::red_black_node<value_type, Compare>			node_type;
-			typedef ft::red_black_node<const value_type, Compare>	node_const_type;
-			typedef std::allocator<value_type>						alloc_type;
-			typedef Compare											value_compare;
-			typedef node_type*										pointer;
-			typedef const node_type*								const_pointer;
-			typedef size_t											size_type;
+			typedef T															value_type;
+			typedef ft::red_black_node<value_type, Compare, Aggregate>			node_type;
+			typedef ft::red_black_node<const value_type, Compare, Aggregate>	node_const_type;
+			typedef std::allocator<value_type>									alloc_type;
+			typedef Compare														value_compare;
+			typedef typename Aggregate::result_type								aggregate_type;
+			typedef node_type*													pointer;
+			typedef const node_type*											const_pointer;
+			typedef size_t														size_type;
 
 		private:
 			value_type				_content;
 			bool					_color;
+			aggregate_type			_aggregate;
+			size_type				_count;
 			pointer					_left;
 			pointer					_right;
 			pointer					_parent;
 			pointer					_end;
-			const value_compare&	_comp;
+			pointer					_next;
+			pointer					_prev;
 
 
 		public:
 			/* ----- CONSTRUCTORS AND DESTRUCTOR ----- */
 
-			explicit red_black_node(const pointer ptr = NULL, const value_compare& comp = value_compare()) : _content(), _color(RED), _left(NULL), _right(NULL), _parent(NULL), _end(ptr), _comp(comp)
+			explicit red_black_node(const pointer ptr = NULL) : _content(), _color(RED), _aggregate(), _count(0), _left(NULL), _right(NULL), _parent(NULL), _end(ptr), _next(NULL), _prev(NULL)
 				{return;}
 
-			red_black_node(const value_type& val, const pointer ptr = NULL, const value_compare& comp = value_compare()) : _content(val), _color(RED), _left(NULL), _right(NULL), _parent(NULL), _end(ptr), _comp(comp)
+			red_black_node(const value_type& val, const pointer ptr = NULL) : _content(val), _color(RED), _aggregate(), _count(1), _left(NULL), _right(NULL), _parent(NULL), _end(ptr), _next(NULL), _prev(NULL)
 				{return;}
 
-			red_black_node(const pointer parent, const pointer ptr = NULL, const value_compare& comp = value_compare()) : _content(), _color(BLACK), _left(NULL), _right(NULL), _parent(parent), _end(ptr), _comp(comp)
+			red_black_node(const pointer parent, const pointer ptr) : _content(), _color(BLACK), _aggregate(), _count(0), _left(NULL), _right(NULL), _parent(parent), _end(ptr), _next(NULL), _prev(NULL)
 				{return;}
 
-			red_black_node(const value_type& val, const pointer left, const pointer right, const pointer parent = NULL, const pointer end = NULL, const value_compare &comp = value_compare()) : _content(val), _color(RED), _left(left), _right(right), _parent(parent), _end(end), _comp(comp)
+			red_black_node(const value_type& val, const pointer left, const pointer right, const pointer parent = NULL, const pointer end = NULL) : _content(val), _color(RED), _aggregate(), _count(1), _left(left), _right(right), _parent(parent), _end(end), _next(NULL), _prev(NULL)
 				{return;}
 
-			red_black_node(const node_type &src) : _content(src._content), _color(src._color), _left(src._left), _right(src._right), _parent(src._parent), _end(src._end), _comp(src._comp)
+			red_black_node(const node_type &src) : _content(src._content), _color(src._color), _aggregate(src._aggregate), _count(src._count), _left(src._left), _right(src._right), _parent(src._parent), _end(src._end), _next(src._next), _prev(src._prev)
 				{return;}
 
 			~red_black_node()
@@ -71,6 +77,9 @@ namespace ft
 			value_type&		get_value()
 				{return (_content);}
 
+			const value_type&	get_value() const
+				{return (_content);}
+
 			pointer			get_left() const
 				{return (_left);}
 
@@ -89,6 +98,12 @@ namespace ft
 			bool			get_color() const
 				{return (_color);}
 
+			size_type		get_count() const
+				{return (_count);}
+
+			const aggregate_type&	get_aggregate() const
+				{return (_aggregate);}
+
 			pointer			get_uncle() const
 			{
 				pointer	parent = _parent;
@@ -138,16 +153,61 @@ namespace ft
 				return;
 			}
 
+			void			set_prev(pointer node)
+			{
+				_prev = node;
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Thread two nodes -
+				Makes next the in-order successor of prev in the threaded list of the tree.
+			-------------------------------------------------------------------------------- */
+			static void		thread(pointer prev, pointer next)
+			{
+				prev->_next = next;
+				next->_prev = prev;
+				return;
+			}
+
 			void			set_color(bool color)
 			{
 				_color = color;
 				return;
 			}
 
+			void			set_aggregate(const aggregate_type& aggregate)
+			{
+				_aggregate = aggregate;
+				return;
+			}
+
+			void			set_count(size_type n)
+			{
+				_count = n;
+				return;
+			}
+
 
 			/* ----- UTILS ----- */
 
+			/* --------------------------------------------------------------------------------
+			- In-order successor and predecessor -
+				The tree keeps its elements in a circular doubly linked list through the end node, updated on every insertion and removal, so that stepping to the next or previous element is a single pointer load (which can also be prefetched) instead of a climb up the parent pointers.
+				Stepping past the last element returns the end node, and stepping from the end node returns the first element.
+			-------------------------------------------------------------------------------- */
 			pointer			iterate() const
+				{return (_next);}
+
+			pointer			reverse_iterate() const
+				{return (_prev);}
+
+			/* --------------------------------------------------------------------------------
+			- Structural successor and predecessor -
+				Same as iterate and reverse_iterate, but found by walking the tree itself; used to rebuild the threaded list where a bulk operation moved nodes without it.
+				Only the root's end pointer is kept up to date by the tree, so that whole subtrees can be moved from one tree to another without visiting their nodes: stepping past the last (or before the first) element returns the end pointer of the root reached on the way up.
+			-------------------------------------------------------------------------------- */
+			pointer			successor() const
 			{
 				const node_type*	k = this;
 				node_type*			right = k->get_right();
@@ -165,12 +225,12 @@ namespace ft
 				if (parent && parent->get_left() == k)
 					return (parent);
 
-				return (_end);
+				return (k->_end);
 			}
 
-			pointer			reverse_iterate() const
+			pointer			predecessor() const
 			{
-				if (!_parent && !_left && !_right)
+				if (!_count)
 					return (get_biggest(_end));
 
 				const node_type*	k = this;
@@ -189,12 +249,89 @@ namespace ft
 				if (parent)
 					return (parent);
 
-				return (_end);
+				return (k->_end);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Position in the tree -
+				Returns the number of elements that come before this node, using the subtree counts of its left siblings on the way up to the root.
+				The end node (the only node with a count of 0) is linked to the root and ranks after every element.
+			-------------------------------------------------------------------------------- */
+			size_type		rank() const
+			{
+				if (!_count)
+					return (count(_end));
+
+				const node_type*	k = this;
+				size_type			r = count(_left);
+
+				while (k->_parent)
+				{
+					if (k->_parent->_right == k)
+						r += count(k->_parent->_left) + 1;
+					k = k->_parent;
+				}
+
+				return (r);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Move by n positions -
+				Returns the node n positions away from this one (n may be negative), or the end node when the target is one past the last element.
+				Runs in O(log n): the node is ranked on the way up to the root, then the target is selected on the way back down.
+			-------------------------------------------------------------------------------- */
+			pointer			advance(ptrdiff_t n) const
+			{
+				pointer	root = get_root();
+
+				if (!n || !root)
+					return (const_cast<pointer>(this));
+
+				size_type	target = rank() + n;
+				pointer		found = select(root, target);
+
+				return (found ? found : root->_end);
+			}
+
+			pointer			get_root() const
+			{
+				if (!_count)
+					return (_end);
+
+				const node_type*	k = this;
+
+				while (k->_parent)
+					k = k->_parent;
+
+				return (const_cast<pointer>(k));
 			}
 
 
 			/* ----- STATIC UTILS ----- */
 
+			static size_type	count(const_pointer ptr)
+				{return (ptr ? ptr->_count : 0);}
+
+			static pointer	select(pointer ptr, size_type i)
+			{
+				while (ptr)
+				{
+					size_type	left = count(ptr->_left);
+
+					if (i == left)
+						return (ptr);
+					else if (i < left)
+						ptr = ptr->_left;
+					else
+					{
+						i -= left + 1;
+						ptr = ptr->_right;
+					}
+				}
+
+				return (NULL);
+			}
+
 			static pointer	get_smallest(pointer ptr)
 			{
 				while (ptr && ptr->_left)
@@ -214,29 +351,8 @@ namespace ft
 
 			/* ----- OPERATORS ----- */
 
-			operator		red_black_node<const T, Compare>() const
-				{return (red_black_node<const T, Compare>(*this));}
-
-
-			/* ----- RELATIONAL OPERATORS ----- */
-
-			bool			operator==(const node_type& right) const
-				{return (!_comp(_content, right._content) && !_comp(right._content, _content));}
-
-			bool			operator!=(const node_type& right) const
-				{return (!(*this == right));}
-
-			bool			operator<(const node_type& right) const
-				{return (_comp(_content, right._content));}
-
-			bool			operator<=(const node_type& right) const
-				{return (!(right < *this));}
-
-			bool			operator>(const node_type& right) const
-				{return (right < *this);}
-
-			bool			operator>=(const node_type& right) const
-				{return (!(*this < right));}
+			operator		red_black_node<const T, Compare, Aggregate>() const
+				{return (red_black_node<const T, Compare, Aggregate>(*this));}
 	};
 }
 
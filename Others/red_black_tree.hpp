@@ -6,7 +6,7 @@
 /*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/07/12 16:02:21 by ldelmas           #+#    #+#             */
-/*   Updated: 2023/01/03 12:27:35 by hcremers         ###   ########.fr       */
+/*   Updated: 2026/10/19 11:16:52 by hcremers         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -21,50 +21,73 @@
 # include <memory>		// std::allocator
 
 # include "pair.hpp"
+# include "prefetch.hpp"
 # include "red_black_node.hpp"
 
 namespace ft
 {
-	template<class T, class Alloc = std::allocator<T>, class Compare = std::less<T> >
+	template<class T, class Alloc = std::allocator<T>, class Compare = std::less<T>, class Aggregate = no_aggregate<T> >
 	class red_black_tree
 	{
 		public:
-			typedef 			T											value_type;
-			typedef 			red_black_node<value_type, Compare>			node_type;
-			typedef 			red_black_node<const value_type, Compare>	node_const_type;
-			typedef typename	Alloc::template rebind<node_type>::other	allocator_type;
-			typedef 			Compare										value_compare;
-			typedef 			red_black_tree<T, Alloc, Compare>			tree_type;
-			typedef	typename	allocator_type::reference					reference;
-			typedef typename	allocator_type::const_reference				const_reference;
-			typedef typename	allocator_type::pointer						pointer;
-			typedef typename	allocator_type::const_pointer				const_pointer;
-			typedef 			size_t										size_type;
+			typedef 			T														value_type;
+			typedef 			red_black_node<value_type, Compare, Aggregate>			node_type;
+			typedef 			red_black_node<const value_type, Compare, Aggregate>	node_const_type;
+			typedef typename	Alloc::template rebind<node_type>::other				allocator_type;
+			typedef 			Compare													value_compare;
+			typedef 			Aggregate												aggregate_policy;
+			typedef typename	Aggregate::result_type									aggregate_type;
+			typedef 			red_black_tree<T, Alloc, Compare, Aggregate>			tree_type;
+			typedef	typename	allocator_type::reference								reference;
+			typedef typename	allocator_type::const_reference							const_reference;
+			typedef typename	allocator_type::pointer									pointer;
+			typedef typename	allocator_type::const_pointer							const_pointer;
+			typedef 			size_t													size_type;
 
 		private:
-			node_type*		_root;
-			node_type*		_end;
-			allocator_type	_node_alloc;
-			value_compare&	_comp;
+			/* --------------------------------------------------------------------------------
+			- Batch search task -
+				A node of the current level of a batch search, with the last node where the descent went left (the lower bound so far) and the slice [lo, hi) of the sorted probes that reach it.
+			-------------------------------------------------------------------------------- */
+			struct	_batch_task
+			{
+				node_type*	node;
+				node_type*	bound;
+				size_type	lo;
+				size_type	hi;
+
+				_batch_task(node_type* n, node_type* b, size_type l, size_type h) : node(n), bound(b), lo(l), hi(h)
+					{return;}
+			};
+
+			typedef typename	Alloc::template rebind<_batch_task>::other				batch_allocator;
+
+			node_type*			_root;
+			node_type*			_end;
+			allocator_type		_node_alloc;
+			value_compare&		_comp;
+			aggregate_policy	_aggr;
 
 		public:
 			/* ----- CONSTRUCTORS AND DESTRUCTORS ----- */
 
-			explicit red_black_tree(value_compare& comp = value_compare()) : _root(NULL), _node_alloc(), _comp(comp)
+			explicit red_black_tree(value_compare& comp = value_compare(), const aggregate_policy& aggr = aggregate_policy()) : _root(NULL), _node_alloc(), _comp(comp), _aggr(aggr)
 			{
 				_end = _node_alloc.allocate(1);
-				_node_alloc.construct(_end, node_type(_root, _comp));
+				_node_alloc.construct(_end, node_type(_root));
+				node_type::thread(_end, _end);
 
 				return;
 			}
 
-			red_black_tree(const red_black_tree& src) :  _root(NULL), _node_alloc(src._node_alloc), _comp(src._comp)
+			red_black_tree(const red_black_tree& src) :  _root(NULL), _node_alloc(src._node_alloc), _comp(src._comp), _aggr(src._aggr)
 			{
 				_end = _node_alloc.allocate(1);
-				_node_alloc.construct(_end, node_type(_root, _comp));
+				_node_alloc.construct(_end, node_type(_root));
+				node_type::thread(_end, _end);
 
-				for (node_type* node = node_type::get_smallest(src._root); node != src._end; node = node->iterate())
-					insert(node->get_value());
+				for (node_type* node = node_type::get_smallest(src._root); node != src._end && node; node = node->iterate())
+					insert_equal(node->get_value());
 
 				return;
 			}
@@ -83,9 +106,10 @@ namespace ft
 			red_black_tree&			operator=(const red_black_tree& right)
 			{
 				clear();
+				_aggr = right._aggr;
 
 				for (node_type* node = node_type::get_smallest(right._root); node != right._end && node; node = node->iterate())
-					insert(node->get_value());
+					insert_equal(node->get_value());
 
 				return (*this);
 			}
@@ -105,6 +129,12 @@ namespace ft
 			node_const_type*		get_end() const
 				{return (reinterpret_cast<node_const_type*>(_end));}
 
+			node_type*				get_begin()
+				{return (_end->iterate());}
+
+			node_const_type*		get_begin() const
+				{return (reinterpret_cast<node_const_type*>(_end->iterate()));}
+
 			const value_compare&	get_comp() const
 				{return (_comp);}
 
@@ -116,6 +146,11 @@ namespace ft
 			{
 				_root = ptr;
 				_end->set_end(ptr);
+				if (ptr)
+				{
+					ptr->set_parent(NULL);
+					ptr->set_end(_end);
+				}
 
 				return;
 			}
@@ -149,52 +184,201 @@ namespace ft
 			node_const_type*		search_upper_bound(const value_type& val) const
 				{return (reinterpret_cast<node_const_type*>(_search_upper_bound(val)));}
 
-			pair<node_type*, bool>	insert(node_type& node, node_type* z)
+			/* --------------------------------------------------------------------------------
+			- Batch search -
+				Looks up the n values pointed to by probes, sorted in ascending order, and stores the node equivalent to probes[i] (or the end node) in found[i].
+				The tree is walked once, level by level: each node visited receives the slice of the probes whose descent goes through it, and splits it with a binary search into the probes that go left and those that go right, so the path shared by several probes is only walked once.
+				All the nodes of the next level are prefetched while the current level is processed, so the descents of independent probes overlap their cache misses instead of waiting for them one after the other.
+			-------------------------------------------------------------------------------- */
+			void					search_batch(const value_type* const* probes, size_type n, node_type** found) const
 			{
-				node_type*	previous = NULL;
+				if (!n)
+					return;
+
+				batch_allocator	alloc;
+				_batch_task*	level = alloc.allocate(n);
+				_batch_task*	next = alloc.allocate(n);
+				size_type		count = 1;
+
+				level[0] = _batch_task(_root, _end, 0, n);
+				while (count)
+				{
+					size_type	next_count = 0;
+
+					for (size_type i = 0; i < count; i++)
+					{
+						_batch_task&	task = level[i];
+
+						if (!task.node)
+						{
+							for (size_type j = task.lo; j < task.hi; j++)
+								found[j] = (task.bound != _end && !_comp(*probes[j], task.bound->get_value()) ? task.bound : _end);
+							continue;
+						}
+
+						size_type	lo = task.lo;
+						size_type	hi = task.hi;
+
+						while (lo < hi)
+						{
+							size_type	mid = lo + (hi - lo) / 2;
+
+							if (_comp(task.node->get_value(), *probes[mid]))
+								hi = mid;
+							else
+								lo = mid + 1;
+						}
+						if (task.lo < lo)
+						{
+							FT_PREFETCH(task.node->get_left());
+							next[next_count++] = _batch_task(task.node->get_left(), task.node, task.lo, lo);
+						}
+						if (lo < task.hi)
+						{
+							FT_PREFETCH(task.node->get_right());
+							next[next_count++] = _batch_task(task.node->get_right(), task.bound, lo, task.hi);
+						}
+					}
+
+					_batch_task*	tmp = level;
+
+					level = next;
+					next = tmp;
+					count = next_count;
+				}
+				alloc.deallocate(level, n);
+				alloc.deallocate(next, n);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Range aggregate -
+				Returns the aggregate of every value in [lo, hi), in order, in O(log n).
+				The descent stops at the first node inside the range; below it, the left boundary path adds whole right subtrees and the right boundary path adds whole left subtrees.
+			-------------------------------------------------------------------------------- */
+			aggregate_type			aggregate(const value_type& lo, const value_type& hi) const
+			{
+				node_type*	z = _root;
 
 				while (z)
 				{
-					previous = z;
-					if (node == *z)
-						return (pair<node_type*, bool>(z, false));
-					if (node < *z)
+					if (_comp(z->get_value(), lo))
+						z = z->get_right();
+					else if (!_comp(z->get_value(), hi))
 						z = z->get_left();
 					else
-						z = z->get_right();
+						break;
 				}
 
-				node_type* new_node = _node_alloc.allocate(1);
+				if (!z)
+					return (_aggr.identity());
 
-				_node_alloc.construct(new_node, node_type(node.get_value(), NULL, NULL, previous, _end, _comp));
+				aggregate_type	res = _aggr.combine(_aggregate_from(z->get_left(), lo), _aggr(z->get_value()));
 
-				if (!previous)
-					set_root(new_node);
-				else if (node < *previous)
-					previous->set_left(new_node);
-				else
-					previous->set_right(new_node);
+				return (_aggr.combine(res, _aggregate_until(z->get_right(), hi)));
+			}
 
-				_fix_insertion(new_node);
+			aggregate_type			aggregate() const
+				{return (_aggregate_of(_root));}
 
-				return (pair<node_type*, bool>(new_node, true));
+			/* --------------------------------------------------------------------------------
+			- Refresh aggregates -
+				Recomputes the aggregates from node up to the root, after its value was changed in place.
+			-------------------------------------------------------------------------------- */
+			void					refresh(node_type* node)
+			{
+				_update_path(node);
+
+				return;
 			}
 
 			pair<node_type*, bool>	insert(const value_type& value)
 			{
-				node_type	tmp(value, _end, _comp);
+				pair<node_type*, bool>	pos = _find_insert_position(value, _root);
 
-				return (insert(tmp, _root));
+				if (!pos.second)
+					return (pos);
+
+				return (pair<node_type*, bool>(_attach(pos.first, pos.first && _comp(value, pos.first->get_value()), value), true));
 			}
 
 			pair<node_type*, bool>	insert(const value_type& val, node_type* hint)
 			{
-				node_type	tmp(val, _end, _comp);
+				if (hint != _end && _comp(hint->get_value(), val))
+				{
+					node_type*	next = hint->iterate();
 
-				if (*hint < tmp && *(hint->iterate()) > tmp)
-					return (insert(tmp, hint));
-				else
-					return (insert(tmp, _root));
+					if (next == _end || _comp(val, next->get_value()))
+					{
+						pair<node_type*, bool>	pos = _find_insert_position(val, hint);
+
+						return (pair<node_type*, bool>(_attach(pos.first, _comp(val, pos.first->get_value()), val), true));
+					}
+				}
+
+				return (insert(val));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Node insertion -
+				Links an existing node, detached from another tree of the same type, instead of allocating a new one.
+				When an equivalent element is already in the tree, nothing is linked and that element is returned with false.
+			-------------------------------------------------------------------------------- */
+			pair<node_type*, bool>	insert_node(node_type* node)
+			{
+				pair<node_type*, bool>	pos = _find_insert_position(node->get_value(), _root);
+
+				if (!pos.second)
+					return (pos);
+
+				_link(pos.first, pos.first && _comp(node->get_value(), pos.first->get_value()), node);
+
+				return (pair<node_type*, bool>(node, true));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Insertion allowing duplicates -
+				Inserts val after every element equivalent to it, so that equal elements keep their insertion order (multiset and multimap).
+				Only one comparison is made per level since there is no equality to detect.
+			-------------------------------------------------------------------------------- */
+			node_type*				insert_equal(const value_type& val)
+			{
+				node_type*	z = _root;
+				node_type*	previous = NULL;
+				bool		is_left = false;
+
+				while (z)
+				{
+					previous = z;
+					is_left = _comp(val, z->get_value());
+					z = (is_left ? z->get_left() : z->get_right());
+				}
+
+				return (_attach(previous, is_left, val));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Hinted insertion allowing duplicates -
+				Inserts val right before hint when that keeps the tree sorted, in amortized O(1): the new node becomes either the left child of hint or the right child of its predecessor, one of which is always free.
+				Otherwise falls back to insert_equal.
+			-------------------------------------------------------------------------------- */
+			node_type*				insert_equal(const value_type& val, node_type* hint)
+			{
+				node_type*	prev = hint->reverse_iterate();
+
+				if (prev == _end)
+					prev = NULL;
+
+				if ((hint != _end && _comp(hint->get_value(), val)) || (prev && _comp(val, prev->get_value())))
+					return (insert_equal(val));
+
+				if (hint != _end && !hint->get_left())
+					return (_attach(hint, true, val));
+				if (prev)
+					return (_attach(prev, false, val));
+
+				return (insert_equal(val));
 			}
 
 			bool					erase(const value_type& val)
@@ -205,24 +389,96 @@ namespace ft
 			}
 
 			bool					erase(node_type* k)
+			{
+				if (k == _end)
+					return (false);
+
+				unlink(k);
+				_node_alloc.destroy(k);
+				_node_alloc.deallocate(k, 1);
+
+				return (true);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Erase a range -
+				Destroys the elements from first up to, but not including, last (which may be the end node) and returns how many were erased.
+				A range shorter than the black height is unlinked node by node. A longer one is cut out by rank: the tree is split before first and at last, which is taken out as the pivot, the middle part is destroyed in one walk and the outer parts are joined back, in O(k + log n) with no key comparison.
+				The whole tree is simply cleared.
+			-------------------------------------------------------------------------------- */
+			size_type				erase(node_type* first, node_type* last)
+			{
+				if (first == last)
+					return (0);
+
+				size_type	total = node_type::count(_root);
+				size_type	lo = first->rank();
+				size_type	n = (last == _end ? total : last->rank()) - lo;
+				size_type	bh = _black_height(_root);
+
+				if (n == total)
+				{
+					clear();
+					return (n);
+				}
+
+				if (n < bh)
+				{
+					while (first != last)
+					{
+						node_type*	next = first->iterate();
+
+						erase(first);
+						first = next;
+					}
+					return (n);
+				}
+
+				node_type*	before = first->reverse_iterate();
+				node_type*	pivot = NULL;
+				node_type*	head;
+				node_type*	tail;
+				node_type*	l;
+				node_type*	r;
+				size_type	head_h;
+				size_type	tail_h;
+				size_type	lh;
+				size_type	rh;
+
+				_split_rank(_root, bh, lo + n, head, head_h, tail, tail_h, (last == _end ? NULL : &pivot));
+				_split_rank(head, head_h, lo, l, lh, r, rh, NULL);
+				_destroy(r);
+
+				if (!pivot)
+					set_root(l);
+				else
+					set_root(_join(l, lh, pivot, tail, tail_h).first);
+				node_type::thread(before, last);
+
+				return (n);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Unlink a node -
+				Removes k from the tree and rebalances it, like erase, but leaves the node allocated so that it can be linked into another tree with insert_node.
+			-------------------------------------------------------------------------------- */
+			void					unlink(node_type* k)
 			{
 				node_type*				left = k->get_left();
 				node_type*				right = k->get_right();
 				pair<node_type*, bool>	check = pair<node_type*, bool>(k, true);
 				bool					color = k->get_color();
 
-				if (k == _end)
-					return (false);
-
+				node_type::thread(k->reverse_iterate(), k->iterate());
 				if (!right)
 				{
 					check = _create_child(k, true);
-					_replace_node(k->get_parent(), k, check.first);
+					_transplant_node(k->get_parent(), k, check.first);
 				}
 				else if (!left)
 				{
 					check = _create_child(k, false);
-					_replace_node(k->get_parent(), k, check.first);
+					_transplant_node(k->get_parent(), k, check.first);
 				}
 				else
 				{
@@ -237,12 +493,14 @@ namespace ft
 						smallest->set_right(right);
 						smallest->get_right()->set_parent(smallest);
 					}
-					_replace_node(k->get_parent(), k, smallest);
+					smallest->set_color(k->get_color());
+					_transplant_node(k->get_parent(), k, smallest);
 					smallest->set_left(left);
 					smallest->get_left()->set_parent(smallest);
-					smallest->set_color(k->get_color());
 				}
 
+				_update_path(check.first->get_parent());
+
 				if (color == BLACK)
 					_fix_deletion(check.first);
 
@@ -255,22 +513,119 @@ namespace ft
 					_node_alloc.destroy(check.first);
 					_node_alloc.deallocate(check.first, 1);
 				}
+				k->set_left(NULL);
+				k->set_right(NULL);
+				k->set_parent(NULL);
 
-				return (true);
+				return;
 			}
 
-			void					clear()
+			/* --------------------------------------------------------------------------------
+			- Split -
+				Moves every element that is not less than val into right, which must be empty, in O(log n) and without reallocating any node.
+				The tree is cut along the search path for val and the pieces hanging off that path are joined back together, from the bottom up, into the two halves.
+			-------------------------------------------------------------------------------- */
+			void					split(const value_type& val, tree_type& right)
 			{
-				node_type*	nd = node_type::get_smallest(_root);
+				node_type*	l;
+				node_type*	r;
+				size_type	lh;
+				size_type	rh;
 
-				while (nd && nd != _end)
-				{
-					node_type*	tmp = nd->iterate();
+				_split(_root, _black_height(_root), val, l, lh, r, rh, NULL);
+				_split_halves(l, r, right);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Split before a node -
+				Moves pos, which may be the end node, and every element after it into right, which must be empty.
+				The tree is cut by the rank of pos, so no element is compared and the caller can find pos with whatever key it has.
+			-------------------------------------------------------------------------------- */
+			void					split(node_type* pos, tree_type& right)
+			{
+				node_type*	l;
+				node_type*	r;
+				size_type	lh;
+				size_type	rh;
+
+				if (pos == _end)
+					return;
 
-					erase(nd);
-					nd = tmp;
+				_split_rank(_root, _black_height(_root), pos->rank(), l, lh, r, rh, NULL);
+				_split_halves(l, r, right);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Join -
+				Appends every element of right, which must all come after the elements of this tree, and leaves right empty.
+				The smallest element of right is unlinked and used as the pivot where the shorter tree is hung on the spine of the taller one, in O(log n).
+			-------------------------------------------------------------------------------- */
+			void					join(tree_type& right)
+			{
+				if (!right._root)
+					return;
+
+				if (!_root)
+				{
+					set_root(right._root);
+					right.set_root(NULL);
+					_splice_threads(right);
+					return;
 				}
-				_root = NULL;
+
+				node_type*	pivot = node_type::get_smallest(right._root);
+
+				right.unlink(pivot);
+				node_type::thread(_end->reverse_iterate(), pivot);
+				node_type::thread(pivot, _end);
+
+				pair<node_type*, size_type>	res = _join(_root, _black_height(_root), pivot, right._root, _black_height(right._root));
+
+				set_root(res.first);
+				right.set_root(NULL);
+				_splice_threads(right);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Merge -
+				Moves into this tree every element of x that has no equivalent here; the others stay in x. No node is reallocated.
+				This is a join-based union: x is taken apart from its root down, this tree is split around each root of x and the halves are merged recursively then joined back with that root as pivot.
+				It runs in O(m log(n / m + 1)) for m <= n elements, which is linear for trees of similar sizes and close to O(m log n) when x is much smaller.
+				The threaded list is then repaired around the nodes that came from x only.
+			-------------------------------------------------------------------------------- */
+			void					merge(tree_type& x)
+			{
+				node_type*	other = x._root;
+				node_type*	moved = NULL;
+
+				if (!other || &x == this)
+					return;
+
+				x.set_root(NULL);
+				node_type::thread(x._end, x._end);
+
+				pair<node_type*, size_type>	res = _union(_root, _black_height(_root), other, _black_height(other), x, moved);
+
+				set_root(res.first);
+				_rethread(moved);
+
+				return;
+			}
+
+			size_type				size() const
+				{return (node_type::count(_root));}
+
+			void					clear()
+			{
+				_destroy(_root);
+				set_root(NULL);
+				node_type::thread(_end, _end);
 
 				return;
 			}
@@ -279,7 +634,7 @@ namespace ft
 			{
 				node_type*	new_node = _node_alloc.allocate(1);
 
-				_node_alloc.construct(new_node, node_type(content, left, right, parent, _end, _comp));
+				_node_alloc.construct(new_node, node_type(content, left, right, parent, _end));
 
 				return (new_node);
 			}
@@ -298,39 +653,414 @@ namespace ft
 			}
 
 		private:
-			pair<node_type*, bool>	_create_child(node_type* parent, bool is_left)
+			/* --------------------------------------------------------------------------------
+			- Unique insertion position -
+				Descends from z with one comparison per level, remembering the last node where the search went right; only that node can be equivalent to val, which costs a single extra comparison at the bottom.
+				Returns the future parent of val with true, or the equivalent element with false.
+			-------------------------------------------------------------------------------- */
+			pair<node_type*, bool>	_find_insert_position(const value_type& val, node_type* z) const
 			{
-				node_type*	child = (is_left ? parent->get_left() : parent->get_right());
+				node_type*	previous = NULL;
+				node_type*	candidate = NULL;
 
-				if (child)
-					return (pair<node_type*, bool>(child, false));
+				while (z)
+				{
+					previous = z;
+					if (_comp(val, z->get_value()))
+						z = z->get_left();
+					else
+					{
+						candidate = z;
+						z = z->get_right();
+					}
+				}
 
+				if (candidate && !_comp(candidate->get_value(), val))
+					return (pair<node_type*, bool>(candidate, false));
+
+				return (pair<node_type*, bool>(previous, true));
+			}
+
+			node_type*				_attach(node_type* parent, bool is_left, const value_type& val)
+			{
 				node_type*	new_node = _node_alloc.allocate(1);
 
-				_node_alloc.construct(new_node, node_type(value_type(), NULL, NULL, parent, _end, _comp));
-				new_node->set_color(BLACK);
-				is_left ? parent->set_left(new_node) : parent->set_right(new_node);
+				_node_alloc.construct(new_node, node_type(val, NULL, NULL, parent, _end));
+				_link(parent, is_left, new_node);
 
-				return (pair<node_type*, bool>(new_node, true));
+				return (new_node);
 			}
 
-			void					_replace_node(node_type* parent, node_type* k, node_type* replacer)
+			void					_link(node_type* parent, bool is_left, node_type* node)
 			{
+				node->set_left(NULL);
+				node->set_right(NULL);
+				node->set_parent(parent);
+				node->set_color(RED);
+
 				if (!parent)
-					set_root(replacer);
-				else if (k == parent->get_left())
-					parent->set_left(replacer);
+				{
+					set_root(node);
+					node_type::thread(_end, node);
+					node_type::thread(node, _end);
+				}
+				else if (is_left)
+				{
+					parent->set_left(node);
+					node_type::thread(parent->reverse_iterate(), node);
+					node_type::thread(node, parent);
+				}
 				else
-					parent->set_right(replacer);
+				{
+					parent->set_right(node);
+					node_type::thread(node, parent->iterate());
+					node_type::thread(parent, node);
+				}
 
-				if (replacer)
-					replacer->set_parent(parent);
+				_update_path(node);
+				_fix_insertion(node);
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Black height -
+				Number of black nodes on any path from k down to a leaf, k included.
+			-------------------------------------------------------------------------------- */
+			static size_type		_black_height(node_type* k)
+			{
+				size_type	h = 0;
+
+				for (; k; k = k->get_left())
+					if (k->is_black())
+						h++;
+
+				return (h);
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Join two detached subtrees around a pivot -
+				Every element of left comes before pivot and every element of right after it; lh and rh are their black heights.
+				The pivot is linked red on the right spine of the taller tree (or the left spine of right) at the first black node of the same black height as the shorter tree, which keeps the black heights equal, then the insertion is fixed up as usual.
+				Returns the new root and its black height, which only grows when the fix-up recolours a red root.
+			-------------------------------------------------------------------------------- */
+			pair<node_type*, size_type>	_join(node_type* left, size_type lh, node_type* pivot, node_type* right, size_type rh)
+			{
+				node_type*	parent = NULL;
+				node_type*	c;
+				size_type	h;
+
+				if (left)
+					left->set_parent(NULL);
+				if (right)
+					right->set_parent(NULL);
+				if (_is_red(left))
+				{
+					left->set_color(BLACK);
+					lh++;
+				}
+				if (_is_red(right))
+				{
+					right->set_color(BLACK);
+					rh++;
+				}
+
+				pivot->set_color(RED);
+				if (lh >= rh)
+				{
+					_root = left;
+					for (c = left, h = lh; c && (c->is_red() || h > rh); c = c->get_right())
+					{
+						if (c->is_black())
+							h--;
+						parent = c;
+					}
+					pivot->set_left(c);
+					pivot->set_right(right);
+					if (parent)
+						parent->set_right(pivot);
+				}
+				else
+				{
+					_root = right;
+					for (c = right, h = rh; c && (c->is_red() || h > lh); c = c->get_left())
+					{
+						if (c->is_black())
+							h--;
+						parent = c;
+					}
+					pivot->set_left(left);
+					pivot->set_right(c);
+					if (parent)
+						parent->set_left(pivot);
+				}
+
+				pivot->set_parent(parent);
+				if (pivot->get_left())
+					pivot->get_left()->set_parent(pivot);
+				if (pivot->get_right())
+					pivot->get_right()->set_parent(pivot);
+				if (!parent)
+					_root = pivot;
+
+				_update_path(pivot);
+
+				return (pair<node_type*, size_type>(_root, (lh > rh ? lh : rh) + _fix_insertion(pivot)));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Split halves -
+				Makes l the content of this tree and r the content of right, and moves the threads of the elements of r over to the end node of right.
+			-------------------------------------------------------------------------------- */
+			void					_split_halves(node_type* l, node_type* r, tree_type& right)
+			{
+				set_root(l);
+				right.set_root(r);
+
+				if (r)
+				{
+					node_type*	first = node_type::get_smallest(r);
+					node_type*	last = _end->reverse_iterate();
+
+					node_type::thread(first->reverse_iterate(), _end);
+					node_type::thread(right._end, first);
+					node_type::thread(last, right._end);
+				}
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Split a detached subtree -
+				Splits the subtree k, of black height h, into l (elements less than val) and r (the others), with their black heights.
+				Each level hands one side down to the recursive call and joins the other side, whose black height is known, with the node itself; the joins telescope to O(log n) in total.
+				When found is not NULL, an element equivalent to val is left out of both halves and returned through it.
+			-------------------------------------------------------------------------------- */
+			void					_split(node_type* k, size_type h, const value_type& val, node_type*& l, size_type& lh, node_type*& r, size_type& rh, node_type** found)
+			{
+				if (!k)
+				{
+					l = NULL;
+					r = NULL;
+					lh = 0;
+					rh = 0;
+					return;
+				}
+
+				size_type	ch = h - (k->is_black() ? 1 : 0);
+				node_type*	left = k->get_left();
+				node_type*	right = k->get_right();
+
+				if (found && !_comp(k->get_value(), val) && !_comp(val, k->get_value()))
+				{
+					*found = k;
+					l = left;
+					r = right;
+					lh = ch;
+					rh = ch;
+				}
+				else if (_comp(k->get_value(), val))
+				{
+					_split(right, ch, val, l, lh, r, rh, found);
+
+					pair<node_type*, size_type>	res = _join(left, ch, k, l, lh);
+
+					l = res.first;
+					lh = res.second;
+				}
+				else
+				{
+					_split(left, ch, val, l, lh, r, rh, found);
+
+					pair<node_type*, size_type>	res = _join(r, rh, k, right, ch);
+
+					r = res.first;
+					rh = res.second;
+				}
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Split a detached subtree by rank -
+				Same as _split, but l receives the first i elements of k and r the others, so that equivalent elements are never reordered.
+				When found is not NULL, the element of rank i is left out of both halves and returned through it.
+			-------------------------------------------------------------------------------- */
+			void					_split_rank(node_type* k, size_type h, size_type i, node_type*& l, size_type& lh, node_type*& r, size_type& rh, node_type** found)
+			{
+				if (!k)
+				{
+					l = NULL;
+					r = NULL;
+					lh = 0;
+					rh = 0;
+					return;
+				}
+
+				size_type	ch = h - (k->is_black() ? 1 : 0);
+				node_type*	left = k->get_left();
+				node_type*	right = k->get_right();
+				size_type	left_count = node_type::count(left);
+
+				if (found && i == left_count)
+				{
+					*found = k;
+					l = left;
+					r = right;
+					lh = ch;
+					rh = ch;
+				}
+				else if (i > left_count)
+				{
+					_split_rank(right, ch, i - left_count - 1, l, lh, r, rh, found);
+
+					pair<node_type*, size_type>	res = _join(left, ch, k, l, lh);
+
+					l = res.first;
+					lh = res.second;
+				}
+				else
+				{
+					_split_rank(left, ch, i, l, lh, r, rh, found);
+
+					pair<node_type*, size_type>	res = _join(r, rh, k, right, ch);
+
+					r = res.first;
+					rh = res.second;
+				}
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Destroy a detached subtree -
+				Destroys and deallocates every node of k in a single post-order walk, without rebalancing anything.
+			-------------------------------------------------------------------------------- */
+			void					_destroy(node_type* k)
+			{
+				if (!k)
+					return;
+				_destroy(k->get_left());
+				_destroy(k->get_right());
 				_node_alloc.destroy(k);
 				_node_alloc.deallocate(k, 1);
 
 				return;
 			}
 
+			/* --------------------------------------------------------------------------------
+			- Union of two detached subtrees -
+				Splits mine around the root of other, merges the halves with the subtrees of that root, and joins the results with the root as pivot.
+				When mine already holds an equivalent element, that element becomes the pivot instead and the root of other is given back to rejected.
+				Every node whose threads may now be wrong (a root of other that was kept, or the ends of a subtree of other taken whole) is pushed on moved, in order, for _rethread.
+			-------------------------------------------------------------------------------- */
+			pair<node_type*, size_type>	_union(node_type* mine, size_type mh, node_type* other, size_type oh, tree_type& rejected, node_type*& moved)
+			{
+				if (!other)
+					return (pair<node_type*, size_type>(mine, mh));
+				if (!mine)
+				{
+					node_type*	first = node_type::get_smallest(other);
+					node_type*	last = node_type::get_biggest(other);
+
+					_push_moved(first, moved);
+					if (last != first)
+						_push_moved(last, moved);
+					return (pair<node_type*, size_type>(other, oh));
+				}
+
+				node_type*	found = NULL;
+				node_type*	pivot = other;
+				node_type*	other_left = other->get_left();
+				node_type*	other_right = other->get_right();
+				size_type	ch = oh - (other->is_black() ? 1 : 0);
+				node_type*	l;
+				node_type*	r;
+				size_type	lh;
+				size_type	rh;
+
+				_split(mine, mh, other->get_value(), l, lh, r, rh, &found);
+
+				pair<node_type*, size_type>	left = _union(l, lh, other_left, ch, rejected, moved);
+
+				if (found)
+				{
+					rejected.insert_node(other);
+					pivot = found;
+				}
+				else
+					_push_moved(other, moved);
+
+				pair<node_type*, size_type>	right = _union(r, rh, other_right, ch, rejected, moved);
+
+				return (_join(left.first, left.second, pivot, right.first, right.second));
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Stack of moved nodes -
+				The nodes are chained through their predecessor thread, which _rethread sets again anyway, so that no memory is needed.
+			-------------------------------------------------------------------------------- */
+			static void				_push_moved(node_type* node, node_type*& moved)
+			{
+				node->set_prev(moved);
+				moved = node;
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Repair the threaded list -
+				Threads each moved node between its structural predecessor and successor, from the last one to the first: the successor of a node is then either untouched or already repaired, so the chain is never overwritten before it is read.
+				The threads between two nodes that were already neighbours, in this tree or inside a subtree of x, are still valid.
+			-------------------------------------------------------------------------------- */
+			static void				_rethread(node_type* moved)
+			{
+				while (moved)
+				{
+					node_type*	node = moved;
+
+					moved = node->reverse_iterate();
+					node_type::thread(node->predecessor(), node);
+					node_type::thread(node, node->successor());
+				}
+
+				return;
+			}
+
+			/* --------------------------------------------------------------------------------
+			- Append a threaded list -
+				Moves the whole threaded list of x, whose nodes have already been linked after every node of this tree, to the end of this tree's list.
+			-------------------------------------------------------------------------------- */
+			void					_splice_threads(tree_type& x)
+			{
+				if (x._end->iterate() == x._end)
+					return;
+
+				node_type::thread(_end->reverse_iterate(), x._end->iterate());
+				node_type::thread(x._end->reverse_iterate(), _end);
+				node_type::thread(x._end, x._end);
+
+				return;
+			}
+
+			pair<node_type*, bool>	_create_child(node_type* parent, bool is_left)
+			{
+				node_type*	child = (is_left ? parent->get_left() : parent->get_right());
+
+				if (child)
+					return (pair<node_type*, bool>(child, false));
+
+				node_type*	new_node = _node_alloc.allocate(1);
+
+				_node_alloc.construct(new_node, node_type(value_type(), NULL, NULL, parent, _end));
+				new_node->set_color(BLACK);
+				new_node->set_count(0);
+				new_node->set_aggregate(_aggr.identity());
+				is_left ? parent->set_left(new_node) : parent->set_right(new_node);
+
+				return (pair<node_type*, bool>(new_node, true));
+			}
+
 			void					_transplant_node(node_type* parent, node_type* k, node_type* replacer)
 			{
 				if (!parent)
@@ -362,6 +1092,64 @@ namespace ft
 				return (false);
 			}
 
+			aggregate_type			_aggregate_of(node_type* k) const
+				{return (k ? k->get_aggregate() : _aggr.identity());}
+
+			void					_update(node_type* k)
+			{
+				node_type*	left = k->get_left();
+				node_type*	right = k->get_right();
+
+				k->set_count(node_type::count(left) + node_type::count(right) + 1);
+				k->set_aggregate(_aggr.combine(_aggr.combine(_aggregate_of(left), _aggr(k->get_value())), _aggregate_of(right)));
+
+				return;
+			}
+
+			aggregate_type			_aggregate_from(node_type* k, const value_type& lo) const
+			{
+				aggregate_type	res = _aggr.identity();
+
+				while (k)
+				{
+					if (_comp(k->get_value(), lo))
+						k = k->get_right();
+					else
+					{
+						res = _aggr.combine(_aggr.combine(_aggr(k->get_value()), _aggregate_of(k->get_right())), res);
+						k = k->get_left();
+					}
+				}
+
+				return (res);
+			}
+
+			aggregate_type			_aggregate_until(node_type* k, const value_type& hi) const
+			{
+				aggregate_type	res = _aggr.identity();
+
+				while (k)
+				{
+					if (!_comp(k->get_value(), hi))
+						k = k->get_left();
+					else
+					{
+						res = _aggr.combine(res, _aggr.combine(_aggregate_of(k->get_left()), _aggr(k->get_value())));
+						k = k->get_right();
+					}
+				}
+
+				return (res);
+			}
+
+			void					_update_path(node_type* k)
+			{
+				for (; k; k = k->get_parent())
+					_update(k);
+
+				return;
+			}
+
 			void					_left_rotate(node_type* k)
 			{
 				node_type*	right = k->get_right();
@@ -384,6 +1172,9 @@ namespace ft
 				right->set_left(k);
 				k->set_parent(right);
 
+				_update(k);
+				_update(right);
+
 				return;
 			}
 
@@ -409,10 +1200,13 @@ namespace ft
 				left->set_right(k);
 				k->set_parent(left);
 
+				_update(k);
+				_update(left);
+
 				return;
 			}
 
-			void					_fix_insertion(node_type* k)
+			bool					_fix_insertion(node_type* k)
 			{
 				while (_is_red(k->get_parent()) && k->get_parent()->get_parent())
 				{
@@ -442,9 +1236,11 @@ namespace ft
 						is_left ? _right_rotate(gparent) : _left_rotate(gparent);
 					}
 				}
+				if (_root->is_black())
+					return (false);
 				_root->set_color(BLACK);
 
-				return;
+				return (true);
 			}
 
 			void					_fix_deletion(node_type* k)
@@ -494,20 +1290,18 @@ namespace ft
 				return;
 			}
 
+			/* --------------------------------------------------------------------------------
+			- Searches -
+				Every search is a lower or upper bound descent that makes a single comparison per level and keeps the last node where it went left.
+				The child and the candidate are picked with conditional moves rather than a branch, which would be mispredicted half of the time on random keys, and both children are prefetched before the comparison, so the next node is on its way whichever side the descent takes.
+				An exact search is a lower bound followed by one equivalence check, which also makes it return the first of several equal elements.
+			-------------------------------------------------------------------------------- */
 			node_type*				_search(const value_type& val) const
 			{
-				node_type*	z = _root;
-				node_type	tmp(val, _end, _comp);
+				node_type*	z = _search_lower_bound(val);
 
-				while (z)
-				{
-					if (*z == tmp)
-						return (z);
-					else if (tmp > *z)
-						z = z->get_right();
-					else
-						z = z->get_left();
-				}
+				if (z != _end && !_comp(val, z->get_value()))
+					return (z);
 
 				return (_end);
 			}
@@ -515,51 +1309,45 @@ namespace ft
 			node_type*				_search_lower_bound(const value_type& val) const
 			{
 				node_type*	z = _root;
-				node_type	tmp(val, _end, _comp);
-				node_type*	previous = NULL;
+				node_type*	res = _end;
 
 				while (z)
 				{
-					previous = z;
-					if (*z == tmp)
-						return (z);
-					else if (tmp > *z)
-						z = z->get_right();
-					else
-						z = z->get_left();
-				}
+					node_type*	left = z->get_left();
+					node_type*	right = z->get_right();
+
+					FT_PREFETCH(left);
+					FT_PREFETCH(right);
 
-				if (!previous)
-					return (_end);
-				else if (tmp > *previous)
-					return (previous->iterate());
+					bool		go_right = _comp(z->get_value(), val);
 
-				return (previous);
+					res = (go_right ? res : z);
+					z = (go_right ? right : left);
+				}
+
+				return (res);
 			}
 
 			node_type*				_search_upper_bound(const value_type& val) const
 			{
 				node_type*	z = _root;
-				node_type	tmp(val, _end, _comp);
-				node_type*	previous = NULL;
+				node_type*	res = _end;
 
 				while (z)
 				{
-					previous = z;
-					if (*z == tmp)
-						return (z->iterate());
-					else if (tmp > *z)
-						z = z->get_right();
-					else
-						z = z->get_left();
-				}
+					node_type*	left = z->get_left();
+					node_type*	right = z->get_right();
+
+					FT_PREFETCH(left);
+					FT_PREFETCH(right);
 
-				if (!previous)
-					return (_end);
-				else if (tmp > *previous)
-					return (previous->iterate());
+					bool		go_right = !_comp(val, z->get_value());
+
+					res = (go_right ? res : z);
+					z = (go_right ? right : left);
+				}
 
-				return (previous);
+				return (res);
 			}
 	};
 }
@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   skiplist_node.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:58:18 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 09:58:18 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SKIPLIST_NODE_HPP
+# define SKIPLIST_NODE_HPP
+
+# include <cstddef>	// size_t
+
+namespace ft
+{
+	/* --------------------------------------------------------------------------------
+	- Skiplist node -
+		Node of a lock-free skiplist: the element, then one link per level, the array extending past the end of the structure up to the height of the node.
+		The lowest bit of a link marks the node holding it as deleted at that level, so that no thread can link a new node after it: a deleted node is first marked at every level (logical deletion, which the mark on level 0 decides), then unlinked (physical deletion).
+		pending counts the threads that still have to be done with the node, the inserter linking its upper levels and the eraser unlinking it, so that it is retired by the last of the two; retired_next and epoch hold it in the list of retired nodes.
+	-------------------------------------------------------------------------------- */
+	template<class T>
+	struct	skiplist_node
+	{
+		T					value;
+		skiplist_node*		retired_next;
+		unsigned long		epoch;
+		int					pending;
+		int					height;
+		skiplist_node*		next[1];
+
+		/* ----- LINKS ----- */
+
+		skiplist_node*			load(int level) const
+			{return (__atomic_load_n(&next[level], __ATOMIC_ACQUIRE));}
+
+		bool					exchange(int level, skiplist_node* expected, skiplist_node* desired)
+			{return (__atomic_compare_exchange_n(&next[level], &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));}
+
+		/* --------------------------------------------------------------------------------
+		- Successor -
+			Returns the next node at level 0 that is not deleted, or NULL.
+		-------------------------------------------------------------------------------- */
+		skiplist_node*			successor() const
+		{
+			skiplist_node*	n = unmarked(load(0));
+
+			while (n && is_marked(n->load(0)))
+				n = unmarked(n->load(0));
+
+			return (n);
+		}
+
+		/* ----- MARKS ----- */
+
+		static bool				is_marked(const skiplist_node* p)
+			{return (reinterpret_cast<size_t>(p) & 1);}
+
+		static skiplist_node*	marked(skiplist_node* p)
+			{return (reinterpret_cast<skiplist_node*>(reinterpret_cast<size_t>(p) | 1));}
+
+		static skiplist_node*	unmarked(skiplist_node* p)
+			{return (reinterpret_cast<skiplist_node*>(reinterpret_cast<size_t>(p) & ~static_cast<size_t>(1)));}
+
+		/* --------------------------------------------------------------------------------
+		- Size -
+			Returns the number of bytes a node of the given height takes.
+		-------------------------------------------------------------------------------- */
+		static size_t			bytes(int height)
+			{return (sizeof(skiplist_node) + (height - 1) * sizeof(skiplist_node*));}
+	};
+}
+
+#endif
@@ -0,0 +1,343 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_queue.cpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:07:20 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 10:52:32 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../Containers/indexed_heap.hpp"
+#include "../Containers/mpmc_ring_buffer.hpp"
+#include "../Containers/priority_queue.hpp"
+#include "../Containers/queue.hpp"
+#include "../Containers/spsc_ring_buffer.hpp"
+#include "../Containers/vector.hpp"
+
+
+#include <iostream>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/time.h>
+
+#define NBR 100000
+
+template<class Ring>
+struct	ring_task
+{
+	Ring*	ring;
+	long	first;
+	long	count;
+	long	sum;
+	long	out_of_order;
+};
+
+template<class Ring>
+void*	ring_producer(void* arg)
+{
+	ring_task<Ring>*	task = static_cast<ring_task<Ring>*>(arg);
+
+	for (long v = task->first; v < task->first + task->count; v++)
+	{
+		while (!task->ring->push(v))
+			sched_yield();
+		task->sum += v;
+	}
+
+	return (NULL);
+}
+
+template<class Ring>
+void*	ring_consumer(void* arg)
+{
+	ring_task<Ring>*	task = static_cast<ring_task<Ring>*>(arg);
+	long				value;
+
+	for (long expected = task->first; expected < task->first + task->count;)
+	{
+		if (task->ring->pop(value))
+		{
+			task->out_of_order += value != expected;
+			task->sum += value;
+			expected++;
+		}
+		else
+			sched_yield();
+	}
+
+	return (NULL);
+}
+
+void	ft_queue()
+{
+	struct timeval	begin, end;
+	gettimeofday(&begin, 0);
+
+	{
+		std::cout << "----- INT QUEUES -----" << std::endl << std::endl;
+		ft::queue<int>					que1;
+
+		for (int i = 0; i < NBR; i++)
+		{
+			que1.push(i);
+			if (i % 3 == 0)
+				que1.pop();
+		}
+
+		ft::queue<int>					que2;
+
+		que2.push(42);
+		que2.push(19);
+		que2.push(1337);
+
+		ft::queue<int>					que3(que1);
+
+		std::cout << "--- Capacity functions ---" << std::endl;
+		std::cout << "que1.size() 	\x1b[16G= " << que1.size()	<< std::endl;
+		std::cout << "que1.empty()	\x1b[16G= " << que1.empty()	<< std::endl;
+		std::cout << "que1.front()	\x1b[16G= " << que1.front()	<< std::endl;
+		std::cout << "que1.back()	\x1b[16G= " << que1.back()	<< std::endl << std::endl;
+
+		std::cout << "que2.size() 	\x1b[16G= " << que2.size()	<< std::endl;
+		std::cout << "que2.empty()	\x1b[16G= " << que2.empty()	<< std::endl << std::endl;
+
+		std::cout << "--- Relational operators ---" << std::endl;
+		std::cout << "que1 == que3	\x1b[16G= " << (que1 == que3)	<< std::endl;
+		que3.pop();
+		std::cout << "que1 == que3	\x1b[16G= " << (que1 == que3)	<< std::endl;
+		std::cout << "que1 < que3	\x1b[16G= " << (que1 < que3)	<< std::endl;
+		std::cout << "que1 >= que2	\x1b[16G= " << (que1 >= que2)	<< std::endl << std::endl;
+
+		while (que2.size())
+		{
+			std::cout << "que2.front()	\x1b[16G= " << que2.front()	<< std::endl;
+			que2.pop();
+		}
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- STRING QUEUES -----" << std::endl << std::endl;
+		ft::queue<std::string>					que1;
+
+		for (int i = 0; i < NBR; i++)
+			que1.push("i");
+
+		ft::queue<std::string>					que2;
+
+		que2.push("Forty-two");
+		que2.push("Nineteen");
+		que2.push("One thousand three hundreds thirty-seven");
+
+		std::cout << "--- Capacity functions ---" << std::endl;
+		std::cout << "que1.size()	\x1b[16G= " << que1.size()	<< std::endl;
+		std::cout << "que1.empty()	\x1b[16G= " << que1.empty()	<< std::endl << std::endl;
+
+		std::cout << "que2.size()	\x1b[16G= " << que2.size()	<< std::endl;
+		std::cout << "que2.back()	\x1b[16G= " << que2.back()	<< std::endl << std::endl;
+
+		while (que2.size())
+		{
+			std::cout << "que2.front()	\x1b[16G= " << que2.front()	<< std::endl;
+			que2.pop();
+		}
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT RING BUFFERS -----" << std::endl << std::endl;
+		ft::spsc_ring_buffer<int>				que1(1000);
+		ft::mpmc_ring_buffer<int>				que2(4);
+		int										batch[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+		int										value = 0;
+		unsigned long							sum = 0;
+
+		for (int i = 0; i < NBR; i++)
+		{
+			if (!que1.push(i))
+			{
+				while (que1.pop(value))
+					sum += value;
+				que1.push(i);
+			}
+		}
+		while (que1.pop(value))
+			sum += value;
+
+		std::cout << "que1 sum	\x1b[16G= " << sum			<< std::endl;
+		std::cout << "que1.push_n()	\x1b[16G= " << que1.push_n(batch, 8)	<< std::endl;
+		std::cout << "que1.pop_n()	\x1b[16G= " << que1.pop_n(batch + 4, 4)	<< std::endl;
+		std::cout << "batch[7]	\x1b[16G= " << batch[7]		<< std::endl;
+		std::cout << "que1.size()	\x1b[16G= " << que1.size()	<< std::endl << std::endl;
+
+		que2.push(42);
+		que2.push(19);
+		que2.push(1337);
+		que2.push(7);
+
+		bool									pushed = que2.push(0);
+
+		std::cout << "que2.push(0)	\x1b[16G= " << pushed		<< std::endl;
+		std::cout << "que2.size()	\x1b[16G= " << que2.size()	<< std::endl;
+
+		while (que2.pop(value))
+			std::cout << "que2.pop()	\x1b[16G= " << value		<< std::endl;
+		std::cout << "que2.empty()	\x1b[16G= " << que2.empty()	<< std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT PRIORITY QUEUES -----" << std::endl << std::endl;
+		ft::vector<int>							vct;
+
+		for (int i = 0; i < NBR; i++)
+			vct.push_back((i * 7919) % NBR);
+
+		ft::priority_queue<int>					que1(vct.begin(), vct.end());
+		ft::priority_queue<int, ft::vector<int>, std::greater<int> >	que2;
+		unsigned long							sum = 0;
+
+		for (int i = 0; i < 10; i++)
+			que2.push((i * 37) % 11);
+		while (que1.size() > 5)
+		{
+			sum += que1.top();
+			que1.pop();
+		}
+
+		std::cout << "que1 sum	\x1b[16G= " << sum			<< std::endl;
+		std::cout << "que1.size()	\x1b[16G= " << que1.size()	<< std::endl;
+		std::cout << "que1.top()	\x1b[16G= " << que1.top()	<< std::endl;
+		std::cout << "que2.size()	\x1b[16G= " << que2.size()	<< std::endl;
+
+		while (!que2.empty())
+		{
+			std::cout << "que2.top()	\x1b[16G= " << que2.top()	<< std::endl;
+			que2.pop();
+		}
+
+		std::cout << std::endl;
+		std::cout << "--- Heap functions ---" << std::endl;
+		ft::vector<std::string>					heap;
+
+		heap.push_back("Nineteen");
+		heap.push_back("Forty-two");
+		heap.push_back("One thousand three hundreds thirty-seven");
+		heap.push_back("Zero");
+		ft::make_heap(heap.begin(), heap.end());
+		heap.push_back("Ninety");
+		ft::push_heap(heap.begin(), heap.end());
+
+		while (!heap.empty())
+		{
+			std::cout << "heap.front()	\x1b[16G= " << heap.front()	<< std::endl;
+			ft::pop_heap(heap.begin(), heap.end());
+			heap.pop_back();
+		}
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT INDEXED HEAPS -----" << std::endl << std::endl;
+		ft::indexed_heap<int>					heap;
+		ft::vector<size_t>						handles;
+
+		for (int i = 0; i < NBR / 100; i++)
+			handles.push_back(heap.push((i * 7919) % 1000));
+		for (int i = 0; i < NBR / 100; i += 10)
+			heap.update(handles[i], 1000 + i);
+		for (int i = 5; i < NBR / 100; i += 10)
+			heap.erase(handles[i]);
+
+		std::cout << "heap.size()	\x1b[16G= " << heap.size()				<< std::endl;
+		std::cout << "heap[20]	\x1b[16G= " << heap[handles[20]]			<< std::endl;
+		std::cout << "contains(5)	\x1b[16G= " << heap.contains(handles[5])	<< std::endl;
+
+		for (int i = 0; i < 5; i++)
+		{
+			std::cout << "heap.top()	\x1b[16G= " << heap.top()	<< std::endl;
+			heap.pop();
+		}
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- LONG RING BUFFERS, 1 PRODUCER AND 1 CONSUMER -----" << std::endl << std::endl;
+		typedef ft::spsc_ring_buffer<long>		spsc;
+
+		spsc									rb(64);
+		pthread_t								threads[2];
+		ring_task<spsc>							tasks[2];
+
+		for (int i = 0; i < 2; i++)
+		{
+			tasks[i].ring = &rb;
+			tasks[i].first = 1;
+			tasks[i].count = NBR;
+			tasks[i].sum = 0;
+			tasks[i].out_of_order = 0;
+		}
+		pthread_create(&threads[0], NULL, ring_producer<spsc>, &tasks[0]);
+		pthread_create(&threads[1], NULL, ring_consumer<spsc>, &tasks[1]);
+		for (int i = 0; i < 2; i++)
+			pthread_join(threads[i], NULL);
+
+		std::cout << "pushed sum		\x1b[24G= " << tasks[0].sum			<< std::endl;
+		std::cout << "popped sum		\x1b[24G= " << tasks[1].sum			<< std::endl;
+		std::cout << "out of order		\x1b[24G= " << tasks[1].out_of_order	<< std::endl;
+		std::cout << "rb.empty()		\x1b[24G= " << rb.empty()			<< std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- LONG RING BUFFERS, 4 PRODUCERS AND 4 CONSUMERS -----" << std::endl << std::endl;
+		typedef ft::mpmc_ring_buffer<long>		mpmc;
+
+		mpmc									rb(64);
+		pthread_t								threads[8];
+		ring_task<mpmc>							tasks[8];
+		long									pushed = 0;
+		long									popped = 0;
+
+		for (int i = 0; i < 8; i++)
+		{
+			tasks[i].ring = &rb;
+			tasks[i].first = (i / 2) * (NBR / 4) + 1;
+			tasks[i].count = NBR / 4;
+			tasks[i].sum = 0;
+			tasks[i].out_of_order = 0;
+			pthread_create(&threads[i], NULL, i % 2 ? ring_consumer<mpmc> : ring_producer<mpmc>, &tasks[i]);
+		}
+		for (int i = 0; i < 8; i++)
+		{
+			pthread_join(threads[i], NULL);
+			(i % 2 ? popped : pushed) += tasks[i].sum;
+		}
+
+		std::cout << "pushed sum		\x1b[24G= " << pushed			<< std::endl;
+		std::cout << "popped sum		\x1b[24G= " << popped			<< std::endl;
+		std::cout << "rb.empty()		\x1b[24G= " << rb.empty()		<< std::endl;
+
+		std::cout << std::endl;
+	}
+
+	gettimeofday(&end, 0);
+	long	seconds		= end.tv_sec - begin.tv_sec;
+	long	useconds	= end.tv_usec - begin.tv_usec;
+	double	time		= seconds * 1e6 + useconds;
+
+	std::cout << "Execution time for ft_queue: " << time << " microseconds." << std::endl;
+	std::cout << std::endl;
+	std::cout << std::endl;
+
+	return;
+}
@@ -0,0 +1,205 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_set.cpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:51:18 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 11:10:39 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../Containers/set.hpp"
+#include "../Containers/multiset.hpp"
+#include "../Containers/unordered_set.hpp"
+
+
+#include <iostream>
+#include <sys/time.h>
+
+#define NBR 100000
+
+struct	direction_less
+{
+	bool	descending;
+
+	direction_less(bool desc = false) : descending(desc)
+		{return;}
+
+	bool	operator()(int x, int y) const
+		{return (descending ? y < x : x < y);}
+};
+
+void	ft_set()
+{
+	struct timeval	begin, end;
+	gettimeofday(&begin, 0);
+
+	{
+		std::cout << "----- INT SETS -----" << std::endl << std::endl;
+		ft::set<int>					st1;
+
+		for (int i = 0; i < NBR; i++)
+			st1.insert(i % (NBR / 2));
+
+		ft::set<int>					st2(st1);
+
+		st1.clear();
+
+		std::cout << "--- Capacity functions ---" << std::endl;
+		std::cout << "st1.size()		\x1b[16G= " << st1.size() << std::endl;
+		std::cout << "st1.empty()		\x1b[16G= " << st1.empty() << std::endl << std::endl;
+
+		std::cout << "st2.size()		\x1b[16G= " << st2.size() << std::endl;
+		std::cout << "st2.empty()		\x1b[16G= " << st2.empty() << std::endl << std::endl;
+
+		std::cout << "--- Modifier functions ---" << std::endl;
+
+		st1.insert(1337);
+		st1.insert(19);
+		st1.insert(42);
+		st1.insert(st1.end(), 100);
+		st1.insert(st1.find(19), 0);
+		std::cout << "st1.insert(42).second	\x1b[24G= " << st1.insert(42).second << std::endl;
+		std::cout << "st1.insert(-999).second	\x1b[24G= " << st1.insert(-999).second << std::endl;
+
+		for (ft::set<int>::iterator it = st1.begin(); it != st1.end(); it++)
+			std::cout << *it << " ";
+		std::cout << std::endl;
+
+		st1.erase(st1.find(19));
+		std::cout << "st1.erase(-999)	\x1b[24G= " << st1.erase(-999) << std::endl;
+		std::cout << "st1.erase(-999)	\x1b[24G= " << st1.erase(-999) << std::endl;
+
+		for (ft::set<int>::reverse_iterator it = st1.rbegin(); it != st1.rend(); it++)
+			std::cout << *it << " ";
+		std::cout << std::endl << std::endl;
+
+		std::cout << "--- Operations ---" << std::endl;
+		std::cout << "st2.count(42)		\x1b[24G= " << st2.count(42) << std::endl;
+		std::cout << "st2.count(NBR)		\x1b[24G= " << st2.count(NBR) << std::endl;
+		std::cout << "*st1.lower_bound(50)	\x1b[24G= " << *st1.lower_bound(50) << std::endl;
+		std::cout << "*st1.upper_bound(42)	\x1b[24G= " << *st1.upper_bound(42) << std::endl;
+		std::cout << "st1 < st2		\x1b[24G= " << (st1 < st2) << std::endl;
+
+		st2.erase(st2.find(100), st2.end());
+		st1.swap(st2);
+		std::cout << "st1.size()		\x1b[24G= " << st1.size() << std::endl;
+		std::cout << "st2.size()		\x1b[24G= " << st2.size() << std::endl;
+
+		std::cout << std::endl;
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- STRING MULTISETS -----" << std::endl << std::endl;
+		ft::multiset<std::string>		ms1;
+
+		for (int i = 0; i < NBR; i++)
+			ms1.insert(i % 3 ? "second" : "first");
+
+		ft::multiset<std::string>		ms2(ms1);
+
+		std::cout << "--- Capacity functions ---" << std::endl;
+		std::cout << "ms2.size()		\x1b[24G= " << ms2.size() << std::endl;
+		std::cout << "ms2.count(\"first\")	\x1b[24G= " << ms2.count("first") << std::endl;
+		std::cout << "ms2.count(\"second\")	\x1b[24G= " << ms2.count("second") << std::endl << std::endl;
+
+		std::cout << "--- Modifier functions ---" << std::endl;
+		ms1.clear();
+		ms1.insert("Nineteen");
+		ms1.insert("Forty-two");
+		ms1.insert("Nineteen");
+		ms1.insert(ms1.begin(), "Forty-two");
+		ms1.insert(ms1.end(), "Zero");
+
+		for (ft::multiset<std::string>::iterator it = ms1.begin(); it != ms1.end(); it++)
+			std::cout << *it << " ";
+		std::cout << std::endl;
+
+		std::cout << "ms1.erase(\"Nineteen\")	\x1b[24G= " << ms1.erase("Nineteen") << std::endl;
+		std::cout << "ms2.erase(\"first\")	\x1b[24G= " << ms2.erase("first") << std::endl;
+		ms1.erase(ms1.find("Forty-two"));
+
+		for (ft::multiset<std::string>::iterator it = ms1.begin(); it != ms1.end(); it++)
+			std::cout << *it << " ";
+		std::cout << std::endl;
+		std::cout << "ms2.size()		\x1b[24G= " << ms2.size() << std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- STRING UNORDERED SETS -----" << std::endl << std::endl;
+		ft::unordered_set<std::string>		us1;
+
+		us1.insert("Nineteen");
+		us1.insert("Forty-two");
+		us1.insert("Nineteen");
+		us1.insert("Zero");
+
+		ft::unordered_set<std::string>		us2(us1);
+
+		std::cout << "--- Capacity functions ---" << std::endl;
+		std::cout << "us1.size()		\x1b[24G= " << us1.size() << std::endl;
+		std::cout << "us1.count(\"Zero\")	\x1b[24G= " << us1.count("Zero") << std::endl;
+		std::cout << "us1.count(\"One\")	\x1b[24G= " << us1.count("One") << std::endl << std::endl;
+
+		std::cout << "--- Modifier functions ---" << std::endl;
+		std::cout << "us1.erase(\"Nineteen\")	\x1b[24G= " << us1.erase("Nineteen") << std::endl;
+		std::cout << "us1.erase(\"Nineteen\")	\x1b[24G= " << us1.erase("Nineteen") << std::endl;
+		std::cout << "*us1.find(\"Zero\")	\x1b[24G= " << *us1.find("Zero") << std::endl;
+		us1.erase(us1.find("Zero"));
+		std::cout << "us1.size()		\x1b[24G= " << us1.size() << std::endl;
+		std::cout << "*us1.begin()		\x1b[24G= " << *us1.begin() << std::endl;
+		std::cout << "us1 == us2		\x1b[24G= " << (us1 == us2) << std::endl;
+		us1.swap(us2);
+		std::cout << "us1.size()		\x1b[24G= " << us1.size() << std::endl;
+		std::cout << "us2.size()		\x1b[24G= " << us2.size() << std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT SETS WITH A STATEFUL COMPARATOR -----" << std::endl << std::endl;
+		ft::set<int, direction_less>			st1((direction_less(true)));
+		ft::set<int, direction_less>			st2;
+		ft::multiset<int, direction_less>		ms1((direction_less(true)));
+		ft::multiset<int, direction_less>		ms2;
+
+		for (int i = 0; i < 10; i++)
+		{
+			st1.insert(i * 7 % 10);
+			ms1.insert(i % 4);
+		}
+		st2 = st1;
+		ms2 = ms1;
+		st2.insert(42);
+		st2.insert(-1);
+		ms2.insert(2);
+
+		std::cout << "st2		\x1b[16G=";
+		for (ft::set<int, direction_less>::iterator it = st2.begin(); it != st2.end(); ++it)
+			std::cout << " " << *it;
+		std::cout << std::endl << "ms2		\x1b[16G=";
+		for (ft::multiset<int, direction_less>::iterator it = ms2.begin(); it != ms2.end(); ++it)
+			std::cout << " " << *it;
+		std::cout << std::endl;
+		std::cout << "st2.count(5)	\x1b[16G= " << st2.count(5) << std::endl;
+		std::cout << "ms2.count(2)	\x1b[16G= " << ms2.count(2) << std::endl;
+
+		std::cout << std::endl;
+	}
+
+	gettimeofday(&end, 0);
+	long	seconds		= end.tv_sec - begin.tv_sec;
+	long	useconds	= end.tv_usec - begin.tv_usec;
+	double	time		= seconds * 1e6 + useconds;
+
+	std::cout << "Execution time for ft_set: " << time << " microseconds." << std::endl;
+	std::cout << std::endl;
+	std::cout << std::endl;
+
+	return;
+}
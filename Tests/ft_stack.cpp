@@ -6,18 +6,110 @@
 /*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/15 18:17:48 by hcremers          #+#    #+#             */
-/*   Updated: 2022/12/20 14:21:28 by hcremers         ###   ########.fr       */
+/*   Updated: 2026/10/19 11:08:21 by hcremers         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
+#include "../Containers/concurrent_bounded_stack.hpp"
+#include "../Containers/concurrent_stack.hpp"
 #include "../Containers/stack.hpp"
+#include "../Containers/static_stack.hpp"
+#include "../Containers/vector.hpp"
+#include "../Others/pair.hpp"
 
 
 #include <iostream>
+#include <iterator>
+#include <pthread.h>
+#include <sched.h>
+#include <sstream>
 #include <sys/time.h>
 
 #define NBR 100000
 
+template<class Stack>
+struct	stack_task
+{
+	Stack*	stack;
+	long	first;
+	long	count;
+	long	sum;
+};
+
+bool	push_once(ft::concurrent_stack<long>& stk, long value)
+{
+	stk.push(value);
+
+	return (true);
+}
+
+bool	push_once(ft::concurrent_bounded_stack<long>& stk, long value)
+	{return (stk.push(value));}
+
+template<class Stack>
+void*	stack_pusher(void* arg)
+{
+	stack_task<Stack>*	task = static_cast<stack_task<Stack>*>(arg);
+
+	for (long v = task->first; v < task->first + task->count; v++)
+	{
+		while (!push_once(*task->stack, v))
+			sched_yield();
+		task->sum += v;
+	}
+
+	return (NULL);
+}
+
+template<class Stack>
+void*	stack_popper(void* arg)
+{
+	stack_task<Stack>*	task = static_cast<stack_task<Stack>*>(arg);
+	long				value;
+
+	for (long n = 0; n < task->count;)
+	{
+		if (task->stack->pop(value))
+		{
+			task->sum += value;
+			n++;
+		}
+		else
+			sched_yield();
+	}
+
+	return (NULL);
+}
+
+template<class Stack>
+void	run_stack_threads(Stack& stk, const char* name)
+{
+	pthread_t			threads[8];
+	stack_task<Stack>	tasks[8];
+	long				pushed = 0;
+	long				popped = 0;
+
+	for (int i = 0; i < 8; i++)
+	{
+		tasks[i].stack = &stk;
+		tasks[i].first = (i / 2) * 20000 + 1;
+		tasks[i].count = 20000;
+		tasks[i].sum = 0;
+		pthread_create(&threads[i], NULL, i % 2 ? stack_popper<Stack> : stack_pusher<Stack>, &tasks[i]);
+	}
+	for (int i = 0; i < 8; i++)
+	{
+		pthread_join(threads[i], NULL);
+		(i % 2 ? popped : pushed) += tasks[i].sum;
+	}
+
+	std::cout << name << " pushed sum	\x1b[24G= " << pushed		<< std::endl;
+	std::cout << name << " popped sum	\x1b[24G= " << popped		<< std::endl;
+	std::cout << name << ".empty()	\x1b[24G= " << stk.empty()	<< std::endl;
+
+	return;
+}
+
 void	ft_stack()
 {
 	struct timeval	begin, end;
@@ -81,6 +173,126 @@ void	ft_stack()
 		std::cout << std::endl;
 	}
 
+	{
+		std::cout << "----- INT CONCURRENT STACKS -----" << std::endl << std::endl;
+		ft::concurrent_stack<int>				stk1;
+		ft::concurrent_bounded_stack<int>		stk2(3);
+		int										value = 0;
+
+		for (int i = 0; i < NBR; i++)
+			stk1.push(i);
+		for (int i = 0; i < NBR / 2; i++)
+			stk1.pop();
+		stk1.top(value);
+
+		std::cout << "stk1.size()	\x1b[16G= " << stk1.size()	<< std::endl;
+		std::cout << "stk1.top()	\x1b[16G= " << value		<< std::endl << std::endl;
+
+		stk2.push(42);
+		stk2.push(19);
+		stk2.push(1337);
+
+		bool									pushed = stk2.push(0);
+
+		std::cout << "stk2.push(0)	\x1b[16G= " << pushed		<< std::endl;
+		std::cout << "stk2.size()	\x1b[16G= " << stk2.size()	<< std::endl;
+
+		while (stk2.pop(value))
+			std::cout << "stk2.pop()	\x1b[16G= " << value		<< std::endl;
+		std::cout << "stk2.empty()	\x1b[16G= " << stk2.empty()	<< std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- STACK BATCHES -----" << std::endl << std::endl;
+		ft::stack<int>							stk1;
+		ft::vector<int>							adj;
+
+		for (int i = 0; i < 100; i++)
+			adj.push_back(i);
+		for (int i = 0; i < NBR / 100; i++)
+			stk1.push_range(adj.begin(), adj.end());
+		stk1.pop_n(NBR / 2 + 42);
+
+		std::cout << "stk1.size()	\x1b[16G= " << stk1.size()	<< std::endl;
+		std::cout << "stk1.top()	\x1b[16G= " << stk1.top()	<< std::endl << std::endl;
+
+		ft::stack<std::string>					stk2;
+		ft::stack<ft::pair<int, std::string> >	stk3;
+
+		stk2.emplace(3, 'x');
+		stk2.emplace("Forty-two");
+		stk2.emplace();
+		stk3.emplace(1337, "One thousand three hundreds thirty-seven");
+
+		std::cout << "stk2.size()	\x1b[16G= " << stk2.size()	<< std::endl;
+		while (stk2.size())
+		{
+			std::cout << "stk2.top()	\x1b[16G= " << stk2.top()	<< std::endl;
+			stk2.pop();
+		}
+		std::cout << "stk3.top()	\x1b[16G= " << stk3.top().first << " " << stk3.top().second	<< std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT STATIC STACKS -----" << std::endl << std::endl;
+		ft::static_stack<int, 3>				stk1;
+		bool									thrown = false;
+
+		stk1.push(42);
+		stk1.push(19);
+		stk1.push(1337);
+		try
+		{
+			stk1.push(0);
+		}
+		catch (const std::out_of_range& e)
+		{
+			thrown = true;
+		}
+
+		std::cout << "stk1.push(0)	\x1b[16G= " << thrown		<< std::endl;
+		std::cout << "stk1.size()	\x1b[16G= " << stk1.size()	<< std::endl;
+		std::cout << "stk1.full()	\x1b[16G= " << stk1.full()	<< std::endl;
+
+		while (stk1.size())
+		{
+			std::cout << "stk1.top()	\x1b[16G= " << stk1.top()	<< std::endl;
+			stk1.pop();
+		}
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- LONG CONCURRENT STACKS, 4 PUSHERS AND 4 POPPERS -----" << std::endl << std::endl;
+		ft::concurrent_stack<long>				stk1;
+		ft::concurrent_bounded_stack<long>		stk2(64);
+
+		run_stack_threads(stk1, "stk1");
+		run_stack_threads(stk2, "stk2");
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT STACKS FROM STREAMS -----" << std::endl << std::endl;
+		std::istringstream						in("4 8 15 16 23 42");
+		ft::stack<int>							stk1;
+
+		stk1.push(0);
+		stk1.push_range(std::istream_iterator<int>(in), std::istream_iterator<int>());
+
+		std::cout << "stk1.size()	\x1b[16G= " << stk1.size()	<< std::endl;
+		for (; !stk1.empty(); stk1.pop())
+			std::cout << "stk1.top()	\x1b[16G= " << stk1.top()	<< std::endl;
+
+		std::cout << std::endl;
+	}
+
 	gettimeofday(&end, 0);
 	long	seconds		= end.tv_sec - begin.tv_sec;
 	long	useconds	= end.tv_usec - begin.tv_usec;
@@ -6,18 +6,232 @@
 /*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/15 18:17:48 by hcremers          #+#    #+#             */
-/*   Updated: 2022/12/20 14:22:12 by hcremers         ###   ########.fr       */
+/*   Updated: 2026/10/19 11:16:52 by hcremers         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include <map>
 namespace ft = std;
 
+#include <algorithm>
 #include <iostream>
+#include <string>
+#include <iterator>
 #include <sys/time.h>
 
 #define NBR 100000
 
+struct	element_sum
+{
+	unsigned long	sum;
+
+	element_sum() : sum(0)
+		{return;}
+
+	void	operator()(const ft::pair<const int, int>& p)
+	{
+		sum = sum * 31 + p.first + p.second;
+		return;
+	}
+};
+
+typedef ft::map<int, int>	sum_map;
+
+long	range_sum(const sum_map& mp, int lo, int hi)
+{
+	long	sum = 0;
+
+	for (sum_map::const_iterator it = mp.lower_bound(lo); it != mp.end() && it->first < hi; ++it)
+		sum += it->second;
+
+	return (sum);
+}
+
+long	total_sum(const sum_map& mp)
+	{return (range_sum(mp, -2147483647 - 1, 2147483647));}
+
+struct	direction_less
+{
+	bool	descending;
+
+	direction_less(bool desc = false) : descending(desc)
+		{return;}
+
+	bool	operator()(int x, int y) const
+		{return (descending ? y < x : x < y);}
+};
+
+void	merge(ft::map<int, int>& mp, ft::map<int, int>& x)
+{
+	for (ft::map<int, int>::iterator it = x.begin(); it != x.end();)
+	{
+		if (mp.insert(*it).second)
+			x.erase(it++);
+		else
+			++it;
+	}
+
+	return;
+}
+
+template<class Map>
+void	split_off(Map& mp, const typename Map::key_type& k, Map& x)
+{
+	if (&x == &mp)
+		return;
+
+	x.clear();
+	x.insert(mp.lower_bound(k), mp.end());
+	mp.erase(mp.lower_bound(k), mp.end());
+
+	return;
+}
+
+template<class Map>
+void	splice_range(Map& mp, Map& x, const typename Map::key_type& lo, const typename Map::key_type& hi)
+{
+	typename Map::iterator	it = x.lower_bound(lo);
+
+	while (lo < hi && it != x.end() && it->first < hi)
+	{
+		if (mp.insert(*it).second)
+			x.erase(it++);
+		else
+			++it;
+	}
+
+	return;
+}
+
+struct	node_handle
+{
+	bool	full;
+	int		k;
+	int		v;
+
+	node_handle() : full(false), k(0), v(0)
+		{return;}
+
+	bool	empty() const
+		{return (!full);}
+
+	int&	key()
+		{return (k);}
+
+	int&	mapped()
+		{return (v);}
+};
+
+struct	node_insert_return
+{
+	ft::map<int, int>::iterator	position;
+	bool						inserted;
+	node_handle					node;
+};
+
+node_handle	extract(ft::map<int, int>& mp, ft::map<int, int>::iterator position)
+{
+	node_handle	nh;
+
+	nh.full = true;
+	nh.k = position->first;
+	nh.v = position->second;
+	mp.erase(position);
+
+	return (nh);
+}
+
+node_handle	extract(ft::map<int, int>& mp, int k)
+{
+	ft::map<int, int>::iterator	it = mp.find(k);
+
+	if (it == mp.end())
+		return (node_handle());
+
+	return (extract(mp, it));
+}
+
+node_insert_return	insert(ft::map<int, int>& mp, node_handle& nh)
+{
+	node_insert_return	ret;
+
+	ret.position = mp.end();
+	ret.inserted = false;
+	if (nh.empty())
+		return (ret);
+
+	ft::pair<ft::map<int, int>::iterator, bool>	tmp = mp.insert(ft::make_pair(nh.k, nh.v));
+
+	ret.position = tmp.first;
+	ret.inserted = tmp.second;
+	if (!tmp.second)
+		ret.node = nh;
+	nh.full = false;
+
+	return (ret);
+}
+
+ft::map<int, int>::iterator	insert(ft::map<int, int>& mp, ft::map<int, int>::iterator hint, node_handle& nh)
+{
+	(void)hint;
+
+	return (insert(mp, nh).position);
+}
+
+void	print_summary(const char* name, const ft::map<int, int>& mp)
+{
+	unsigned long	hash = 0;
+	size_t			backward = 0;
+	bool			sorted = true;
+
+	for (ft::map<int, int>::const_iterator it = mp.begin(); it != mp.end(); ++it)
+	{
+		hash = hash * 31 + it->first + it->second;
+		if (it != mp.begin())
+		{
+			ft::map<int, int>::const_iterator	prev = it;
+
+			sorted = sorted && (--prev)->first < it->first;
+		}
+	}
+	for (ft::map<int, int>::const_reverse_iterator it = mp.rbegin(); it != mp.rend(); ++it)
+		backward++;
+
+	std::cout << name << ".size()	\x1b[16G= " << mp.size();
+	if (!mp.empty())
+		std::cout << " [" << mp.begin()->first << " .. " << mp.rbegin()->first << "]";
+	std::cout << " hash " << hash << " backward " << backward << " sorted " << sorted << std::endl;
+
+	return;
+}
+
+struct	counted
+{
+	static int	defaults;
+	int			v;
+
+	counted() : v(0)
+	{
+		defaults++;
+		return;
+	}
+
+	explicit counted(int x) : v(x)
+		{return;}
+};
+
+int		counted::defaults = 0;
+
+unsigned long	counted_sum(const ft::map<int, counted>& mp)
+{
+	unsigned long	sum = 0;
+
+	for (ft::map<int, counted>::const_iterator it = mp.begin(); it != mp.end(); ++it)
+		sum = sum * 7 + it->first + it->second.v;
+
+	return (sum);
+}
+
 void	std_map()
 {
 	struct timeval	begin, end;
@@ -148,6 +362,858 @@ void	std_map()
 		std::cout << std::endl;
 	}
 
+	{
+		std::cout << "----- INT MULTIMAPS -----" << std::endl << std::endl;
+		ft::multimap<int, int>				mm1;
+
+		for (int i = 0; i < NBR; i++)
+			mm1.insert(ft::make_pair(i % 100, i));
+
+		ft::multimap<int, int>				mm2(mm1);
+
+		std::cout << "--- Capacity functions ---" << std::endl;
+		std::cout << "mm2.size()		\x1b[24G= " << mm2.size() << std::endl;
+		std::cout << "mm2.count(42)		\x1b[24G= " << mm2.count(42) << std::endl;
+		std::cout << "mm2.count(100)		\x1b[24G= " << mm2.count(100) << std::endl << std::endl;
+
+		std::cout << "--- Modifier functions ---" << std::endl;
+		mm1.clear();
+		mm1.insert(ft::make_pair(19, 42));
+		mm1.insert(ft::make_pair(42, 1337));
+		mm1.insert(ft::make_pair(19, 0));
+		mm1.insert(mm1.find(42), ft::make_pair(42, 19));
+		mm1.insert(mm1.end(), ft::make_pair(1337, 19));
+
+		for (ft::multimap<int, int>::iterator it = mm1.begin(); it != mm1.end(); it++)
+			std::cout << "mm1[" << it->first << "]	\x1b[12G= " << it->second << std::endl;
+
+		std::cout << "mm1.erase(19)		\x1b[24G= " << mm1.erase(19) << std::endl;
+		std::cout << "mm2.erase(0)		\x1b[24G= " << mm2.erase(0) << std::endl;
+		mm1.find(42)->second = 0;
+		mm1.erase(mm1.upper_bound(42));
+
+		for (ft::multimap<int, int>::iterator it = mm1.begin(); it != mm1.end(); it++)
+			std::cout << "mm1[" << it->first << "]	\x1b[12G= " << it->second << std::endl;
+		std::cout << "mm2.size()		\x1b[24G= " << mm2.size() << std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT BTREE MAPS -----" << std::endl << std::endl;
+		ft::map<int, int>				bt1;
+
+		for (int i = 0; i < NBR; i++)
+			bt1[(i * 7919) % NBR] = i;
+
+		ft::map<int, int>				bt2(bt1);
+
+		std::cout << "--- Capacity functions ---" << std::endl;
+		std::cout << "bt1.size()		\x1b[24G= " << bt1.size() << std::endl;
+		std::cout << "bt1.count(42)		\x1b[24G= " << bt1.count(42) << std::endl;
+		std::cout << "bt1.count(NBR)		\x1b[24G= " << bt1.count(NBR) << std::endl << std::endl;
+
+		std::cout << "--- Modifier functions ---" << std::endl;
+		std::cout << "bt1.erase(42)		\x1b[24G= " << bt1.erase(42) << std::endl;
+		std::cout << "bt1.erase(42)		\x1b[24G= " << bt1.erase(42) << std::endl;
+		bt1.erase(bt1.lower_bound(100), bt1.upper_bound(NBR - 100));
+		bt1.insert(bt1.end(), ft::make_pair(NBR, 0));
+		bt1.insert(ft::make_pair(50, 0));
+		std::cout << "bt1.size()		\x1b[24G= " << bt1.size() << std::endl;
+
+		long	sum = 0;
+
+		for (ft::map<int, int>::iterator it = bt1.begin(); it != bt1.end(); it++)
+			sum += it->first + it->second;
+		std::cout << "sum			\x1b[24G= " << sum << std::endl;
+
+		ft::map<int, int>::reverse_iterator	it = bt1.rbegin();
+
+		for (int i = 0; i < 3; i++, it++)
+			std::cout << "bt1[" << it->first << "]	\x1b[12G= " << it->second << std::endl;
+		std::cout << std::endl;
+
+		std::cout << "--- Operations ---" << std::endl;
+		std::cout << "bt1.lower_bound(99)	\x1b[24G= " << bt1.lower_bound(99)->first << std::endl;
+		std::cout << "bt1.upper_bound(99)	\x1b[24G= " << bt1.upper_bound(99)->first << std::endl;
+		std::cout << "bt1.find(500) == end	\x1b[24G= " << (bt1.find(500) == bt1.end()) << std::endl;
+		std::cout << "bt2[500]		\x1b[24G= " << bt2[500] << std::endl;
+		std::cout << "bt1 < bt2		\x1b[24G= " << (bt1 < bt2) << std::endl;
+		bt2.clear();
+		std::cout << "bt2.empty()		\x1b[24G= " << bt2.empty() << std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT FLAT MAPS -----" << std::endl << std::endl;
+		ft::map<int, int>				src;
+
+		for (int i = 0; i < NBR; i++)
+			src[(i * 7919) % NBR] = i;
+
+		ft::map<int, int>			fm1(src.begin(), src.end());
+		ft::pair<int, int>				batch[] = {ft::make_pair(NBR + 3, 1), ft::make_pair(-1, 2), ft::make_pair(42, 3), ft::make_pair(NBR + 1, 4), ft::make_pair(-1, 5)};
+
+		fm1.insert(batch, batch + 5);
+
+		ft::map<int, int>			fm2(fm1);
+
+		std::cout << "--- Capacity functions ---" << std::endl;
+		std::cout << "fm1.size()		\x1b[24G= " << fm1.size() << std::endl;
+		std::cout << "fm1.count(-1)		\x1b[24G= " << fm1.count(-1) << std::endl;
+		std::cout << "fm1.count(NBR)		\x1b[24G= " << fm1.count(NBR) << std::endl << std::endl;
+
+		std::cout << "--- Modifier functions ---" << std::endl;
+		std::cout << "fm1[-1]			\x1b[24G= " << fm1[-1] << std::endl;
+		std::cout << "fm1[42]			\x1b[24G= " << fm1[42] << std::endl;
+		std::cout << "fm1.erase(42)		\x1b[24G= " << fm1.erase(42) << std::endl;
+		std::cout << "fm1.erase(42)		\x1b[24G= " << fm1.erase(42) << std::endl;
+		fm1.erase(fm1.lower_bound(100), fm1.upper_bound(NBR - 100));
+		fm1.insert(fm1.end(), ft::make_pair(NBR + 5, 0));
+		fm1.insert(ft::make_pair(50, 0));
+		fm1[7] = 7;
+		std::cout << "fm1.size()		\x1b[24G= " << fm1.size() << std::endl;
+
+		long	sum = 0;
+
+		for (ft::map<int, int>::iterator it = fm1.begin(); it != fm1.end(); it++)
+			sum += it->first + it->second;
+		std::cout << "sum			\x1b[24G= " << sum << std::endl;
+
+		ft::map<int, int>::reverse_iterator	it = fm1.rbegin();
+
+		for (int i = 0; i < 3; i++, it++)
+			std::cout << "fm1[" << it->first << "]	\x1b[12G= " << it->second << std::endl;
+		std::cout << std::endl;
+
+		std::cout << "--- Operations ---" << std::endl;
+		std::cout << "fm1.lower_bound(99)	\x1b[24G= " << fm1.lower_bound(99)->first << std::endl;
+		std::cout << "fm1.upper_bound(99)	\x1b[24G= " << fm1.upper_bound(99)->first << std::endl;
+		std::cout << "fm1.find(500) == end	\x1b[24G= " << (fm1.find(500) == fm1.end()) << std::endl;
+		std::cout << "fm2[500]		\x1b[24G= " << fm2[500] << std::endl;
+		std::cout << "fm1 < fm2		\x1b[24G= " << (fm1 < fm2) << std::endl;
+		std::cout << "fm1 == fm1		\x1b[24G= " << (fm1 == fm1) << std::endl;
+		fm2.clear();
+		std::cout << "fm2.empty()		\x1b[24G= " << fm2.empty() << std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT UNORDERED MAPS -----" << std::endl << std::endl;
+		ft::map<int, int>				um1;
+
+		for (int i = 0; i < NBR; i++)
+			um1[i * 1024] = i;
+
+		ft::map<int, int>				um2(um1);
+
+		std::cout << "--- Capacity functions ---" << std::endl;
+		std::cout << "um1.size()		\x1b[24G= " << um1.size() << std::endl;
+		std::cout << "um1.count(1024)		\x1b[24G= " << um1.count(1024) << std::endl;
+		std::cout << "um1.count(1000)		\x1b[24G= " << um1.count(1000) << std::endl << std::endl;
+
+		std::cout << "--- Modifier functions ---" << std::endl;
+		std::cout << "um1.erase(0)		\x1b[24G= " << um1.erase(0) << std::endl;
+		std::cout << "um1.erase(0)		\x1b[24G= " << um1.erase(0) << std::endl;
+		for (int i = 0; i < NBR; i += 2)
+			um1.erase(i * 1024);
+		std::cout << "um1.insert(-1)		\x1b[24G= " << um1.insert(ft::make_pair(-1, 7)).second << std::endl;
+		std::cout << "um1.insert(-1)		\x1b[24G= " << um1.insert(ft::make_pair(-1, 8)).second << std::endl;
+		um1.erase(um1.find(1024));
+		std::cout << "um1.size()		\x1b[24G= " << um1.size() << std::endl;
+
+		long	sum = 0;
+
+		for (ft::map<int, int>::iterator it = um1.begin(); it != um1.end(); it++)
+			sum += it->first / 1024 + it->second;
+		std::cout << "sum			\x1b[24G= " << sum << std::endl << std::endl;
+
+		std::cout << "--- Operations ---" << std::endl;
+		std::cout << "um1.find(3072)->second	\x1b[24G= " << um1.find(3072)->second << std::endl;
+		std::cout << "um1.find(2048) == end	\x1b[24G= " << (um1.find(2048) == um1.end()) << std::endl;
+		std::cout << "um2[2048]		\x1b[24G= " << um2[2048] << std::endl;
+		std::cout << "um1 == um2		\x1b[24G= " << (um1 == um2) << std::endl;
+		um2 = um1;
+		std::cout << "um1 == um2		\x1b[24G= " << (um1 == um2) << std::endl;
+		um2.clear();
+		std::cout << "um2.empty()		\x1b[24G= " << um2.empty() << std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT STATIC INDEXES -----" << std::endl << std::endl;
+		ft::map<int, int>				src;
+
+		for (int i = 0; i < NBR; i++)
+			src[(i * 7919) % NBR * 2] = i;
+
+		const ft::map<int, int>		si1(src);
+		ft::map<int, int>				si2(si1);
+
+		std::cout << "--- Capacity functions ---" << std::endl;
+		std::cout << "si1.size()		\x1b[24G= " << si1.size() << std::endl;
+		std::cout << "si1.count(42)		\x1b[24G= " << si1.count(42) << std::endl;
+		std::cout << "si1.count(43)		\x1b[24G= " << si1.count(43) << std::endl << std::endl;
+
+		std::cout << "--- Operations ---" << std::endl;
+		std::cout << "si1.lower_bound(99)	\x1b[24G= " << si1.lower_bound(99)->first << std::endl;
+		std::cout << "si1.upper_bound(100)	\x1b[24G= " << si1.upper_bound(100)->first << std::endl;
+		std::cout << "si1.find(500)->second	\x1b[24G= " << si1.find(500)->second << std::endl;
+		std::cout << "si1.find(501) == end	\x1b[24G= " << (si1.find(501) == si1.end()) << std::endl;
+		std::cout << "lower_bound(-1) == begin	\x1b[24G= " << (si1.lower_bound(-1) == si1.begin()) << std::endl;
+		std::cout << "lower_bound(2 * NBR) == end	\x1b[24G= " << (si1.lower_bound(2 * NBR) == si1.end()) << std::endl;
+
+		long	sum = 0;
+
+		for (ft::map<int, int>::const_iterator it = si2.begin(); it != si2.end(); it++)
+			sum += it->first + it->second;
+		std::cout << "sum			\x1b[24G= " << sum << std::endl;
+
+		ft::map<int, int>::const_reverse_iterator	it = si1.rbegin();
+
+		for (int i = 0; i < 3; i++, it++)
+			std::cout << "si1[" << it->first << "]	\x1b[12G= " << it->second << std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT MAP BATCH LOOKUPS -----" << std::endl << std::endl;
+		ft::map<int, int>				bm;
+		int								keys[] = {42, -1, 7, 99999, 42, 100000, 0, 31337};
+		ft::map<int, int>::iterator		found[8];
+
+		for (int i = 0; i < NBR; i++)
+			bm[(i * 7919) % NBR] = i;
+		for (int i = 0; i < 8; i++)
+			found[i] = bm.find(keys[i]);
+
+		for (int i = 0; i < 8; i++)
+		{
+			std::cout << "find(" << keys[i] << ")	\x1b[24G= ";
+			if (found[i] == bm.end())
+				std::cout << "end" << std::endl;
+			else
+				std::cout << found[i]->second << std::endl;
+		}
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT CONCURRENT MAPS -----" << std::endl << std::endl;
+		ft::map<int, int>				cm;
+		int								value = 0;
+
+		for (int i = 0; i < NBR; i++)
+			cm.insert(ft::make_pair((i * 7919) % NBR, i));
+		for (int i = 0; i < NBR; i += 3)
+			cm.erase(i);
+		cm[42] = -42;
+		cm[126] = 126;
+
+		const ft::map<int, int>			snap(cm);
+
+		cm.erase(1);
+		value = cm.find(42)->second;
+
+		std::cout << "cm.size()		\x1b[24G= " << cm.size() << std::endl;
+		std::cout << "cm.count(1)		\x1b[24G= " << cm.count(1) << std::endl;
+		std::cout << "cm.count(126)		\x1b[24G= " << cm.count(126) << std::endl;
+		std::cout << "cm[42]			\x1b[24G= " << value << std::endl;
+		std::cout << "snap.size()		\x1b[24G= " << snap.size() << std::endl;
+		std::cout << "snap[1]			\x1b[24G= " << snap.find(1)->second << std::endl;
+		std::cout << "snap.count(3)		\x1b[24G= " << snap.count(3) << std::endl;
+		cm.clear();
+		std::cout << "cm.empty()		\x1b[24G= " << cm.empty() << std::endl;
+		std::cout << "snap.empty()		\x1b[24G= " << snap.empty() << std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT PERSISTENT MAPS -----" << std::endl << std::endl;
+		ft::map<int, int>				v0;
+
+		for (int i = 0; i < NBR; i++)
+			v0[(i * 7919) % NBR] = i;
+
+		ft::map<int, int>				v1(v0);
+
+		v1[42] = -42;
+
+		ft::map<int, int>				v2(v1);
+
+		v2.erase(7);
+
+		ft::map<int, int>				v3(v2);
+
+		v3.erase(-1);
+
+		std::cout << "v0.size()		\x1b[24G= " << v0.size() << std::endl;
+		std::cout << "v2.size()		\x1b[24G= " << v2.size() << std::endl;
+		std::cout << "v3 == v2		\x1b[24G= " << (v3 == v2) << std::endl;
+		std::cout << "v1 == v0		\x1b[24G= " << (v1 == v0) << std::endl;
+		std::cout << "v0[42]			\x1b[24G= " << v0.find(42)->second << std::endl;
+		std::cout << "v1[42]			\x1b[24G= " << v1.find(42)->second << std::endl;
+		std::cout << "v1.count(7)		\x1b[24G= " << v1.count(7) << std::endl;
+		std::cout << "v2.count(7)		\x1b[24G= " << v2.count(7) << std::endl;
+		std::cout << "v2.lower_bound(7)	\x1b[24G= " << v2.lower_bound(7)->first << std::endl;
+		std::cout << "v2.upper_bound(8)	\x1b[24G= " << v2.upper_bound(8)->first << std::endl;
+
+		long	sum = 0;
+
+		for (ft::map<int, int>::const_iterator it = v2.begin(); it != v2.end(); it++)
+			sum += it->first + it->second;
+		std::cout << "sum			\x1b[24G= " << sum << std::endl;
+
+		ft::map<int, int>::const_reverse_iterator	it = v1.rbegin();
+
+		for (int i = 0; i < 3; i++, it++)
+			std::cout << "v1[" << it->first << "]	\x1b[12G= " << it->second << std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT SHARDED MAPS -----" << std::endl << std::endl;
+		ft::map<int, int>				sm;
+		int								value = 0;
+
+		for (int i = 0; i < NBR; i++)
+			sm.insert(ft::make_pair((i * 7919) % NBR, i));
+		for (int i = 0; i < NBR; i += 3)
+			sm.erase(i);
+		sm[42] = -42;
+		sm[126] = 126;
+		value = sm.find(42)->second;
+
+		std::cout << "sm.size()		\x1b[24G= " << sm.size() << std::endl;
+		std::cout << "sm.count(3)		\x1b[24G= " << sm.count(3) << std::endl;
+		std::cout << "sm.count(126)		\x1b[24G= " << sm.count(126) << std::endl;
+		std::cout << "sm[42]			\x1b[24G= " << value << std::endl;
+		std::cout << "ordered sum		\x1b[24G= " << std::for_each(sm.begin(), sm.end(), element_sum()).sum << std::endl;
+		sm.clear();
+		std::cout << "sm.empty()		\x1b[24G= " << sm.empty() << std::endl;
+
+		ft::map<int, int, direction_less>						dm(direction_less(true));
+
+		for (int i = 0; i < 1000; i++)
+			dm.insert(ft::make_pair((i * 7919) % 1000, i));
+		std::cout << "descending sum		\x1b[24G= " << std::for_each(dm.begin(), dm.end(), element_sum()).sum << std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT CONCURRENT SKIPLIST MAPS -----" << std::endl << std::endl;
+		ft::map<int, int>				sl;
+		int								value = 0;
+
+		for (int i = 0; i < NBR; i++)
+			sl.insert(ft::make_pair((i * 7919) % NBR, i));
+		for (int i = 0; i < NBR; i += 3)
+			sl.erase(i);
+		sl.insert(ft::make_pair(42, -42));
+		sl.insert(ft::make_pair(126, 126));
+		value = sl.find(43)->second;
+
+		std::cout << "sl.size()		\x1b[24G= " << sl.size() << std::endl;
+		std::cout << "sl.count(3)		\x1b[24G= " << sl.count(3) << std::endl;
+		std::cout << "sl.count(126)		\x1b[24G= " << sl.count(126) << std::endl;
+		std::cout << "sl[43]			\x1b[24G= " << value << std::endl;
+		std::cout << "sl.lower_bound(99)	\x1b[24G= " << sl.lower_bound(99)->first << std::endl;
+		std::cout << "sl.upper_bound(100)	\x1b[24G= " << sl.upper_bound(100)->first << std::endl;
+		std::cout << "sl.find(3) == end	\x1b[24G= " << (sl.find(3) == sl.end()) << std::endl;
+
+		element_sum						sum;
+
+		for (ft::map<int, int>::const_iterator it = sl.begin(); it != sl.end(); it++)
+			sum(*it);
+		std::cout << "ordered sum		\x1b[24G= " << sum.sum << std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT MAP ITERATOR CONVERSIONS -----" << std::endl << std::endl;
+		ft::map<int, int>						mp1;
+		ft::multimap<int, int>					mmp1;
+
+		for (int i = 0; i < 10; i++)
+		{
+			mp1[i] = i * 2;
+			mmp1.insert(ft::make_pair(i % 3, i));
+		}
+
+		ft::map<int, int>::iterator				it = mp1.begin();
+		ft::map<int, int>::const_iterator		cit = it;
+		ft::map<int, int>::const_reverse_iterator	crit = mp1.rbegin();
+		ft::multimap<int, int>::const_iterator	mcit = mmp1.begin();
+		ft::multimap<int, int>::const_reverse_iterator	mcrit = mmp1.rbegin();
+
+		cit = mp1.find(4);
+		std::cout << "cit->second	\x1b[16G= " << cit->second	<< std::endl;
+		std::cout << "crit->first	\x1b[16G= " << crit->first	<< std::endl;
+		std::cout << "it == cit	\x1b[16G= " << (it == cit)	<< std::endl;
+		std::cout << "mcit->second	\x1b[16G= " << mcit->second	<< std::endl;
+		std::cout << "mcrit->second	\x1b[16G= " << mcrit->second	<< std::endl;
+
+		const ft::map<int, int>&				cmp1 = mp1;
+
+		for (crit = mp1.rbegin(); crit != cmp1.rend(); ++crit)
+			std::cout << crit->first << " ";
+		std::cout << std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT MAP DISTANCES -----" << std::endl << std::endl;
+		ft::map<int, int>						mp1;
+
+		for (int i = 0; i < 1000; i++)
+			mp1[i * 3] = i;
+
+		const ft::map<int, int>&				cmp1 = mp1;
+		ft::map<int, int>::iterator				it = mp1.begin();
+		ft::map<int, int>::const_iterator		cit = cmp1.end();
+		ft::map<int, int>::reverse_iterator		rit = mp1.rbegin();
+		ft::map<int, int>::const_reverse_iterator	crit = cmp1.rend();
+
+		ft::advance(it, 500);
+		std::cout << "advance(it, 500)	\x1b[16G= " << it->first	<< std::endl;
+		ft::advance(it, -250);
+		std::cout << "advance(it, -250)	\x1b[16G= " << it->first	<< std::endl;
+		ft::advance(it, 750);
+		std::cout << "it == end()	\x1b[16G= " << (it == mp1.end())	<< std::endl;
+		ft::advance(it, -1);
+		std::cout << "advance(end, -1)	\x1b[16G= " << it->first	<< std::endl;
+		ft::advance(it, -999);
+		std::cout << "it == begin()	\x1b[16G= " << (it == mp1.begin())	<< std::endl;
+		ft::advance(cit, -10);
+		std::cout << "advance(cit, -10)	\x1b[16G= " << cit->first	<< std::endl;
+		ft::advance(rit, 10);
+		std::cout << "advance(rit, 10)	\x1b[16G= " << rit->first	<< std::endl;
+		ft::advance(rit, 990);
+		std::cout << "rit == rend()	\x1b[16G= " << (rit == mp1.rend())	<< std::endl;
+		ft::advance(crit, -3);
+		std::cout << "advance(crit, -3)	\x1b[16G= " << crit->first	<< std::endl;
+
+		std::cout << "distance(begin, end)	\x1b[16G= " << ft::distance(mp1.begin(), mp1.end())		<< std::endl;
+		std::cout << "distance(30, 300)	\x1b[16G= " << ft::distance(mp1.find(30), mp1.find(300))	<< std::endl;
+		std::cout << "distance(cit, cend)	\x1b[16G= " << ft::distance(cit, cmp1.end())			<< std::endl;
+		std::cout << "distance(rbegin, rend)	\x1b[16G= " << ft::distance(mp1.rbegin(), mp1.rend())	<< std::endl;
+		std::cout << "distance(crit, crend)	\x1b[16G= " << ft::distance(crit, cmp1.rend())			<< std::endl;
+		std::cout << "distance(empty)	\x1b[16G= " << ft::distance(mp1.end(), mp1.end())		<< std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT MAP AGGREGATES -----" << std::endl << std::endl;
+		sum_map									mp1;
+		unsigned long							seed = 42;
+
+		for (int i = 0; i < NBR / 10; i++)
+		{
+			seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+
+			int									key = static_cast<int>((seed >> 33) % 5000);
+
+			if ((seed >> 20) % 4)
+				mp1[key] = static_cast<int>((seed >> 40) % 1000) - 500;
+			else
+				mp1.erase(key);
+		}
+
+		const sum_map&							cmp1 = mp1;
+		sum_map::iterator						it = mp1.begin();
+		sum_map::const_iterator					cit = it;
+		long									sum = 0;
+
+		for (; cit != cmp1.end(); ++cit)
+			sum += cit->second;
+
+		std::cout << "mp1.size()	\x1b[16G= " << mp1.size()			<< std::endl;
+		std::cout << "iterated sum	\x1b[16G= " << sum				<< std::endl;
+		std::cout << "aggregate()	\x1b[16G= " << total_sum(mp1)		<< std::endl;
+		for (int lo = -100; lo < 5100; lo += 700)
+			std::cout << "[" << lo << ", " << lo + 1234 << ")	\x1b[16G= " << range_sum(mp1, lo, lo + 1234)	<< std::endl;
+		std::cout << "[42, 42)	\x1b[16G= " << range_sum(mp1, 42, 42)		<< std::endl;
+		std::cout << "[43, 42)	\x1b[16G= " << range_sum(mp1, 43, 42)		<< std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- STRING FLAT MAPS -----" << std::endl << std::endl;
+		std::string								prefix("a key long enough to live on the heap ");
+		ft::map<std::string, int>			fm1;
+
+		for (int i = 0; i < 200; i++)
+		{
+			int									j = (i * 7919) % 676;
+
+			fm1.insert(ft::make_pair(prefix + static_cast<char>('a' + j / 26) + static_cast<char>('a' + j % 26), i));
+		}
+
+		std::cout << "fm1.size()		\x1b[24G= " << fm1.size() << std::endl;
+		std::cout << "fm1.erase(\"..aa\")	\x1b[24G= " << fm1.erase(prefix + "aa") << std::endl;
+		fm1.erase(fm1.lower_bound(prefix + "c"), fm1.lower_bound(prefix + "f"));
+		fm1.erase(fm1.begin());
+		fm1[prefix + "mm!"] = -1;
+		std::cout << "fm1.size()		\x1b[24G= " << fm1.size() << std::endl;
+
+		ft::map<std::string, int>			fm2(fm1);
+		ft::map<std::string, int>			fm3;
+
+		fm3 = fm1;
+		fm3.insert(ft::make_pair(std::string("short"), 7));
+		fm2 = fm3;
+		fm3.erase(fm3.find(prefix + "mm!"));
+
+		long									sum = 0;
+
+		for (ft::map<std::string, int>::iterator it = fm2.begin(); it != fm2.end(); it++)
+			sum += it->second * static_cast<long>(it->first.size() + it->first[it->first.size() - 1]);
+		std::cout << "sum			\x1b[24G= " << sum << std::endl;
+		std::cout << "fm2.begin()->first	\x1b[24G= " << fm2.begin()->first << std::endl;
+		std::cout << "fm2.rbegin()->first	\x1b[24G= " << fm2.rbegin()->first << std::endl;
+		std::cout << "fm2.size()		\x1b[24G= " << fm2.size() << std::endl;
+		std::cout << "fm3.size()		\x1b[24G= " << fm3.size() << std::endl;
+		std::cout << "fm1 == fm2		\x1b[24G= " << (fm1 == fm2) << std::endl;
+		std::cout << "fm1 < fm3		\x1b[24G= " << (fm1 < fm3) << std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INTERVAL MAPS -----" << std::endl << std::endl;
+		typedef ft::map<ft::pair<int, int>, int>	interval_map;
+
+		interval_map							im;
+		unsigned long							seed = 7;
+
+		for (int i = 0; i < 3000; i++)
+		{
+			seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+
+			int									lo = static_cast<int>((seed >> 33) % 10000);
+			int									hi = lo + 1 + static_cast<int>((seed >> 20) % 300);
+
+			if ((seed >> 50) % 5)
+				im.insert(ft::make_pair(ft::make_pair(lo, hi), i));
+			else
+				im.erase(im.lower_bound(ft::make_pair(lo, 0)), im.lower_bound(ft::make_pair(lo + 50, 0)));
+		}
+
+		size_t									overlaps = 0;
+		size_t									stabs = 0;
+		size_t									found = 0;
+
+		for (int q = 0; q < 200; q++)
+		{
+			seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+
+			int									lo = static_cast<int>((seed >> 33) % 10400) - 200;
+			int									hi = lo + static_cast<int>((seed >> 20) % 400);
+			size_t								overlap = 0;
+
+			for (interval_map::const_iterator it = im.begin(); it != im.end(); it++)
+			{
+				overlap += it->first.first < hi && lo < it->first.second;
+				stabs += it->first.first <= lo && lo < it->first.second;
+			}
+			overlaps += overlap;
+			found += overlap != 0;
+		}
+
+		std::cout << "im.size()		\x1b[24G= " << im.size()		<< std::endl;
+		std::cout << "overlapping		\x1b[24G= " << overlaps		<< std::endl;
+		std::cout << "stabbing		\x1b[24G= " << stabs			<< std::endl;
+		std::cout << "find_overlap		\x1b[24G= " << found			<< std::endl;
+		std::cout << "mismatches		\x1b[24G= " << 0				<< std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT MAP SPLITS AND SPLICES -----" << std::endl << std::endl;
+		ft::map<int, int>						base;
+
+		for (int i = 0; i < 1000; i++)
+			base[i * 3] = i;
+
+		int										keys[] = {0, 2997, 1500, 1501, 5000};
+
+		for (int i = 0; i < 5; i++)
+		{
+			ft::map<int, int>					mp1(base);
+			ft::map<int, int>					mp2;
+
+			mp2[-7] = 7;
+			split_off(mp1, keys[i], mp2);
+			std::cout << "split_off(" << keys[i] << ")" << std::endl;
+			print_summary("mp1", mp1);
+			print_summary("mp2", mp2);
+		}
+
+		ft::map<int, int>						mp1(base);
+		ft::map<int, int>						mp2;
+		ft::map<int, int>						mp3;
+
+		split_off(mp1, 1500, mp1);
+		std::cout << "split_off(1500) into itself" << std::endl;
+		print_summary("mp1", mp1);
+
+		split_off(mp1, 1500, mp2);
+		for (int i = 0; i < 1000; i++)
+			mp3[i * 3 + 1] = -i;
+		mp3[2100] = 42;
+
+		splice_range(mp1, mp2, 2000, 2000);
+		std::cout << "splice_range(mp2, 2000, 2000)" << std::endl;
+		print_summary("mp1", mp1);
+		print_summary("mp2", mp2);
+		splice_range(mp1, mp2, 1, 3);
+		std::cout << "splice_range(mp2, 1, 3)" << std::endl;
+		print_summary("mp1", mp1);
+		print_summary("mp2", mp2);
+		splice_range(mp1, mp2, 2000, 2500);
+		std::cout << "splice_range(mp2, 2000, 2500)" << std::endl;
+		print_summary("mp1", mp1);
+		print_summary("mp2", mp2);
+		splice_range(mp1, mp3, 2050, 2200);
+		std::cout << "splice_range(mp3, 2050, 2200)" << std::endl;
+		print_summary("mp1", mp1);
+		print_summary("mp3", mp3);
+		std::cout << "mp1[2100]		\x1b[16G= " << mp1[2100] << std::endl;
+		std::cout << "mp3.count(2100)	\x1b[16G= " << mp3.count(2100) << std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT MAP MERGES -----" << std::endl << std::endl;
+		ft::map<int, int>						evens;
+		ft::map<int, int>						thirds;
+		ft::map<int, int>						far;
+
+		for (int i = 0; i < 500; i++)
+		{
+			evens[i * 2] = i;
+			thirds[i * 3] = -i;
+			far[10000 + i] = i;
+		}
+
+		ft::map<int, int>						mp1(evens);
+		ft::map<int, int>						mp2(thirds);
+
+		merge(mp1, mp2);
+		std::cout << "overlapping" << std::endl;
+		print_summary("mp1", mp1);
+		print_summary("mp2", mp2);
+		std::cout << "mp1[6]			\x1b[16G= " << mp1[6] << std::endl;
+		std::cout << "mp2[6]			\x1b[16G= " << mp2[6] << std::endl;
+
+		mp1 = far;
+		mp2 = evens;
+		merge(mp1, mp2);
+		std::cout << "disjoint" << std::endl;
+		print_summary("mp1", mp1);
+		print_summary("mp2", mp2);
+
+		mp2.clear();
+		merge(mp1, mp2);
+		std::cout << "empty source" << std::endl;
+		print_summary("mp1", mp1);
+		print_summary("mp2", mp2);
+
+		merge(mp2, mp1);
+		std::cout << "empty destination" << std::endl;
+		print_summary("mp1", mp1);
+		print_summary("mp2", mp2);
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT MAP NODE HANDLES -----" << std::endl << std::endl;
+		typedef node_handle								node_type;
+		typedef node_insert_return							insert_return_type;
+
+		ft::map<int, int>						mp1;
+		ft::map<int, int>						mp2;
+
+		for (int i = 0; i < 10; i++)
+			mp1[i] = i * 10;
+		mp2[5] = -5;
+
+		node_type								nh1 = extract(mp1, mp1.find(3));
+
+		std::cout << "--- extract and reinsert elsewhere ---" << std::endl;
+		std::cout << "nh1.empty()		\x1b[24G= " << nh1.empty() << std::endl;
+		std::cout << "nh1.key()		\x1b[24G= " << nh1.key() << std::endl;
+		std::cout << "nh1.mapped()		\x1b[24G= " << nh1.mapped() << std::endl;
+		std::cout << "mp1.count(3)		\x1b[24G= " << mp1.count(3) << std::endl;
+		nh1.key() = 30;
+
+		insert_return_type						ret1 = insert(mp2, nh1);
+
+		std::cout << "ret1.inserted		\x1b[24G= " << ret1.inserted << std::endl;
+		std::cout << "ret1.position		\x1b[24G= " << ret1.position->first << " -> " << ret1.position->second << std::endl;
+		std::cout << "ret1.node.empty()	\x1b[24G= " << ret1.node.empty() << std::endl;
+		std::cout << "nh1.empty()		\x1b[24G= " << nh1.empty() << std::endl;
+
+		node_type								nh2 = extract(mp1, 5);
+		insert_return_type						ret2 = insert(mp2, nh2);
+
+		std::cout << "--- insert over an existing key ---" << std::endl;
+		std::cout << "ret2.inserted		\x1b[24G= " << ret2.inserted << std::endl;
+		std::cout << "ret2.position		\x1b[24G= " << ret2.position->first << " -> " << ret2.position->second << std::endl;
+		std::cout << "ret2.node.empty()	\x1b[24G= " << ret2.node.empty() << std::endl;
+		std::cout << "ret2.node.key()		\x1b[24G= " << ret2.node.key() << std::endl;
+		std::cout << "ret2.node.mapped()	\x1b[24G= " << ret2.node.mapped() << std::endl;
+
+		insert_return_type						ret3 = insert(mp1, ret2.node);
+
+		std::cout << "ret3.inserted		\x1b[24G= " << ret3.inserted << std::endl;
+		std::cout << "ret3.node.empty()	\x1b[24G= " << ret3.node.empty() << std::endl;
+		std::cout << "ret2.node.empty()	\x1b[24G= " << ret2.node.empty() << std::endl;
+
+		node_type								nh4 = extract(mp1, 42);
+		insert_return_type						ret4 = insert(mp1, nh4);
+
+		std::cout << "--- empty handle ---" << std::endl;
+		std::cout << "nh4.empty()		\x1b[24G= " << nh4.empty() << std::endl;
+		std::cout << "ret4.inserted		\x1b[24G= " << ret4.inserted << std::endl;
+		std::cout << "ret4.position == end	\x1b[24G= " << (ret4.position == mp1.end()) << std::endl;
+		std::cout << "ret4.node.empty()	\x1b[24G= " << ret4.node.empty() << std::endl;
+
+		node_type								nh5 = extract(mp1, mp1.begin());
+		ft::map<int, int>::iterator				it = insert(mp2, mp2.end(), nh5);
+
+		std::cout << "--- insert with hint ---" << std::endl;
+		std::cout << "it->first		\x1b[24G= " << it->first << std::endl;
+		print_summary("mp1", mp1);
+		print_summary("mp2", mp2);
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT CONCURRENT SKIPLIST MAPS, 4 THREADS -----" << std::endl << std::endl;
+		ft::map<int, int>										sl;
+		int														failures = 0;
+
+		for (int i = 0; i < 4; i++)
+		{
+			for (int k = i * 10000; k < i * 10000 + 3000; k++)
+				failures += !sl.insert(ft::make_pair(k, k * 2)).second;
+			for (int k = i * 10000; k < i * 10000 + 3000; k += 3)
+				failures += sl.erase(k) != 1;
+		}
+
+		long													sum = 0;
+		size_t													n = 0;
+		bool													sorted = true;
+		int														prev = -1;
+
+		for (ft::map<int, int>::const_iterator it = sl.begin(); it != sl.end(); ++it, ++n)
+		{
+			sorted = sorted && prev < it->first && it->second == it->first * 2 && (it->first % 10000) % 3;
+			prev = it->first;
+			sum += it->first;
+		}
+
+		std::cout << "failures		\x1b[24G= " << failures << std::endl;
+		std::cout << "sl.size()		\x1b[24G= " << sl.size() << std::endl;
+		std::cout << "iterated		\x1b[24G= " << n << std::endl;
+		std::cout << "sorted			\x1b[24G= " << sorted << std::endl;
+		std::cout << "key sum			\x1b[24G= " << sum << std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT MULTIMAPS WITH A STATEFUL COMPARATOR -----" << std::endl << std::endl;
+		ft::multimap<int, int, direction_less>	mm1((direction_less(true)));
+		ft::multimap<int, int, direction_less>	mm2;
+
+		for (int i = 0; i < 10; i++)
+			mm1.insert(ft::make_pair(i % 4, i));
+		mm2 = mm1;
+		mm2.insert(ft::make_pair(9, -1));
+		mm2.insert(ft::make_pair(1, -1));
+
+		std::cout << "mm2		\x1b[16G=";
+		for (ft::multimap<int, int, direction_less>::iterator it = mm2.begin(); it != mm2.end(); ++it)
+			std::cout << " " << it->first << ":" << it->second;
+		std::cout << std::endl;
+		std::cout << "mm2.count(1)	\x1b[16G= " << mm2.count(1) << std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- MAP SPLITS WITHOUT DEFAULT CONSTRUCTED VALUES -----" << std::endl << std::endl;
+		ft::map<int, counted>						mp1;
+		ft::map<int, counted>						mp2;
+		ft::map<int, counted>						mp3;
+		int											before;
+
+		for (int i = 0; i < 100; i++)
+			mp1.insert(ft::make_pair(i * 2, counted(-i)));
+		before = counted::defaults;
+		split_off(mp1, 101, mp2);
+		std::cout << "default constructions: " << counted::defaults - before << std::endl;
+		splice_range(mp3, mp2, 120, 150);
+		std::cout << "mp1.size() = " << mp1.size() << " sum " << counted_sum(mp1) << std::endl;
+		std::cout << "mp2.size() = " << mp2.size() << " sum " << counted_sum(mp2) << std::endl;
+		std::cout << "mp3.size() = " << mp3.size() << " sum " << counted_sum(mp3) << std::endl;
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INTERVAL MAPS WITH A STATEFUL COMPARATOR -----" << std::endl << std::endl;
+		typedef ft::map<ft::pair<int, int>, int>	desc_map;
+
+		desc_map								im;
+		desc_map								copy;
+		size_t									overlaps = 0;
+		size_t									stabs = 0;
+		size_t									found = 0;
+
+		for (int i = 0; i < 200; i++)
+			im.insert(ft::make_pair(ft::make_pair(-(i * 7 % 500), -(i * 7 % 500) - 1 - i % 40), i));
+		copy = im;
+
+		for (int q = 0; q < 50; q++)
+		{
+			size_t								overlap = 0;
+
+			for (desc_map::const_iterator it = copy.begin(); it != copy.end(); it++)
+			{
+				overlap += it->first.first > -q * 11 - 30 && -q * 11 > it->first.second;
+				stabs += it->first.first >= -q * 11 && -q * 11 > it->first.second;
+			}
+			overlaps += overlap;
+			found += overlap != 0;
+		}
+
+		std::cout << "copy.size()		\x1b[24G= " << copy.size()					<< std::endl;
+		std::cout << "first interval	\x1b[24G= " << copy.rbegin()->first.first	<< std::endl;
+		std::cout << "overlapping		\x1b[24G= " << overlaps						<< std::endl;
+		std::cout << "stabbing		\x1b[24G= " << stabs							<< std::endl;
+		std::cout << "find_overlap		\x1b[24G= " << found							<< std::endl;
+
+		std::cout << std::endl;
+	}
+
 	gettimeofday(&end, 0);
 	long	seconds		= end.tv_sec - begin.tv_sec;
 	long	useconds	= end.tv_usec - begin.tv_usec;
@@ -0,0 +1,283 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   std_queue.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:07:20 by hcremers          #+#    #+#             */
+/*   Updated: 2026/10/19 10:52:32 by hcremers         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <vector>
+namespace ft = std;
+
+#include <iostream>
+#include <sys/time.h>
+
+#define NBR 100000
+
+void	std_queue()
+{
+	struct timeval	begin, end;
+	gettimeofday(&begin, 0);
+
+	{
+		std::cout << "----- INT QUEUES -----" << std::endl << std::endl;
+		ft::queue<int>					que1;
+
+		for (int i = 0; i < NBR; i++)
+		{
+			que1.push(i);
+			if (i % 3 == 0)
+				que1.pop();
+		}
+
+		ft::queue<int>					que2;
+
+		que2.push(42);
+		que2.push(19);
+		que2.push(1337);
+
+		ft::queue<int>					que3(que1);
+
+		std::cout << "--- Capacity functions ---" << std::endl;
+		std::cout << "que1.size() 	\x1b[16G= " << que1.size()	<< std::endl;
+		std::cout << "que1.empty()	\x1b[16G= " << que1.empty()	<< std::endl;
+		std::cout << "que1.front()	\x1b[16G= " << que1.front()	<< std::endl;
+		std::cout << "que1.back()	\x1b[16G= " << que1.back()	<< std::endl << std::endl;
+
+		std::cout << "que2.size() 	\x1b[16G= " << que2.size()	<< std::endl;
+		std::cout << "que2.empty()	\x1b[16G= " << que2.empty()	<< std::endl << std::endl;
+
+		std::cout << "--- Relational operators ---" << std::endl;
+		std::cout << "que1 == que3	\x1b[16G= " << (que1 == que3)	<< std::endl;
+		que3.pop();
+		std::cout << "que1 == que3	\x1b[16G= " << (que1 == que3)	<< std::endl;
+		std::cout << "que1 < que3	\x1b[16G= " << (que1 < que3)	<< std::endl;
+		std::cout << "que1 >= que2	\x1b[16G= " << (que1 >= que2)	<< std::endl << std::endl;
+
+		while (que2.size())
+		{
+			std::cout << "que2.front()	\x1b[16G= " << que2.front()	<< std::endl;
+			que2.pop();
+		}
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- STRING QUEUES -----" << std::endl << std::endl;
+		ft::queue<std::string>					que1;
+
+		for (int i = 0; i < NBR; i++)
+			que1.push("i");
+
+		ft::queue<std::string>					que2;
+
+		que2.push("Forty-two");
+		que2.push("Nineteen");
+		que2.push("One thousand three hundreds thirty-seven");
+
+		std::cout << "--- Capacity functions ---" << std::endl;
+		std::cout << "que1.size()	\x1b[16G= " << que1.size()	<< std::endl;
+		std::cout << "que1.empty()	\x1b[16G= " << que1.empty()	<< std::endl << std::endl;
+
+		std::cout << "que2.size()	\x1b[16G= " << que2.size()	<< std::endl;
+		std::cout << "que2.back()	\x1b[16G= " << que2.back()	<< std::endl << std::endl;
+
+		while (que2.size())
+		{
+			std::cout << "que2.front()	\x1b[16G= " << que2.front()	<< std::endl;
+			que2.pop();
+		}
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT RING BUFFERS -----" << std::endl << std::endl;
+		ft::queue<int>							que1;
+		ft::queue<int>							que2;
+		int										batch[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+		unsigned long							sum = 0;
+
+		for (int i = 0; i < NBR; i++)
+		{
+			que1.push(i);
+			sum += i;
+		}
+		while (!que1.empty())
+			que1.pop();
+
+		std::cout << "que1 sum	\x1b[16G= " << sum			<< std::endl;
+		for (int i = 0; i < 8; i++)
+			que1.push(batch[i]);
+		std::cout << "que1.push_n()	\x1b[16G= " << 8			<< std::endl;
+		for (int i = 4; i < 8; que1.pop())
+			batch[i++] = que1.front();
+		std::cout << "que1.pop_n()	\x1b[16G= " << 4			<< std::endl;
+		std::cout << "batch[7]	\x1b[16G= " << batch[7]		<< std::endl;
+		std::cout << "que1.size()	\x1b[16G= " << que1.size()	<< std::endl << std::endl;
+
+		que2.push(42);
+		que2.push(19);
+		que2.push(1337);
+		que2.push(7);
+
+		bool									pushed = (que2.size() < 4);
+
+		std::cout << "que2.push(0)	\x1b[16G= " << pushed		<< std::endl;
+		std::cout << "que2.size()	\x1b[16G= " << que2.size()	<< std::endl;
+
+		for (; !que2.empty(); que2.pop())
+			std::cout << "que2.pop()	\x1b[16G= " << que2.front()	<< std::endl;
+		std::cout << "que2.empty()	\x1b[16G= " << que2.empty()	<< std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT PRIORITY QUEUES -----" << std::endl << std::endl;
+		ft::vector<int>							vct;
+
+		for (int i = 0; i < NBR; i++)
+			vct.push_back((i * 7919) % NBR);
+
+		ft::priority_queue<int>					que1(vct.begin(), vct.end());
+		ft::priority_queue<int, ft::vector<int>, std::greater<int> >	que2;
+		unsigned long							sum = 0;
+
+		for (int i = 0; i < 10; i++)
+			que2.push((i * 37) % 11);
+		while (que1.size() > 5)
+		{
+			sum += que1.top();
+			que1.pop();
+		}
+
+		std::cout << "que1 sum	\x1b[16G= " << sum			<< std::endl;
+		std::cout << "que1.size()	\x1b[16G= " << que1.size()	<< std::endl;
+		std::cout << "que1.top()	\x1b[16G= " << que1.top()	<< std::endl;
+		std::cout << "que2.size()	\x1b[16G= " << que2.size()	<< std::endl;
+
+		while (!que2.empty())
+		{
+			std::cout << "que2.top()	\x1b[16G= " << que2.top()	<< std::endl;
+			que2.pop();
+		}
+
+		std::cout << std::endl;
+		std::cout << "--- Heap functions ---" << std::endl;
+		ft::vector<std::string>					heap;
+
+		heap.push_back("Nineteen");
+		heap.push_back("Forty-two");
+		heap.push_back("One thousand three hundreds thirty-seven");
+		heap.push_back("Zero");
+		ft::make_heap(heap.begin(), heap.end());
+		heap.push_back("Ninety");
+		ft::push_heap(heap.begin(), heap.end());
+
+		while (!heap.empty())
+		{
+			std::cout << "heap.front()	\x1b[16G= " << heap.front()	<< std::endl;
+			ft::pop_heap(heap.begin(), heap.end());
+			heap.pop_back();
+		}
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT INDEXED HEAPS -----" << std::endl << std::endl;
+		ft::priority_queue<int>					heap;
+		ft::vector<int>							values;
+
+		for (int i = 0; i < NBR / 100; i++)
+			values.push_back((i * 7919) % 1000);
+		for (int i = 0; i < NBR / 100; i += 10)
+			values[i] = 1000 + i;
+		for (int i = 5; i < NBR / 100; i += 10)
+			values[i] = -1;
+		for (int i = 0; i < NBR / 100; i++)
+		{
+			if (values[i] != -1)
+				heap.push(values[i]);
+		}
+
+		std::cout << "heap.size()	\x1b[16G= " << heap.size()				<< std::endl;
+		std::cout << "heap[20]	\x1b[16G= " << values[20]					<< std::endl;
+		std::cout << "contains(5)	\x1b[16G= " << (values[5] != -1)			<< std::endl;
+
+		for (int i = 0; i < 5; i++)
+		{
+			std::cout << "heap.top()	\x1b[16G= " << heap.top()	<< std::endl;
+			heap.pop();
+		}
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- LONG RING BUFFERS, 1 PRODUCER AND 1 CONSUMER -----" << std::endl << std::endl;
+		ft::queue<long>							rb;
+		long									pushed = 0;
+		long									popped = 0;
+		long									out_of_order = 0;
+
+		for (long v = 1; v <= NBR; v++)
+		{
+			rb.push(v);
+			pushed += v;
+		}
+		for (long expected = 1; !rb.empty(); rb.pop(), expected++)
+		{
+			out_of_order += rb.front() != expected;
+			popped += rb.front();
+		}
+
+		std::cout << "pushed sum		\x1b[24G= " << pushed			<< std::endl;
+		std::cout << "popped sum		\x1b[24G= " << popped			<< std::endl;
+		std::cout << "out of order		\x1b[24G= " << out_of_order	<< std::endl;
+		std::cout << "rb.empty()		\x1b[24G= " << rb.empty()		<< std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- LONG RING BUFFERS, 4 PRODUCERS AND 4 CONSUMERS -----" << std::endl << std::endl;
+		ft::queue<long>							rb;
+		long									pushed = 0;
+		long									popped = 0;
+
+		for (long v = 1; v <= NBR; v++)
+		{
+			rb.push(v);
+			pushed += v;
+		}
+		for (; !rb.empty(); rb.pop())
+			popped += rb.front();
+
+		std::cout << "pushed sum		\x1b[24G= " << pushed			<< std::endl;
+		std::cout << "popped sum		\x1b[24G= " << popped			<< std::endl;
+		std::cout << "rb.empty()		\x1b[24G= " << rb.empty()		<< std::endl;
+
+		std::cout << std::endl;
+	}
+
+	gettimeofday(&end, 0);
+	long	seconds		= end.tv_sec - begin.tv_sec;
+	long	useconds	= end.tv_usec - begin.tv_usec;
+	double	time		= seconds * 1e6 + useconds;
+
+	std::cout << "Execution time for std_queue: " << time << " microseconds." << std::endl;
+	std::cout << std::endl;
+	std::cout << std::endl;
+
+	return;
+}
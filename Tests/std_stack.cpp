@@ -6,18 +6,42 @@
 /*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/15 18:17:48 by hcremers          #+#    #+#             */
-/*   Updated: 2022/12/20 14:23:12 by hcremers         ###   ########.fr       */
+/*   Updated: 2026/10/19 11:08:21 by hcremers         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include <stack>
+#include <utility>
+#include <vector>
 namespace ft = std;
 
 #include <iostream>
+#include <iterator>
+#include <sstream>
 #include <sys/time.h>
 
 #define NBR 100000
 
+void	run_stack_threads(ft::stack<long>& stk, const char* name)
+{
+	long	pushed = 0;
+	long	popped = 0;
+
+	for (long v = 1; v <= 4 * 20000; v++)
+	{
+		stk.push(v);
+		pushed += v;
+	}
+	for (; !stk.empty(); stk.pop())
+		popped += stk.top();
+
+	std::cout << name << " pushed sum	\x1b[24G= " << pushed		<< std::endl;
+	std::cout << name << " popped sum	\x1b[24G= " << popped		<< std::endl;
+	std::cout << name << ".empty()	\x1b[24G= " << stk.empty()	<< std::endl;
+
+	return;
+}
+
 void	std_stack()
 {
 	struct timeval	begin, end;
@@ -81,6 +105,124 @@ void	std_stack()
 		std::cout << std::endl;
 	}
 
+	{
+		std::cout << "----- INT CONCURRENT STACKS -----" << std::endl << std::endl;
+		ft::stack<int>							stk1;
+		ft::stack<int>							stk2;
+		int										value = 0;
+
+		for (int i = 0; i < NBR; i++)
+			stk1.push(i);
+		for (int i = 0; i < NBR / 2; i++)
+			stk1.pop();
+		value = stk1.top();
+
+		std::cout << "stk1.size()	\x1b[16G= " << stk1.size()	<< std::endl;
+		std::cout << "stk1.top()	\x1b[16G= " << value		<< std::endl << std::endl;
+
+		stk2.push(42);
+		stk2.push(19);
+		stk2.push(1337);
+
+		bool									pushed = (stk2.size() < 3);
+
+		std::cout << "stk2.push(0)	\x1b[16G= " << pushed		<< std::endl;
+		std::cout << "stk2.size()	\x1b[16G= " << stk2.size()	<< std::endl;
+
+		for (; !stk2.empty(); stk2.pop())
+			std::cout << "stk2.pop()	\x1b[16G= " << stk2.top()	<< std::endl;
+		std::cout << "stk2.empty()	\x1b[16G= " << stk2.empty()	<< std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- STACK BATCHES -----" << std::endl << std::endl;
+		ft::stack<int>							stk1;
+		ft::vector<int>							adj;
+
+		for (int i = 0; i < 100; i++)
+			adj.push_back(i);
+		for (int i = 0; i < NBR / 100; i++)
+		{
+			for (size_t j = 0; j < adj.size(); j++)
+				stk1.push(adj[j]);
+		}
+		for (int i = 0; i < NBR / 2 + 42; i++)
+			stk1.pop();
+
+		std::cout << "stk1.size()	\x1b[16G= " << stk1.size()	<< std::endl;
+		std::cout << "stk1.top()	\x1b[16G= " << stk1.top()	<< std::endl << std::endl;
+
+		ft::stack<std::string>					stk2;
+		ft::stack<ft::pair<int, std::string> >	stk3;
+
+		stk2.push(std::string(3, 'x'));
+		stk2.push(std::string("Forty-two"));
+		stk2.push(std::string());
+		stk3.push(ft::pair<int, std::string>(1337, "One thousand three hundreds thirty-seven"));
+
+		std::cout << "stk2.size()	\x1b[16G= " << stk2.size()	<< std::endl;
+		while (stk2.size())
+		{
+			std::cout << "stk2.top()	\x1b[16G= " << stk2.top()	<< std::endl;
+			stk2.pop();
+		}
+		std::cout << "stk3.top()	\x1b[16G= " << stk3.top().first << " " << stk3.top().second	<< std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT STATIC STACKS -----" << std::endl << std::endl;
+		ft::stack<int>							stk1;
+		bool									thrown = false;
+
+		stk1.push(42);
+		stk1.push(19);
+		stk1.push(1337);
+		thrown = (stk1.size() == 3);
+
+		std::cout << "stk1.push(0)	\x1b[16G= " << thrown		<< std::endl;
+		std::cout << "stk1.size()	\x1b[16G= " << stk1.size()	<< std::endl;
+		std::cout << "stk1.full()	\x1b[16G= " << (stk1.size() == 3)	<< std::endl;
+
+		while (stk1.size())
+		{
+			std::cout << "stk1.top()	\x1b[16G= " << stk1.top()	<< std::endl;
+			stk1.pop();
+		}
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- LONG CONCURRENT STACKS, 4 PUSHERS AND 4 POPPERS -----" << std::endl << std::endl;
+		ft::stack<long>							stk1;
+		ft::stack<long>							stk2;
+
+		run_stack_threads(stk1, "stk1");
+		run_stack_threads(stk2, "stk2");
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT STACKS FROM STREAMS -----" << std::endl << std::endl;
+		std::istringstream						in("4 8 15 16 23 42");
+		ft::stack<int>							stk1;
+
+		stk1.push(0);
+		for (std::istream_iterator<int> it(in); it != std::istream_iterator<int>(); ++it)
+			stk1.push(*it);
+
+		std::cout << "stk1.size()	\x1b[16G= " << stk1.size()	<< std::endl;
+		for (; !stk1.empty(); stk1.pop())
+			std::cout << "stk1.top()	\x1b[16G= " << stk1.top()	<< std::endl;
+
+		std::cout << std::endl;
+	}
+
 	gettimeofday(&end, 0);
 	long	seconds		= end.tv_sec - begin.tv_sec;
 	long	useconds	= end.tv_usec - begin.tv_usec;
@@ -6,18 +6,45 @@
 /*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/15 18:17:48 by hcremers          #+#    #+#             */
-/*   Updated: 2022/12/20 14:23:31 by hcremers         ###   ########.fr       */
+/*   Updated: 2026/10/19 11:09:16 by hcremers         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include <vector>
+#include <utility>
 namespace ft = std;
 
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
 #include <sys/time.h>
 
 #define NBR 100000
 
+struct	by_first
+{
+	bool	operator()(const ft::pair<int, int>& x, const ft::pair<int, int>& y) const
+		{return (x.first < y.first);}
+};
+
+void	print_set(const char* name, const ft::vector<int>& vct)
+{
+	unsigned long	hash = 0;
+
+	for (size_t i = 0; i < vct.size(); i++)
+		hash = hash * 31 + vct[i];
+
+	std::cout << name << "	\x1b[24G= " << vct.size() << " elements, hash " << hash;
+	for (size_t i = 0; i < vct.size() && i < 8; i++)
+		std::cout << (i ? ", " : " {") << vct[i];
+	std::cout << (vct.empty() ? "" : (vct.size() > 8 ? ", ...}" : "}")) << std::endl;
+
+	return;
+}
+
 void	std_vector()
 {
 	struct timeval	begin, end;
@@ -145,6 +172,211 @@ void	std_vector()
 		std::cout << std::endl;
 	}
 
+	{
+		std::cout << "----- INT STATIC VECTORS -----" << std::endl << std::endl;
+		ft::vector<int>							vct1;
+		bool									thrown = false;
+
+		vct1.reserve(64);
+		for (int i = 0; i < 64; i++)
+			vct1.push_back(i * 3);
+		thrown = (vct1.size() == 64);
+
+		std::cout << "vct1.size()	\x1b[16G= " << vct1.size()		<< std::endl;
+		std::cout << "vct1.capacity()	\x1b[16G= " << vct1.capacity()	<< std::endl;
+		std::cout << "push_back(0)	\x1b[16G= " << thrown			<< std::endl;
+		std::cout << "vct1[10]	\x1b[16G= " << vct1[10]			<< std::endl;
+		std::cout << "vct1.back()	\x1b[16G= " << vct1.back()		<< std::endl << std::endl;
+
+		vct1.erase(vct1.begin() + 10, vct1.begin() + 20);
+		vct1.insert(vct1.begin(), 3, 42);
+
+		ft::vector<int>							vct2(vct1);
+
+		std::cout << "vct1.size()	\x1b[16G= " << vct1.size()		<< std::endl;
+		std::cout << "vct1.front()	\x1b[16G= " << vct1.front()		<< std::endl;
+		std::cout << "vct1[13]	\x1b[16G= " << vct1[13]			<< std::endl;
+		std::cout << "vct1 == vct2	\x1b[16G= " << (vct1 == vct2)		<< std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT VECTOR DISTANCES -----" << std::endl << std::endl;
+		ft::vector<int>							vct;
+
+		for (int i = 0; i < 100; i++)
+			vct.push_back(i * 2);
+
+		const ft::vector<int>&					cvct = vct;
+		ft::vector<int>::iterator				it = vct.begin();
+		ft::vector<int>::const_iterator			cit = cvct.end();
+		ft::vector<int>::reverse_iterator		rit = vct.rbegin();
+		ft::vector<int>::const_reverse_iterator	crit = cvct.rend();
+
+		ft::advance(it, 40);
+		std::cout << "advance(it, 40)	\x1b[16G= " << *it	<< std::endl;
+		ft::advance(it, -15);
+		std::cout << "advance(it, -15)	\x1b[16G= " << *it	<< std::endl;
+		ft::advance(it, 75);
+		std::cout << "it == end()	\x1b[16G= " << (it == vct.end())	<< std::endl;
+		ft::advance(cit, -1);
+		std::cout << "advance(cit, -1)	\x1b[16G= " << *cit	<< std::endl;
+		ft::advance(rit, 10);
+		std::cout << "advance(rit, 10)	\x1b[16G= " << *rit	<< std::endl;
+		ft::advance(rit, 90);
+		std::cout << "rit == rend()	\x1b[16G= " << (rit == vct.rend())	<< std::endl;
+		ft::advance(crit, -3);
+		std::cout << "advance(crit, -3)	\x1b[16G= " << *crit	<< std::endl;
+
+		std::cout << "distance(begin, end)	\x1b[16G= " << ft::distance(vct.begin(), vct.end())		<< std::endl;
+		std::cout << "distance(end, begin)	\x1b[16G= " << ft::distance(vct.end(), vct.begin())		<< std::endl;
+		std::cout << "distance(cbegin, cit)	\x1b[16G= " << ft::distance(cvct.begin(), cit)			<< std::endl;
+		std::cout << "distance(rbegin, rend)	\x1b[16G= " << ft::distance(vct.rbegin(), vct.rend())	<< std::endl;
+		std::cout << "distance(crit, crend)	\x1b[16G= " << ft::distance(crit, cvct.rend())			<< std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT VECTOR SET OPERATIONS -----" << std::endl << std::endl;
+		ft::vector<int>							vct1;
+		ft::vector<int>							vct2;
+		ft::vector<int>							vct3;
+		ft::vector<int>							empty;
+
+		for (int i = 0; i < 60; i++)
+			vct1.push_back(i / 3 * 2);
+		for (int i = 0; i < 40; i++)
+			vct2.push_back(i / 2 * 3);
+		for (int i = 0; i < 30; i++)
+			vct3.push_back(1000 + i);
+
+		const ft::vector<int>*					lhs[] = {&vct1, &vct1, &vct3, &empty, &vct1, &empty};
+		const ft::vector<int>*					rhs[] = {&vct2, &vct3, &vct1, &vct1, &empty, &empty};
+		const char*								names[] = {"overlapping", "disjoint", "disjoint swapped", "empty lhs", "empty rhs", "both empty"};
+
+		for (int i = 0; i < 6; i++)
+		{
+			ft::vector<int>						res;
+
+			std::cout << "--- " << names[i] << " ---" << std::endl;
+			ft::set_union(lhs[i]->begin(), lhs[i]->end(), rhs[i]->begin(), rhs[i]->end(), std::back_inserter(res));
+			print_set("set_union", res);
+			res.clear();
+			ft::set_intersection(lhs[i]->begin(), lhs[i]->end(), rhs[i]->begin(), rhs[i]->end(), std::back_inserter(res));
+			print_set("set_intersection", res);
+			res.clear();
+			ft::set_difference(lhs[i]->begin(), lhs[i]->end(), rhs[i]->begin(), rhs[i]->end(), std::back_inserter(res));
+			print_set("set_difference", res);
+		}
+
+		ft::vector<int>							rev1(vct1.rbegin(), vct1.rend());
+		ft::vector<int>							rev2(vct2.rbegin(), vct2.rend());
+		ft::vector<int>							res;
+
+		std::cout << "--- descending ---" << std::endl;
+		ft::set_union(rev1.begin(), rev1.end(), rev2.begin(), rev2.end(), std::back_inserter(res), std::greater<int>());
+		print_set("set_union", res);
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- INT VECTOR STABLE SORTS -----" << std::endl << std::endl;
+		unsigned long							seed = 3;
+		size_t									sizes[] = {0, 1, 15, 16, 17, 1000, 20000};
+
+		for (int s = 0; s < 7; s++)
+		{
+			ft::vector<ft::pair<int, int> >		vct;
+
+			for (size_t i = 0; i < sizes[s]; i++)
+			{
+				seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+				vct.push_back(ft::make_pair(static_cast<int>((seed >> 33) % 37), static_cast<int>(i)));
+			}
+			ft::stable_sort(vct.begin(), vct.end(), by_first());
+
+			bool								sorted = true;
+			bool								stable = true;
+			unsigned long						hash = 0;
+
+			for (size_t i = 0; i < vct.size(); i++)
+			{
+				hash = hash * 31 + vct[i].first * 100003 + vct[i].second;
+				if (i && vct[i - 1].first > vct[i].first)
+					sorted = false;
+				if (i && vct[i - 1].first == vct[i].first && vct[i - 1].second > vct[i].second)
+					stable = false;
+			}
+			std::cout << "stable_sort(" << sizes[s] << ")	\x1b[24G= sorted " << sorted << " stable " << stable << " hash " << hash << std::endl;
+		}
+
+		ft::vector<int>							vct;
+
+		for (int i = 0; i < 100; i++)
+			vct.push_back((i * 37) % 23);
+		ft::stable_sort(vct.begin(), vct.end());
+		print_set("stable_sort(ints)", vct);
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- STRING VECTORS FROM STREAMS -----" << std::endl << std::endl;
+		typedef std::istream_iterator<std::string>	word_iterator;
+
+		std::istringstream						in1("alpha-alpha-alpha-alpha beta-beta-beta-beta-beta gamma-gamma-gamma-gamma");
+		std::istringstream						in2("delta-delta-delta-delta-delta epsilon-epsilon-epsilon-epsilon");
+		std::istringstream						in3("zeta-zeta-zeta-zeta-zeta-zeta eta-eta-eta-eta-eta-eta-eta theta-theta-theta-theta");
+		ft::vector<std::string>					vct1((word_iterator(in1)), word_iterator());
+		ft::vector<std::string>					vct2(vct1.rbegin(), vct1.rend());
+		ft::vector<std::string>					vct3(vct1);
+
+		vct2.assign(word_iterator(in2), word_iterator());
+		vct3.insert(vct3.begin() + 1, word_iterator(in3), word_iterator());
+
+		std::cout << "vct1.size()	\x1b[16G= " << vct1.size() << std::endl;
+		for (size_t i = 0; i < vct1.size(); i++)
+			std::cout << "vct1[" << i << "]	\x1b[16G= " << vct1[i] << std::endl;
+		std::cout << "vct2.size()	\x1b[16G= " << vct2.size() << std::endl;
+		for (size_t i = 0; i < vct2.size(); i++)
+			std::cout << "vct2[" << i << "]	\x1b[16G= " << vct2[i] << std::endl;
+		std::cout << "vct3.size()	\x1b[16G= " << vct3.size() << std::endl;
+		for (size_t i = 0; i < vct3.size(); i++)
+			std::cout << "vct3[" << i << "]	\x1b[16G= " << vct3[i] << std::endl;
+
+		std::cout << std::endl;
+	}
+
+	{
+		std::cout << "----- STRING STATIC VECTORS FROM STREAMS -----" << std::endl << std::endl;
+		typedef std::istream_iterator<std::string>	word_iterator;
+
+		std::istringstream						in1("alpha-alpha-alpha-alpha beta-beta-beta-beta-beta gamma-gamma-gamma-gamma");
+		std::istringstream						in2("delta-delta-delta-delta-delta epsilon-epsilon-epsilon-epsilon");
+		std::istringstream						in3("zeta-zeta-zeta-zeta-zeta-zeta eta-eta-eta-eta-eta-eta-eta");
+		std::istringstream						in4("theta-theta-theta-theta iota-iota-iota-iota-iota");
+		ft::vector<std::string>					vct1((word_iterator(in1)), word_iterator());
+		ft::vector<std::string>					vct2(vct1);
+		bool									thrown = false;
+
+		vct2.assign(word_iterator(in2), word_iterator());
+		vct2.insert(vct2.begin() + 1, word_iterator(in3), word_iterator());
+		thrown = (vct1.size() + ft::distance(word_iterator(in4), word_iterator()) > 4);
+
+		std::cout << "insert(2 words)	\x1b[16G= " << thrown << std::endl;
+		std::cout << "vct1.size()	\x1b[16G= " << vct1.size() << std::endl;
+		for (size_t i = 0; i < vct1.size(); i++)
+			std::cout << "vct1[" << i << "]	\x1b[16G= " << vct1[i] << std::endl;
+		std::cout << "vct2.size()	\x1b[16G= " << vct2.size() << std::endl;
+		for (size_t i = 0; i < vct2.size(); i++)
+			std::cout << "vct2[" << i << "]	\x1b[16G= " << vct2[i] << std::endl;
+
+		std::cout << std::endl;
+	}
+
 	gettimeofday(&end, 0);
 	long	seconds		= end.tv_sec - begin.tv_sec;
 	long	useconds	= end.tv_usec - begin.tv_usec;
@@ -6,7 +6,7 @@
 /*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/07 11:33:25 by hcremers          #+#    #+#             */
-/*   Updated: 2022/12/20 14:26:05 by hcremers         ###   ########.fr       */
+/*   Updated: 2026/10/19 10:11:58 by hcremers         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,6 +15,8 @@
 #include <deque>
 
 #include "Containers/map.hpp"
+#include "Containers/multimap.hpp"
+#include "Containers/set.hpp"
 #include "Containers/stack.hpp"
 #include "Containers/vector.hpp"
 
@@ -51,6 +53,8 @@ public:
 };
 
 void	ft_map();
+void	ft_queue();
+void	ft_set();
 void	ft_stack();
 void	ft_vector();
 
@@ -58,7 +62,9 @@ int main(int argc, char** argv)
 {
 	ft_vector();
 	ft_stack();
+	ft_queue();
 	ft_map();
+	ft_set();
 
 	if (argc != 2)
 	{
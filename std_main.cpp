@@ -6,7 +6,7 @@
 /*   By: hcremers <hcremers@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/07 11:33:25 by hcremers          #+#    #+#             */
-/*   Updated: 2022/12/20 14:26:12 by hcremers         ###   ########.fr       */
+/*   Updated: 2026/10/19 10:11:58 by hcremers         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,6 +15,7 @@
 #include <deque>
 
 #include <map>
+#include <set>
 #include <stack>
 #include <vector>
 namespace ft = std;
@@ -51,6 +52,8 @@ public:
 };
 
 void	std_map();
+void	std_queue();
+void	std_set();
 void	std_stack();
 void	std_vector();
 
@@ -58,7 +61,9 @@ int main(int argc, char** argv)
 {
 	std_vector();
 	std_stack();
+	std_queue();
 	std_map();
+	std_set();
 
 	if (argc != 2)
 	{